@@ -159,6 +159,17 @@ public:
      */
     RemoteContext::Ptr GetContext() const;
 
+    /**
+     * @brief Replaces the weights of the executable network with the weights of the given network
+     *
+     * The network must have the same topology and must be configured (input precisions, pre-processing)
+     * the same way as the network the executable network was loaded from. Only the constant data is taken from
+     * the network, so the device may reuse the compiled network instead of loading it again.
+     *
+     * @param network Network with the new weights
+     */
+    void UpdateWeights(const CNNNetwork& network);
+
     /**
      * @brief Checks if current ExecutableNetwork object is not initialized
      * @return true if current ExecutableNetwork object is not initialized, false - otherwise
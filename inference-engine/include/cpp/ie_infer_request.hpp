@@ -12,6 +12,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "ie_blob.h"
 #include "cpp/ie_memory_state.hpp"
@@ -217,6 +218,29 @@ public:
      */
     std::vector<VariableState> QueryState();
 
+    /**
+     * @brief Switches the request to the states of the given sessions.
+     *
+     * States of each session are kept by the plugin between inferences, so one request can serve several
+     * independent streams of a stateful network. A new session starts with the default state.
+     * Several sessions are processed in one batched inference: states of the i-th session are used for the i-th
+     * batch item, so the number of sessions must match the batch dimension of the states.
+     * @param sessionIds Names of the sessions. Empty vector switches the request back to its own states.
+     */
+    void SetStateSessions(const std::vector<std::string>& sessionIds);
+
+    /**
+     * @brief Switches the request to the states of the given session.
+     * @param sessionId Name of the session
+     */
+    void SetStateSession(const std::string& sessionId);
+
+    /**
+     * @brief Releases states of the session, so the plugin can reuse them for new sessions.
+     * @param sessionId Name of the session
+     */
+    void ReleaseStateSession(const std::string& sessionId);
+
     IE_SUPPRESS_DEPRECATED_START
     /**
      * @brief  IInferRequest pointer to be used directly in CreateInferRequest functions
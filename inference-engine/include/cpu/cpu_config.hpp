@@ -0,0 +1,57 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines advanced related properties for CPU plugin.
+ * These properties should be used in SetConfig() and LoadNetwork() methods of plugins
+ *
+ * @file cpu_config.hpp
+ */
+
+#pragma once
+
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief CPU plugin configuration
+ */
+namespace CPUConfigParams {
+
+/**
+ * @def CPU_CONFIG_KEY(name)
+ * @brief Shortcut for defining configuration keys
+ */
+#define CPU_CONFIG_KEY(name) InferenceEngine::CPUConfigParams::_CONFIG_KEY(CPU_##name)
+
+#define DECLARE_CPU_CONFIG_KEY(name) DECLARE_CONFIG_KEY(CPU_##name)
+
+/**
+ * @brief Minimal share of zero weights blocks starting from which FullyConnected layers with constant FP32 weights
+ * are executed by the block-sparse kernel.
+ * The value is a floating point number in the [0, 1] range serialized to string with decimal separator equals to . (dot).
+ * The default value is 1, which disables the block-sparse execution.
+ */
+DECLARE_CPU_CONFIG_KEY(SPARSE_WEIGHTS_DECOMPRESSION_RATE);
+
+/**
+ * @brief Maximal number of source rows (product of all input dimensions except the last one) of FullyConnected layers
+ * which keep U8/I8 compressed weights and decompress them inside the kernel. Bigger layers are executed by oneDNN with
+ * the weights decompressed to FP32 once at load time, so that the post operations can be fused.
+ * The value is a non-negative integer number serialized to string, 0 disables the decompression. The default value is 16.
+ */
+DECLARE_CPU_CONFIG_KEY(INT8_WEIGHTS_DECOMPRESSION_MAX_ROWS);
+
+/**
+ * @brief Maximal number of source rows (product of all input dimensions except the last one) of FullyConnected layers
+ * which keep FP16 weights compressed and expand them inside the kernel. Such layers are bound by memory bandwidth,
+ * bigger ones are executed by oneDNN with the weights converted to FP32 once at load time. Post operations are not fused
+ * into the layers with decompressed weights.
+ * The value is a non-negative integer number serialized to string, 0 disables the decompression. The default value is 0.
+ */
+DECLARE_CPU_CONFIG_KEY(FP16_WEIGHTS_DECOMPRESSION_MAX_ROWS);
+
+}  // namespace CPUConfigParams
+}  // namespace InferenceEngine
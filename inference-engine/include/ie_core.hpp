@@ -60,6 +60,10 @@ public:
      *  * if bin file with the same name was not found, will load IR without weights.
      * For ONNX format (*.onnx or *.prototxt):
      *  * binPath parameter is not used.
+     * @note The IR weights file is mapped to the memory, the constants of the created InferenceEngine::CNNNetwork
+     * object share the mapped data. So, do not modify, truncate or overwrite the weights file while the network,
+     * or any of its constants, is alive. Use the CONFIG_KEY(ENABLE_MMAP) core config key set to CONFIG_VALUE(NO)
+     * to read the whole file to the memory instead.
      * @return CNNNetwork
      */
     CNNNetwork ReadNetwork(const std::wstring& modelPath, const std::wstring& binPath = {}) const;
@@ -74,6 +78,10 @@ public:
      *  * if bin file with the same name was not found, will load IR without weights.
      * For ONNX format (*.onnx or *.prototxt):
      *  * binPath parameter is not used.
+     * @note The IR weights file is mapped to the memory, the constants of the created InferenceEngine::CNNNetwork
+     * object share the mapped data. So, do not modify, truncate or overwrite the weights file while the network,
+     * or any of its constants, is alive. Use the CONFIG_KEY(ENABLE_MMAP) core config key set to CONFIG_VALUE(NO)
+     * to read the whole file to the memory instead.
      * @return CNNNetwork
      */
     CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath = {}) const;
@@ -431,5 +431,17 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
  */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
+/**
+ * @brief This key enables mapping of the IR weights file to the memory in Core::ReadNetwork (YES/NO, YES by default).
+ *
+ * The constants data of the mapped file is read from the disk on the first access only. The key is set for the Core
+ * object only, if the mapping is disabled, the whole weights file is read to the memory:
+ *
+ * @code
+ * ie.SetConfig({{CONFIG_KEY(ENABLE_MMAP), CONFIG_VALUE(NO)}});
+ * @endcode
+ */
+DECLARE_CONFIG_KEY(ENABLE_MMAP);
+
 }  // namespace PluginConfigParams
 }  // namespace InferenceEngine
@@ -130,6 +130,26 @@ static const char cache_dir_message[] = "Optional. Enables caching of loaded mod
 static const char load_from_file_message[] = "Optional. Loads model from file directly without ReadNetwork."
                                              "All CNNNetwork options (like re-shape) will be ignored";
 
+// @brief message for streaming inputs
+static const char stream_inputs_message[] = "Optional. Feed distinct inputs from the -i files to every iteration instead of filling infer requests "
+                                            "once. Files are read and decoded by a background thread, a single binary file larger than one "
+                                            "sample is treated as a dataset of consecutive samples.";
+
+// @brief message for prefetch depth
+static const char prefetch_depth_message[] = "Optional. Number of sample sets read ahead by the input streaming thread. Default value is 16.";
+
+// @brief message for open-loop request rate
+static const char rate_message[] = "Optional. Enables open-loop mode: requests are issued at the given rate (requests per second) "
+                                   "regardless of completions, and latencies include the time spent waiting for an idle infer request. "
+                                   "Requires async API.";
+
+// @brief message for arrival distribution
+static const char arrival_message[] = "Optional. Distribution of request arrivals in open-loop mode: \"constant\" (default) or \"poisson\".";
+
+// @brief message for latency SLO
+static const char slo_p99_message[] = "Optional. 99th percentile latency target in ms. Searches for the maximal open-loop request rate meeting "
+                                      "the target, every probe runs for -t seconds. -rate sets the initial rate of the search.";
+
 // @brief message for quantization bits
 static const char gna_qb_message[] = "Optional. Weight bits for quantization:  8 or 16 (default)";
 
@@ -231,6 +251,21 @@ DEFINE_string(shape, "", shape_message);
 /// @brief Define flag for layout shape <br>
 DEFINE_string(layout, "", layout_message);
 
+/// @brief Define flag for streaming distinct inputs per iteration <br>
+DEFINE_bool(stream_inputs, false, stream_inputs_message);
+
+/// @brief Define parameter for the input streaming prefetch depth <br>
+DEFINE_uint32(prefetch_depth, 16, prefetch_depth_message);
+
+/// @brief Define parameter for open-loop request rate <br>
+DEFINE_double(rate, 0.0, rate_message);
+
+/// @brief Define parameter for open-loop arrival distribution <br>
+DEFINE_string(arrival, "constant", arrival_message);
+
+/// @brief Define parameter for p99 latency SLO in ms <br>
+DEFINE_double(slo_p99, 0.0, slo_p99_message);
+
 /// @brief Define flag for quantization bits (default 16)
 DEFINE_int32(qb, 16, gna_qb_message);
 
@@ -278,6 +313,12 @@ static void showUsage() {
     std::cout << "    -layout                   " << layout_message << std::endl;
     std::cout << "    -cache_dir \"<path>\"        " << cache_dir_message << std::endl;
     std::cout << "    -load_from_file           " << load_from_file_message << std::endl;
+    std::cout << "    -stream_inputs            " << stream_inputs_message << std::endl;
+    std::cout << "    -prefetch_depth \"<integer>\" " << prefetch_depth_message << std::endl;
+    std::cout << std::endl << "  Sustained load options:" << std::endl;
+    std::cout << "    -rate \"<double>\"          " << rate_message << std::endl;
+    std::cout << "    -arrival \"<distribution>\" " << arrival_message << std::endl;
+    std::cout << "    -slo_p99 \"<double>\"       " << slo_p99_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
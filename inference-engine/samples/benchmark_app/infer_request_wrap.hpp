@@ -14,6 +14,7 @@
 #include <mutex>
 #include <queue>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "statistics_report.hpp"
@@ -39,7 +40,14 @@ public:
     }
 
     void startAsync() {
+        startAsync(Time::now());
+    }
+
+    /// @brief Starts the request that was due at scheduledTime; the time it waited for an idle request is counted
+    /// in getTotalTimeInMilliseconds()
+    void startAsync(Time::time_point scheduledTime) {
         _startTime = Time::now();
+        _scheduledTime = std::min(scheduledTime, _startTime);
         _request.StartAsync();
     }
 
@@ -49,6 +57,7 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _scheduledTime = _startTime;
         _request.Infer();
         _endTime = Time::now();
         _callbackQueue(_id, getExecutionTimeInMilliseconds());
@@ -67,8 +76,19 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    Time::time_point getScheduledTime() const {
+        return _scheduledTime;
+    }
+
+    /// @brief Queueing and execution time: from the moment the request was due till its completion
+    double getTotalTimeInMilliseconds() const {
+        auto totalTime = std::chrono::duration_cast<ns>(_endTime - _scheduledTime);
+        return static_cast<double>(totalTime.count()) * 0.000001;
+    }
+
 private:
     InferenceEngine::InferRequest _request;
+    Time::time_point _scheduledTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
@@ -98,6 +118,7 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _scheduledLatencies.clear();
     }
 
     double getDurationInMilliseconds() {
@@ -107,6 +128,7 @@ public:
     void putIdleRequest(size_t id, const double latency) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        _scheduledLatencies.emplace_back(requests.at(id)->getScheduledTime(), requests.at(id)->getTotalTimeInMilliseconds());
         _idleIds.push(id);
         _endTime = std::max(Time::now(), _endTime);
         _cv.notify_one();
@@ -134,6 +156,12 @@ public:
         return _latencies;
     }
 
+    /// @brief Returns due time and queueing + execution latency of every completed request
+    std::vector<std::pair<Time::time_point, double>> getScheduledLatencies() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        return _scheduledLatencies;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -143,4 +171,5 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<std::pair<Time::time_point, double>> _scheduledLatencies;
 };
@@ -7,7 +7,10 @@
 #include <format_reader_ptr.h>
 
 #include <algorithm>
+#include <cstring>
+#include <functional>
 #include <memory>
+#include <numeric>
 #include <samples/slog.hpp>
 #include <string>
 #include <utility>
@@ -39,27 +42,17 @@ std::vector<std::string> filterFilesByExtensions(const std::vector<std::string>&
     return filtered;
 }
 
-void fillBlobImage(Blob::Ptr& inputBlob, const std::vector<std::string>& filePaths, const size_t& batchSize, const benchmark_app::InputInfo& app_info,
-                   const size_t& requestId, const size_t& inputId, const size_t& inputSize) {
-    MemoryBlob::Ptr minput = as<MemoryBlob>(inputBlob);
-    if (!minput) {
-        IE_THROW() << "We expect inputBlob to be inherited from MemoryBlob in "
-                      "fillBlobImage, "
-                   << "but by fact we were not able to cast inputBlob to MemoryBlob";
-    }
-    // locked memory holder should be alive all time while access to its buffer
-    // happens
-    auto minputHolder = minput->wmap();
-    auto inputBlobData = minputHolder.as<uint8_t*>();
-
+void readImages(uint8_t* inputBlobData, const std::vector<std::string>& filePaths, const size_t& batchSize, const benchmark_app::InputInfo& app_info,
+                const size_t& setId, const size_t& inputId, const size_t& inputSize, bool verbose) {
     /** Collect images data ptrs **/
     std::vector<std::shared_ptr<uint8_t>> vreader;
     vreader.reserve(batchSize);
 
-    for (size_t i = 0ULL, inputIndex = requestId * batchSize * inputSize + inputId; i < batchSize; i++, inputIndex += inputSize) {
+    for (size_t i = 0ULL, inputIndex = setId * batchSize * inputSize + inputId; i < batchSize; i++, inputIndex += inputSize) {
         inputIndex %= filePaths.size();
 
-        slog::info << "Prepare image " << filePaths[inputIndex] << slog::endl;
+        if (verbose)
+            slog::info << "Prepare image " << filePaths[inputIndex] << slog::endl;
         FormatReader::ReaderPtr reader(filePaths[inputIndex].c_str());
         if (reader.get() == nullptr) {
             slog::warn << "Image " << filePaths[inputIndex] << " cannot be read!" << slog::endl << slog::endl;
@@ -97,24 +90,27 @@ void fillBlobImage(Blob::Ptr& inputBlob, const std::vector<std::string>& filePat
     }
 }
 
-template <typename T>
-void fillBlobBinary(Blob::Ptr& inputBlob, const std::vector<std::string>& filePaths, const size_t& batchSize, const size_t& requestId, const size_t& inputId,
-                    const size_t& inputSize) {
+void fillBlobImage(Blob::Ptr& inputBlob, const std::vector<std::string>& filePaths, const size_t& batchSize, const benchmark_app::InputInfo& app_info,
+                   const size_t& requestId, const size_t& inputId, const size_t& inputSize) {
     MemoryBlob::Ptr minput = as<MemoryBlob>(inputBlob);
     if (!minput) {
         IE_THROW() << "We expect inputBlob to be inherited from MemoryBlob in "
-                      "fillBlobBinary, "
+                      "fillBlobImage, "
                    << "but by fact we were not able to cast inputBlob to MemoryBlob";
     }
     // locked memory holder should be alive all time while access to its buffer
     // happens
     auto minputHolder = minput->wmap();
+    readImages(minputHolder.as<uint8_t*>(), filePaths, batchSize, app_info, requestId, inputId, inputSize, true);
+}
 
-    auto inputBlobData = minputHolder.as<char*>();
-    for (size_t i = 0ULL, inputIndex = requestId * batchSize * inputSize + inputId; i < batchSize; i++, inputIndex += inputSize) {
+void readBinaries(char* inputBlobData, const std::vector<std::string>& filePaths, const size_t& batchSize, const size_t& sampleSize, const size_t& setId,
+                  const size_t& inputId, const size_t& inputSize, bool verbose) {
+    for (size_t i = 0ULL, inputIndex = setId * batchSize * inputSize + inputId; i < batchSize; i++, inputIndex += inputSize) {
         inputIndex %= filePaths.size();
 
-        slog::info << "Prepare binary file " << filePaths[inputIndex] << slog::endl;
+        if (verbose)
+            slog::info << "Prepare binary file " << filePaths[inputIndex] << slog::endl;
         std::ifstream binaryFile(filePaths[inputIndex], std::ios_base::binary | std::ios_base::ate);
         if (!binaryFile) {
             IE_THROW() << "Cannot open " << filePaths[inputIndex];
@@ -125,17 +121,33 @@ void fillBlobBinary(Blob::Ptr& inputBlob, const std::vector<std::string>& filePa
         if (!binaryFile.good()) {
             IE_THROW() << "Can not read " << filePaths[inputIndex];
         }
-        auto inputSize = inputBlob->size() * sizeof(T) / batchSize;
-        if (fileSize != inputSize) {
+        if (fileSize != sampleSize) {
             IE_THROW() << "File " << filePaths[inputIndex] << " contains " << std::to_string(fileSize)
                        << " bytes "
                           "but the network expects "
-                       << std::to_string(inputSize);
+                       << std::to_string(sampleSize);
         }
-        binaryFile.read(&inputBlobData[i * inputSize], inputSize);
+        binaryFile.read(&inputBlobData[i * sampleSize], sampleSize);
     }
 }
 
+template <typename T>
+void fillBlobBinary(Blob::Ptr& inputBlob, const std::vector<std::string>& filePaths, const size_t& batchSize, const size_t& requestId, const size_t& inputId,
+                    const size_t& inputSize) {
+    MemoryBlob::Ptr minput = as<MemoryBlob>(inputBlob);
+    if (!minput) {
+        IE_THROW() << "We expect inputBlob to be inherited from MemoryBlob in "
+                      "fillBlobBinary, "
+                   << "but by fact we were not able to cast inputBlob to MemoryBlob";
+    }
+    // locked memory holder should be alive all time while access to its buffer
+    // happens
+    auto minputHolder = minput->wmap();
+
+    auto sampleSize = inputBlob->size() * sizeof(T) / batchSize;
+    readBinaries(minputHolder.as<char*>(), filePaths, batchSize, sampleSize, requestId, inputId, inputSize, true);
+}
+
 template <typename T>
 using uniformDistribution =
     typename std::conditional<std::is_floating_point<T>::value, std::uniform_real_distribution<T>,
@@ -341,3 +353,146 @@ void fillBlobs(const std::vector<std::string>& inputFiles, const size_t& batchSi
         }
     }
 }
+
+InputsStreamer::InputsStreamer(const std::vector<std::string>& inputFiles, const size_t& batchSize, const benchmark_app::InputsInfo& app_inputs_info,
+                               const size_t& prefetchDepth)
+    : _batchSize(batchSize), _prefetchDepth(std::max<size_t>(prefetchDepth, 1)) {
+    _imageFiles = filterFilesByExtensions(inputFiles, supported_image_extensions);
+    std::sort(std::begin(_imageFiles), std::end(_imageFiles));
+    _binaryFiles = filterFilesByExtensions(inputFiles, supported_binary_extensions);
+    std::sort(std::begin(_binaryFiles), std::end(_binaryFiles));
+
+    for (auto& item : app_inputs_info) {
+        auto& app_info = item.second;
+        if (app_info.isImage() ? _imageFiles.empty() : _binaryFiles.empty())
+            continue;
+        if (!app_info.isImage() && app_info.precision != Precision::FP32 && app_info.precision != Precision::FP16 && app_info.precision != Precision::I32 &&
+            app_info.precision != Precision::I64 && app_info.precision != Precision::U8 && app_info.precision != Precision::BOOL) {
+            IE_THROW() << "Input precision is not supported for " << item.first;
+        }
+        size_t elementsCount = std::accumulate(app_info.shape.begin(), app_info.shape.end(), size_t(1), std::multiplies<size_t>());
+        size_t sampleSize = (app_info.isImage() ? 1 : app_info.precision.size()) * elementsCount / _batchSize;
+        size_t id = app_info.isImage() ? _imageInputCount++ : _binaryInputCount++;
+        _streamedInputs.push_back({item.first, app_info, id, sampleSize, 0});
+    }
+    if (_streamedInputs.empty())
+        return;
+
+    // A single binary file bigger than one sample is treated as a dataset of consecutive records,
+    // every record holding one sample of each binary input in the inputs order
+    if (_binaryInputCount > 0 && _binaryFiles.size() == 1) {
+        for (auto& input : _streamedInputs) {
+            if (!input.info.isImage()) {
+                input.setOffset = _datasetRecordSize;
+                _datasetRecordSize += input.sampleSize;
+            }
+        }
+        _datasetFile.open(_binaryFiles.front(), std::ios_base::binary | std::ios_base::ate);
+        if (!_datasetFile) {
+            IE_THROW() << "Cannot open " << _binaryFiles.front();
+        }
+        auto fileSize = static_cast<std::size_t>(_datasetFile.tellg());
+        if (fileSize > _datasetRecordSize && fileSize % _datasetRecordSize == 0) {
+            slog::info << "Binary file " << _binaryFiles.front() << " is used as a dataset of " << fileSize / _datasetRecordSize << " records" << slog::endl;
+            _datasetSize = fileSize / _datasetRecordSize / _batchSize;
+            if (_datasetSize == 0) {
+                IE_THROW() << "Binary dataset " << _binaryFiles.front() << " contains less records than the batch size";
+            }
+        } else {
+            _datasetFile.close();
+            _datasetRecordSize = 0;
+        }
+    }
+    if (!_datasetFile.is_open() && _binaryInputCount > 0)
+        _datasetSize = std::max(_datasetSize, (_binaryFiles.size() + _batchSize * _binaryInputCount - 1) / (_batchSize * _binaryInputCount));
+    if (_imageInputCount > 0)
+        _datasetSize = std::max(_datasetSize, (_imageFiles.size() + _batchSize * _imageInputCount - 1) / (_batchSize * _imageInputCount));
+
+    slog::info << "Streaming " << _streamedInputs.size() << " input(s) from " << _datasetSize << " distinct sample sets, prefetch depth " << _prefetchDepth
+               << slog::endl;
+    _reader = std::thread(&InputsStreamer::readerLoop, this);
+}
+
+InputsStreamer::~InputsStreamer() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _cv.notify_all();
+    if (_reader.joinable())
+        _reader.join();
+}
+
+InputsStreamer::SampleSet InputsStreamer::read(size_t setId) {
+    SampleSet set;
+    set.reserve(_streamedInputs.size());
+    for (auto& input : _streamedInputs) {
+        std::vector<char> data(input.sampleSize * _batchSize);
+        if (input.info.isImage()) {
+            readImages(reinterpret_cast<uint8_t*>(data.data()), _imageFiles, _batchSize, input.info, setId, input.id, _imageInputCount, false);
+        } else if (_datasetFile.is_open()) {
+            for (size_t b = 0; b < _batchSize; b++) {
+                size_t record = (setId * _batchSize + b) % (_datasetSize * _batchSize);
+                _datasetFile.seekg(record * _datasetRecordSize + input.setOffset, std::ios_base::beg);
+                _datasetFile.read(&data[b * input.sampleSize], input.sampleSize);
+                if (!_datasetFile.good()) {
+                    IE_THROW() << "Can not read record " << record << " from " << _binaryFiles.front();
+                }
+            }
+        } else {
+            readBinaries(data.data(), _binaryFiles, _batchSize, input.sampleSize, setId, input.id, _binaryInputCount, false);
+        }
+        set.push_back(std::move(data));
+    }
+    return set;
+}
+
+void InputsStreamer::readerLoop() {
+    try {
+        for (size_t setId = 0;; setId = (setId + 1) % _datasetSize) {
+            auto set = read(setId);
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cv.wait(lock, [this] {
+                return _stop || _queue.size() < _prefetchDepth;
+            });
+            if (_stop)
+                return;
+            _queue.push_back(std::move(set));
+            _cv.notify_all();
+        }
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _error = std::current_exception();
+        _cv.notify_all();
+    }
+}
+
+void InputsStreamer::fill(const InferReqWrap::Ptr& request) {
+    SampleSet set;
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (_queue.empty() && !_error) {
+            auto waitStart = Time::now();
+            _cv.wait(lock, [this] {
+                return !_queue.empty() || _error;
+            });
+            _stallTime += Time::now() - waitStart;
+        }
+        if (_queue.empty())
+            std::rethrow_exception(_error);
+        set = std::move(_queue.front());
+        _queue.pop_front();
+    }
+    _cv.notify_all();
+
+    for (size_t i = 0; i < _streamedInputs.size(); i++) {
+        MemoryBlob::Ptr minput = as<MemoryBlob>(request->getBlob(_streamedInputs[i].name));
+        if (!minput) {
+            IE_THROW() << "We expect inputBlob to be inherited from MemoryBlob in "
+                          "InputsStreamer, "
+                       << "but by fact we were not able to cast inputBlob to MemoryBlob";
+        }
+        auto minputHolder = minput->wmap();
+        std::memcpy(minputHolder.as<char*>(), set[i].data(), std::min(set[i].size(), minput->byteSize()));
+    }
+}
@@ -4,8 +4,15 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <fstream>
 #include <inference_engine.hpp>
+#include <map>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "infer_request_wrap.hpp"
@@ -13,3 +20,64 @@
 
 void fillBlobs(const std::vector<std::string>& inputFiles, const size_t& batchSize, benchmark_app::InputsInfo& app_inputs_info,
                std::vector<InferReqWrap::Ptr> requests);
+
+/// @brief Streams distinct inputs to infer requests: a background thread reads and decodes the next sample sets
+/// into a bounded queue, and every iteration copies a new set into the blobs of the request to be started.
+/// Inputs that are not backed by files keep the values written by fillBlobs.
+class InputsStreamer final {
+public:
+    InputsStreamer(const std::vector<std::string>& inputFiles, const size_t& batchSize, const benchmark_app::InputsInfo& app_inputs_info,
+                   const size_t& prefetchDepth);
+    ~InputsStreamer();
+
+    /// @brief Returns true if no input is backed by files, i.e. there is nothing to stream
+    bool empty() const {
+        return _streamedInputs.empty();
+    }
+
+    /// @brief Number of distinct sample sets the streamer cycles through
+    size_t getDatasetSize() const {
+        return _datasetSize;
+    }
+
+    /// @brief Copies the next prefetched sample set into the request inputs. Blocks while the reader is behind.
+    void fill(const InferReqWrap::Ptr& request);
+
+    /// @brief Total time fill() waited for the reader thread
+    double getStallTimeInMilliseconds() const {
+        return std::chrono::duration_cast<ns>(_stallTime).count() * 0.000001;
+    }
+
+private:
+    struct StreamedInput {
+        std::string name;
+        benchmark_app::InputInfo info;
+        size_t id;          // index among the inputs of the same kind
+        size_t sampleSize;  // bytes per batch element
+        size_t setOffset;   // offset inside a record of a binary dataset file
+    };
+    using SampleSet = std::vector<std::vector<char>>;
+
+    void readerLoop();
+    SampleSet read(size_t setId);
+
+    std::vector<StreamedInput> _streamedInputs;
+    std::vector<std::string> _imageFiles;
+    std::vector<std::string> _binaryFiles;
+    size_t _imageInputCount = 0;
+    size_t _binaryInputCount = 0;
+    size_t _batchSize;
+    size_t _prefetchDepth;
+    size_t _datasetSize = 1;
+    // binary dataset mode: one file holding consecutive records of all binary inputs
+    std::ifstream _datasetFile;
+    size_t _datasetRecordSize = 0;
+
+    std::deque<SampleSet> _queue;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _stop = false;
+    std::exception_ptr _error;
+    Time::duration _stallTime = Time::duration::zero();
+    std::thread _reader;
+};
@@ -0,0 +1,173 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "load_generator.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <random>
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "utils.hpp"
+
+namespace {
+
+constexpr auto reportInterval = std::chrono::seconds(1);
+// number of bisection probes after the rate range is bracketed
+constexpr size_t searchSteps = 6;
+// the range search gives up doubling the rate after this many probes
+constexpr size_t maxBracketSteps = 10;
+
+std::string double_to_string(const double number) {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2) << number;
+    return ss.str();
+}
+
+void fillPercentiles(std::vector<double>& latencies, double& p50, double& p90, double& p99) {
+    if (latencies.empty())
+        return;
+    p50 = getPercentileValue<double>(latencies, 50);
+    p90 = getPercentileValue<double>(latencies, 90);
+    p99 = getPercentileValue<double>(latencies, 99);
+}
+
+}  // namespace
+
+LoadResults runOpenLoop(InferRequestsQueue& inferRequestsQueue, double rate, bool poisson, std::chrono::nanoseconds duration,
+                        InputsStreamer* inputsStreamer, const LoadProgressCallback& progress) {
+    if (rate <= 0.0) {
+        IE_THROW() << "Request rate must be positive, got " << rate;
+    }
+    LoadResults results;
+    results.rate = rate;
+
+    std::mt19937 gen(0);
+    std::exponential_distribution<double> poissonInterval(rate);
+    auto nextInterval = [&]() {
+        return std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(poisson ? poissonInterval(gen) : 1.0 / rate));
+    };
+
+    inferRequestsQueue.resetTimes();
+    const auto startTime = Time::now();
+    const auto endTime = startTime + duration;
+    auto arrival = startTime;
+    for (; arrival < endTime; arrival += nextInterval()) {
+        std::this_thread::sleep_until(arrival);
+        auto inferRequest = inferRequestsQueue.getIdleRequest();
+        if (!inferRequest) {
+            IE_THROW() << "No idle Infer Requests!";
+        }
+        // see the closed loop in main.cpp: wait() re-throws errors of the previous run of the request
+        inferRequest->wait();
+        if (inputsStreamer)
+            inputsStreamer->fill(inferRequest);
+        inferRequest->startAsync(arrival);
+        results.issued++;
+        if (progress)
+            progress(std::min(1.0, std::chrono::duration<double>(arrival - startTime) / duration));
+        if (Time::now() >= endTime) {
+            // overloaded: the arrivals that are still due are not issued
+            arrival += nextInterval();
+            break;
+        }
+    }
+    for (; arrival < endTime; arrival += nextInterval())
+        results.dropped++;
+    inferRequestsQueue.waitAll();
+    if (progress)
+        progress(1.0);
+    results.durationMs = inferRequestsQueue.getDurationInMilliseconds();
+    results.latencies = inferRequestsQueue.getLatencies();
+
+    std::vector<double> latencies;
+    std::vector<std::vector<double>> intervalLatencies;
+    for (auto& sample : inferRequestsQueue.getScheduledLatencies()) {
+        if (sample.first < startTime)
+            continue;
+        size_t interval = static_cast<size_t>((sample.first - startTime) / reportInterval);
+        if (intervalLatencies.size() <= interval)
+            intervalLatencies.resize(interval + 1);
+        intervalLatencies[interval].push_back(sample.second);
+        latencies.push_back(sample.second);
+    }
+    fillPercentiles(latencies, results.p50, results.p90, results.p99);
+    if (!latencies.empty())
+        results.max = *std::max_element(latencies.begin(), latencies.end());
+    for (auto& intervalLatency : intervalLatencies) {
+        LoadInterval interval;
+        interval.count = intervalLatency.size();
+        fillPercentiles(intervalLatency, interval.p50, interval.p90, interval.p99);
+        results.intervals.push_back(interval);
+    }
+    return results;
+}
+
+LoadResults searchRateForSLO(InferRequestsQueue& inferRequestsQueue, double sloP99, double initialRate, bool poisson,
+                             std::chrono::nanoseconds probeDuration, InputsStreamer* inputsStreamer, const LoadProgressCallback& progress) {
+    // the number of probes is known once the rate range is bracketed, until then the longest search is assumed
+    size_t probes = 0;
+    size_t plannedProbes = 1 + maxBracketSteps + searchSteps;
+    auto probeProgress = [&](double fraction) {
+        if (progress)
+            progress(std::min(1.0, (probes + fraction) / plannedProbes));
+    };
+    auto probe = [&](double rate) {
+        auto results = runOpenLoop(inferRequestsQueue, rate, poisson, probeDuration, inputsStreamer, probeProgress);
+        probes++;
+        slog::info << "Rate " << double_to_string(rate) << " req/s: p99 " << double_to_string(results.p99) << " ms, " << results.dropped << " dropped -> "
+                   << (results.meets(sloP99) ? "meets" : "violates") << " SLO" << slog::endl;
+        return results;
+    };
+
+    // bracket the maximal rate: [good, bad)
+    LoadResults good, bad;
+    auto results = probe(initialRate);
+    if (results.meets(sloP99)) {
+        good = results;
+        for (size_t step = 0; step < maxBracketSteps; step++) {
+            results = probe(good.rate * 2);
+            if (!results.meets(sloP99)) {
+                bad = results;
+                break;
+            }
+            good = results;
+        }
+        if (bad.rate == 0.0) {
+            slog::warn << "SLO is met at " << double_to_string(good.rate) << " req/s, stop searching for a higher rate" << slog::endl;
+            return good;
+        }
+    } else {
+        bad = results;
+        for (size_t step = 0; step < maxBracketSteps; step++) {
+            results = probe(bad.rate / 2);
+            if (results.meets(sloP99)) {
+                good = results;
+                break;
+            }
+            bad = results;
+        }
+        if (good.rate == 0.0) {
+            slog::warn << "SLO is violated even at " << double_to_string(bad.rate) << " req/s" << slog::endl;
+            return bad;
+        }
+    }
+
+    plannedProbes = probes + searchSteps;
+    for (size_t step = 0; step < searchSteps; step++) {
+        results = probe((good.rate + bad.rate) / 2);
+        if (results.meets(sloP99)) {
+            good = results;
+        } else {
+            bad = results;
+        }
+    }
+    return good;
+}
@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "infer_request_wrap.hpp"
+#include "inputs_filling.hpp"
+
+/// @brief Latency statistics of the requests that were due within one reporting interval of an open-loop run
+struct LoadInterval {
+    size_t count = 0;
+    double p50 = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+};
+
+/// @brief Results of an open-loop run. Latencies are measured from the moment a request was due,
+/// so they include the time spent waiting for an idle infer request.
+struct LoadResults {
+    double rate = 0.0;
+    size_t issued = 0;
+    size_t dropped = 0;
+    double durationMs = 0.0;
+    double p50 = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+    double max = 0.0;
+    /// execution latencies of the completed requests, without queueing
+    std::vector<double> latencies;
+    std::vector<LoadInterval> intervals;
+
+    bool meets(double sloP99) const {
+        return issued > 0 && dropped == 0 && p99 <= sloP99;
+    }
+};
+
+/// @brief Receives the elapsed fraction of an open-loop run or of the whole SLO search, from 0 to 1
+using LoadProgressCallback = std::function<void(double)>;
+
+/// @brief Issues requests at the target rate (requests per second) with constant or Poisson distributed arrivals
+/// regardless of completions, unlike the closed loop that starts a request as soon as one becomes idle.
+/// Arrivals that could not be issued before the end of the run are reported as dropped.
+LoadResults runOpenLoop(InferRequestsQueue& inferRequestsQueue, double rate, bool poisson, std::chrono::nanoseconds duration,
+                        InputsStreamer* inputsStreamer = nullptr, const LoadProgressCallback& progress = {});
+
+/// @brief Searches for the maximal request rate whose p99 latency does not exceed sloP99 (ms), starting from
+/// the estimated device capacity. Every probe is an open-loop run of probeDuration. All the statistics of the returned
+/// results come from the probe of the returned rate.
+LoadResults searchRateForSLO(InferRequestsQueue& inferRequestsQueue, double sloP99, double initialRate, bool poisson,
+                             std::chrono::nanoseconds probeDuration, InputsStreamer* inputsStreamer = nullptr,
+                             const LoadProgressCallback& progress = {});
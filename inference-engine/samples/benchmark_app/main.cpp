@@ -20,6 +20,7 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "load_generator.hpp"
 #include "progress_bar.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
@@ -66,6 +67,14 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
 
+    if ((FLAGS_rate > 0 || FLAGS_slo_p99 > 0) && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop mode (-rate, -slo_p99) requires -api async.");
+    }
+
+    if (FLAGS_arrival != "constant" && FLAGS_arrival != "poisson") {
+        throw std::logic_error("Incorrect arrival distribution. Please set -arrival option to `constant` or `poisson` value.");
+    }
+
     bool isNetworkCompiled = fileExt(FLAGS_m) == "blob";
     bool isPrecisionSet = !(FLAGS_ip.empty() && FLAGS_op.empty() && FLAGS_iop.empty());
     if (isNetworkCompiled && isPrecisionSet) {
@@ -101,6 +110,8 @@ static void next_step(const std::string additional_info = "") {
 
 template <typename T>
 T getMedianValue(const std::vector<T>& vec) {
+    if (vec.empty())
+        return static_cast<T>(0);
     std::vector<T> sortedVec(vec);
     std::sort(sortedVec.begin(), sortedVec.end());
     return (sortedVec.size() % 2 != 0) ? sortedVec[sortedVec.size() / 2ULL]
@@ -520,6 +531,15 @@ int main(int argc, char* argv[]) {
         InferRequestsQueue inferRequestsQueue(exeNetwork, nireq);
         fillBlobs(inputFiles, batchSize, app_inputs_info, inferRequestsQueue.requests);
 
+        std::unique_ptr<InputsStreamer> inputsStreamer;
+        if (FLAGS_stream_inputs) {
+            inputsStreamer.reset(new InputsStreamer(inputFiles, batchSize, app_inputs_info, FLAGS_prefetch_depth));
+            if (inputsStreamer->empty()) {
+                slog::warn << "No input files to stream: requests keep the inputs filled above" << slog::endl;
+                inputsStreamer.reset();
+            }
+        }
+
         // ----------------- 10. Measuring performance
         // ------------------------------------------------------------------
         size_t progressCnt = 0;
@@ -570,7 +590,8 @@ int main(int argc, char* argv[]) {
             inferRequest->startAsync();
         }
         inferRequestsQueue.waitAll();
-        auto duration_ms = double_to_string(inferRequestsQueue.getLatencies()[0]);
+        double firstLatency = inferRequestsQueue.getLatencies()[0];
+        auto duration_ms = double_to_string(firstLatency);
         slog::info << "First inference took " << duration_ms << " ms" << slog::endl;
         if (statistics)
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {{"first inference time (ms)", duration_ms}});
@@ -584,14 +605,42 @@ int main(int argc, char* argv[]) {
          * executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
-        while ((niter != 0LL && iteration < niter) || (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+        // Open loop: requests are issued at the target rate instead of as soon as an infer request is idle
+        bool openLoop = FLAGS_rate > 0 || FLAGS_slo_p99 > 0;
+        LoadResults loadResults;
+        auto openLoopProgress = [&](double fraction) {
+            size_t newProgress = static_cast<size_t>(fraction * progressBarTotalCount);
+            if (newProgress > progressCnt) {
+                progressBar.addProgress(newProgress - progressCnt);
+                progressCnt = newProgress;
+            }
+        };
+        if (openLoop) {
+            auto runDuration = std::chrono::nanoseconds(duration_nanoseconds != 0 ? duration_nanoseconds
+                                                                                  : getDurationInNanoseconds(deviceDefaultDeviceDurationInSeconds(device_name)));
+            bool poisson = FLAGS_arrival == "poisson";
+            if (FLAGS_slo_p99 > 0) {
+                // without a hint the search starts from the capacity estimated by the first inference
+                double initialRate = FLAGS_rate > 0 ? FLAGS_rate : nireq * 1000.0 / firstLatency;
+                slog::info << "Searching for the maximal rate with p99 latency within " << double_to_string(FLAGS_slo_p99) << " ms" << slog::endl;
+                loadResults = searchRateForSLO(inferRequestsQueue, FLAGS_slo_p99, initialRate, poisson, runDuration, inputsStreamer.get(),
+                                               openLoopProgress);
+            } else {
+                loadResults = runOpenLoop(inferRequestsQueue, FLAGS_rate, poisson, runDuration, inputsStreamer.get(), openLoopProgress);
+            }
+            iteration = loadResults.issued;
+        }
+
+        while (!openLoop && ((niter != 0LL && iteration < niter) || (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                             (FLAGS_api == "async" && iteration % nireq != 0))) {
             inferRequest = inferRequestsQueue.getIdleRequest();
             if (!inferRequest) {
                 IE_THROW() << "No idle Infer Requests!";
             }
 
             if (FLAGS_api == "sync") {
+                if (inputsStreamer)
+                    inputsStreamer->fill(inferRequest);
                 inferRequest->infer();
             } else {
                 // As the inference request is currently idle, the wait() adds no
@@ -601,6 +650,8 @@ int main(int argc, char* argv[]) {
                 // well, but as it uses just error codes it has no details like ‘what()’
                 // method of `std::exception` So, rechecking for any exceptions here.
                 inferRequest->wait();
+                if (inputsStreamer)
+                    inputsStreamer->fill(inferRequest);
                 inferRequest->startAsync();
             }
             iteration++;
@@ -624,8 +675,14 @@ int main(int argc, char* argv[]) {
         // wait the latest inference executions
         inferRequestsQueue.waitAll();
 
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
-        double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
+        // the requests queue keeps the times of the last open-loop run, which is not the reported one after the SLO search
+        auto latencies = openLoop ? loadResults.latencies : inferRequestsQueue.getLatencies();
+        double latency = getMedianValue<double>(latencies);
+        double latencyMin = getPercentileValue<double>(latencies, 0);
+        double latencyP90 = getPercentileValue<double>(latencies, 90);
+        double latencyP99 = getPercentileValue<double>(latencies, 99);
+        double latencyMax = getPercentileValue<double>(latencies, 100);
+        double totalDuration = openLoop ? loadResults.durationMs : inferRequestsQueue.getDurationInMilliseconds();
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency : batchSize * 1000.0 * iteration / totalDuration;
 
         if (statistics) {
@@ -636,8 +693,47 @@ int main(int argc, char* argv[]) {
             if (device_name.find("MULTI") == std::string::npos) {
                 statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {
                                                                                              {"latency (ms)", double_to_string(latency)},
+                                                                                             {"min latency (ms)", double_to_string(latencyMin)},
+                                                                                             {"90th percentile latency (ms)", double_to_string(latencyP90)},
+                                                                                             {"99th percentile latency (ms)", double_to_string(latencyP99)},
+                                                                                             {"max latency (ms)", double_to_string(latencyMax)},
                                                                                          });
             }
+            if (openLoop) {
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          {
+                                              {"request rate (req/s)", double_to_string(loadResults.rate)},
+                                              {"arrivals", FLAGS_arrival},
+                                              {"dropped requests", std::to_string(loadResults.dropped)},
+                                              {"median latency with queueing (ms)", double_to_string(loadResults.p50)},
+                                              {"90th percentile latency with queueing (ms)", double_to_string(loadResults.p90)},
+                                              {"99th percentile latency with queueing (ms)", double_to_string(loadResults.p99)},
+                                              {"max latency with queueing (ms)", double_to_string(loadResults.max)},
+                                          });
+                if (FLAGS_slo_p99 > 0) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {
+                                                  {"p99 latency SLO (ms)", double_to_string(FLAGS_slo_p99)},
+                                                  {"SLO is met", loadResults.meets(FLAGS_slo_p99) ? "yes" : "no"},
+                                              });
+                }
+                for (size_t i = 0; i < loadResults.intervals.size(); i++) {
+                    auto& interval = loadResults.intervals[i];
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {
+                                                  {"second " + std::to_string(i) + " requests/p50/p90/p99 (ms)",
+                                                   std::to_string(interval.count) + "/" + double_to_string(interval.p50) + "/" +
+                                                       double_to_string(interval.p90) + "/" + double_to_string(interval.p99)},
+                                              });
+                }
+            }
+            if (inputsStreamer) {
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          {
+                                              {"streamed sample sets", std::to_string(inputsStreamer->getDatasetSize())},
+                                              {"input streaming stall time (ms)", double_to_string(inputsStreamer->getStallTimeInMilliseconds())},
+                                          });
+            }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {{"throughput", double_to_string(fps)}});
         }
 
@@ -684,9 +780,36 @@ int main(int argc, char* argv[]) {
 
         std::cout << "Count:      " << iteration << " iterations" << std::endl;
         std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
-        if (device_name.find("MULTI") == std::string::npos)
+        if (device_name.find("MULTI") == std::string::npos) {
             std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
+            std::cout << "    Min:    " << double_to_string(latencyMin) << " ms" << std::endl;
+            std::cout << "    P90:    " << double_to_string(latencyP90) << " ms" << std::endl;
+            std::cout << "    P99:    " << double_to_string(latencyP99) << " ms" << std::endl;
+            std::cout << "    Max:    " << double_to_string(latencyMax) << " ms" << std::endl;
+        }
+        if (inputsStreamer && inputsStreamer->getStallTimeInMilliseconds() > 0) {
+            slog::warn << "Inference waited " << double_to_string(inputsStreamer->getStallTimeInMilliseconds())
+                       << " ms for inputs to be read: consider increasing -prefetch_depth or using faster storage" << slog::endl;
+        }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
+        if (openLoop) {
+            for (size_t i = 0; i < loadResults.intervals.size(); i++) {
+                auto& interval = loadResults.intervals[i];
+                slog::info << "Second " << i << ": " << interval.count << " requests, p50 " << double_to_string(interval.p50) << " ms, p90 "
+                           << double_to_string(interval.p90) << " ms, p99 " << double_to_string(interval.p99) << " ms" << slog::endl;
+            }
+            std::cout << "Rate:       " << double_to_string(loadResults.rate) << " req/s (" << FLAGS_arrival << " arrivals), " << loadResults.dropped
+                      << " dropped" << std::endl;
+            std::cout << "Latency with queueing:" << std::endl;
+            std::cout << "    P50:    " << double_to_string(loadResults.p50) << " ms" << std::endl;
+            std::cout << "    P90:    " << double_to_string(loadResults.p90) << " ms" << std::endl;
+            std::cout << "    P99:    " << double_to_string(loadResults.p99) << " ms" << std::endl;
+            std::cout << "    Max:    " << double_to_string(loadResults.max) << " ms" << std::endl;
+            if (FLAGS_slo_p99 > 0) {
+                std::cout << "SLO:        p99 <= " << double_to_string(FLAGS_slo_p99) << " ms is " << (loadResults.meets(FLAGS_slo_p99) ? "met" : "NOT met")
+                          << " at " << double_to_string(loadResults.rate) << " req/s" << std::endl;
+            }
+        }
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
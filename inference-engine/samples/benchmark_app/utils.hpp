@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <map>
 #include <string>
 #include <vector>
@@ -32,6 +33,16 @@ std::string getShapesString(const InferenceEngine::ICNNNetwork::InputShapes& sha
 size_t getBatchSize(const benchmark_app::InputsInfo& inputs_info);
 std::vector<std::string> split(const std::string& s, char delim);
 
+template <typename T>
+T getPercentileValue(const std::vector<T>& vec, double percentile) {
+    if (vec.empty())
+        return static_cast<T>(0);
+    std::vector<T> sortedVec(vec);
+    std::sort(sortedVec.begin(), sortedVec.end());
+    size_t index = static_cast<size_t>(percentile / 100.0 * (sortedVec.size() - 1) + 0.5);
+    return sortedVec[std::min(index, sortedVec.size() - 1)];
+}
+
 template <typename T>
 std::map<std::string, std::string> parseInputParameters(const std::string parameter_string, const std::map<std::string, T>& input_info) {
     // Parse parameter string like "input0[value0],input1[value1]" or "[value]" (applied to all
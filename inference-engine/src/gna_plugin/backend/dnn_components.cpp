@@ -53,14 +53,24 @@ intel_dnn_component_t * DnnComponents::findComponent(InferenceEngine::CNNLayerPt
 }
 
 std::vector<intel_dnn_component_t> DnnComponents::getExecutionOrder() {
-    std::vector<intel_dnn_component_t> result(components.size());
+    std::vector<intel_dnn_component_t> result;
+    result.reserve(components.size());
+
+    for (auto component : getExecutionOrderPtrs()) {
+        result.push_back(*component);
+    }
+    return result;
+}
+
+std::vector<intel_dnn_component_t *> DnnComponents::getExecutionOrderPtrs() {
+    std::vector<intel_dnn_component_t *> result(components.size());
 
     uint32_t direct_id = 0;
     uint32_t delayed_id = static_cast<uint32_t>(components.size() - delayedOperations);
 
     for (auto &&c : components) {
         uint32_t &id = c.isDelayed ? delayed_id : direct_id;
-        result[id] = c.dnnComponent;
+        result[id] = &c.dnnComponent;
         id++;
     }
     return result;
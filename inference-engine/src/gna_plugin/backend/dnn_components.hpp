@@ -46,6 +46,11 @@ struct DnnComponents {
      */
     std::vector<intel_dnn_component_t> getExecutionOrder();
 
+    /**
+     * @brief returns stored components in execution order, so that pointers bound to them can be looked up
+     */
+    std::vector<intel_dnn_component_t *> getExecutionOrderPtrs();
+
 private:
     uint32_t delayedOperations = 0;
 };
@@ -957,6 +957,17 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
 
     void *pParallelExecutionData  = nullptr;
 
+    if (gnaFlags->compact_mode) {
+        // intermediate buffers of the primitives that are never executed at the same time share memory
+        auto execOrder = graphCompiler.dnnComponents.getExecutionOrderPtrs();
+        for (size_t i = 0; i != execOrder.size(); i++) {
+            gnamem->register_usage(&execOrder[i]->ptr_inputs, static_cast<int>(i));
+            gnamem->register_usage(&execOrder[i]->ptr_outputs, static_cast<int>(i));
+        }
+        gnalog() << "RW section size: " << gnamem->getRWBytes() << " bytes, without buffers reuse: "
+                 << gnamem->getRWBytesWithoutReuse() << " bytes\n";
+    }
+
     // reserving more bytes for intermediate data in parallel case - TODO: this works incorrectly in compact mode at lest
     rwSegmentSize = gnamem->getRWBytes();
     if (gnaFlags->gna_lib_async_threads_num > 1) {
@@ -8,11 +8,15 @@
 #include <ie_memcpy.h>
 #include "gna_mem_requests_queue.hpp"
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <vector>
 #include <list>
 #include <algorithm>
 #include <functional>
+#include <map>
+#include <unordered_map>
+#include <memory_solver.hpp>
 #include "gna_lib_ver_selector.hpp"
 
 namespace GNAPluginNS {
@@ -28,7 +32,15 @@ class GNAMemory : public GNAMemRequestsQueue {
     std::list<std::vector<char>> _local_storage;
     size_t _total = 0;
     size_t _rw_section_size = 0;
+    size_t _rw_section_size_without_reuse = 0;
     size_t _ro_section_size = 0;
+    // execution order index of the primitive accessing memory through the given pointer
+    std::unordered_map<const void *, int> _usage_order;
+    // offsets of the requests placed to the shared beginning of the RW section, keyed by request index
+    std::map<size_t, size_t> _shared_offsets;
+    size_t _shared_section_size = 0;
+    // sections sizes are kept until a request is added or a usage is registered
+    bool _sections_sizes_valid = false;
     Allocator _allocator;
     std::shared_ptr<uint8_t> heap = nullptr;
     size_t _page_alignment = 1;
@@ -66,23 +78,6 @@ class GNAMemory : public GNAMemRequestsQueue {
      * @brief calculates size required for all requests, allocates memory and updates pointers
      */
     void commit() {
-        // 1st stage -- looking for expandable bind requests:
-        for (auto &originated : _future_heap) {
-            if (originated._type & REQUEST_BIND) continue;
-            size_t offset = 0;
-            iterate_binded(originated, [&](MemRequest & reference, MemRequest & binded) {
-                if (&originated == &reference) {
-                    offset = 0;
-                }
-                offset += binded._offset;
-                auto current = offset + ALIGN(binded._num_elements * binded._element_size, binded._alignment);
-                auto original_no_pad = ALIGN(originated._num_elements * originated._element_size, originated._alignment);
-                auto original_with_pad = ALIGN(originated._num_elements * originated._element_size + originated._padding, originated._alignment);
-
-                originated._padding = ALIGN(std::max(original_with_pad, current), originated._alignment) - original_no_pad;
-            });
-        }
-
         updateSectionsSizes();
 
         _total = _rw_section_size + _ro_section_size;
@@ -95,10 +90,12 @@ class GNAMemory : public GNAMemRequestsQueue {
                 if (filter(re)) continue;
 
                 auto sz = re._element_size * re._num_elements;
+                auto shared = _shared_offsets.find(static_cast<size_t>(&re - &_future_heap.front()));
+                auto re_offset = shared != _shared_offsets.end() ? shared->second : offset;
 
                 if (re._ptr_out != nullptr) {
-                    auto cptr = heap.get() + offset;
-                    size_t cptr_avail_size = _total - offset;
+                    auto cptr = heap.get() + re_offset;
+                    size_t cptr_avail_size = _total - re_offset;
                     if (re._type & REQUEST_BIND) {
                         cptr = reinterpret_cast<uint8_t*>(*reinterpret_cast<void **>(re._ptr_out));
                         cptr_avail_size = sz;
@@ -135,7 +132,7 @@ class GNAMemory : public GNAMemRequestsQueue {
                         }
                     }
                 }
-                if (!(re._type & REQUEST_BIND)) {
+                if (!(re._type & REQUEST_BIND) && shared == _shared_offsets.end()) {
                     offset += ALIGN(sz + re._padding, re._alignment);
                 }
             }
@@ -144,7 +141,7 @@ class GNAMemory : public GNAMemRequestsQueue {
         setupOffsets([](GNAPluginNS::memory::MemRequest & request) {
             // TODO: consume bind requests separately from storage type
             return !(request._type & REQUEST_BIND) && (request._region != REGION_RW);
-        }, 0);
+        }, _shared_section_size);
 
         setupOffsets([](GNAPluginNS::memory::MemRequest & request) {
             return (request._type & REQUEST_BIND) || request._region != REGION_RO;
@@ -160,6 +157,26 @@ class GNAMemory : public GNAMemRequestsQueue {
         return _rw_section_size;
     }
 
+    /**
+     * @brief size of the RW section if each request got memory of its own, to be compared with getRWBytes()
+     */
+    size_t getRWBytesWithoutReuse() {
+        updateSectionsSizes();
+        return _rw_section_size_without_reuse;
+    }
+
+    /**
+     * @brief registers execution order index of the primitive that accesses memory through the given pointer.
+     * RW allocation requests, which are reached through registered pointers only, live from the first to the last
+     * usage of these pointers, and the requests with disjoint lifetimes share memory at the beginning of the RW section
+     * @param ptr - pointer to be set by commit(), ex. ptr_inputs of a component
+     * @param executionIndex - position of the primitive in execution order
+     */
+    void register_usage(const void *ptr, int executionIndex) {
+        _usage_order[ptr] = executionIndex;
+        _sections_sizes_valid = false;
+    }
+
     size_t getTotalBytes() {
         updateSectionsSizes();
         return _total;
@@ -170,6 +187,8 @@ class GNAMemory : public GNAMemRequestsQueue {
         return REGION_RW;
     };
     std::vector<MemRequest> & futureHeap()  override {
+        // the requests are added through the returned heap
+        _sections_sizes_valid = false;
         return _future_heap;
     }
     std::list<std::vector<char>> &localStorage() override {
@@ -200,11 +219,87 @@ class GNAMemory : public GNAMemRequestsQueue {
     }
 
  protected:
+    void expandBindRequests() {
+        // looking for expandable bind requests:
+        for (auto &originated : _future_heap) {
+            if (originated._type & REQUEST_BIND) continue;
+            size_t offset = 0;
+            iterate_binded(originated, [&](MemRequest & reference, MemRequest & binded) {
+                if (&originated == &reference) {
+                    offset = 0;
+                }
+                offset += binded._offset;
+                auto current = offset + ALIGN(binded._num_elements * binded._element_size, binded._alignment);
+                auto original_no_pad = ALIGN(originated._num_elements * originated._element_size, originated._alignment);
+                auto original_with_pad = ALIGN(originated._num_elements * originated._element_size + originated._padding, originated._alignment);
+
+                originated._padding = ALIGN(std::max(original_with_pad, current), originated._alignment) - original_no_pad;
+            });
+        }
+    }
+
+    /**
+     * @brief places RW allocation requests with known lifetimes using MemorySolver,
+     * requests whose memory is initialized by commit() or accessed through unregistered pointers are left out
+     */
+    void solveSharedSection() {
+        _shared_offsets.clear();
+        _shared_section_size = 0;
+        if (_usage_order.empty()) return;
+
+        std::vector<InferenceEngine::MemorySolver::Box> boxes;
+        size_t unit = 1;
+        for (size_t i = 0; i != _future_heap.size(); i++) {
+            auto &re = _future_heap[i];
+            if (re._type != REQUEST_ALLOCATE || re._region != REGION_RW || re._ptr_out == nullptr) continue;
+
+            bool lifetimeKnown = true;
+            int start = std::numeric_limits<int>::max();
+            int finish = -1;
+            auto use = [&](const MemRequest & request) {
+                auto usage = _usage_order.find(request._ptr_out);
+                if (usage == _usage_order.end() || (request._type & REQUEST_INITIALIZER)) {
+                    lifetimeKnown = false;
+                    return;
+                }
+                start = std::min(start, usage->second);
+                finish = std::max(finish, usage->second);
+            };
+            use(re);
+            iterate_binded(re, [&](MemRequest &, MemRequest & binded) {
+                use(binded);
+            });
+            if (!lifetimeKnown) continue;
+
+            unit = std::max(unit, re._alignment);
+            boxes.push_back({start, finish, static_cast<int64_t>(re._num_elements * re._element_size + re._padding),
+                             static_cast<int64_t>(i)});
+        }
+
+        // boxes are measured in units of the largest alignment, so that any of the solved offsets is aligned
+        for (auto &box : boxes) {
+            box.size = ALIGN(box.size, unit) / unit;
+        }
+        InferenceEngine::MemorySolver solver(boxes);
+        _shared_section_size = static_cast<size_t>(solver.solve()) * unit;
+        for (auto &box : boxes) {
+            _shared_offsets[box.id] = static_cast<size_t>(solver.getOffset(box.id)) * unit;
+        }
+    }
+
     void updateSectionsSizes() {
+        if (_sections_sizes_valid) return;
+        _sections_sizes_valid = true;
+
+        expandBindRequests();
+        solveSharedSection();
+
         // count total size and size of read/write regions
-        _rw_section_size = 0;
+        _rw_section_size = _shared_section_size;
+        _rw_section_size_without_reuse = 0;
         _ro_section_size = 0;
-        for (auto &re : _future_heap) {
+        for (size_t i = 0; i != _future_heap.size(); i++) {
+            auto &re = _future_heap[i];
             auto current = ALIGN(re._num_elements * re._element_size + re._padding, re._alignment);
 #ifdef GNA_HEAP_PROFILER
             std::cout << "chunk: " << " region: " << re._region << ", " <<
@@ -218,12 +313,16 @@ class GNAMemory : public GNAMemRequestsQueue {
             if (re._type == REQUEST_BIND) continue;
 
             if (re._region == REGION_RW) {
-                _rw_section_size += current;
+                _rw_section_size_without_reuse += current;
+                if (_shared_offsets.find(i) == _shared_offsets.end()) {
+                    _rw_section_size += current;
+                }
             } else {
                 _ro_section_size += current;
             }
         }
         _rw_section_size = ALIGN(_rw_section_size, _page_alignment);
+        _rw_section_size_without_reuse = ALIGN(_rw_section_size_without_reuse, _page_alignment);
         _ro_section_size = ALIGN(_ro_section_size, _page_alignment);
     }
 };
@@ -187,6 +187,13 @@ RemoteContext::Ptr ExecutableNetwork::GetContext() const {
     EXEC_NET_CALL_STATEMENT(return _impl->GetContext());
 }
 
+void ExecutableNetwork::UpdateWeights(const CNNNetwork& network) {
+    if (actual) {
+        IE_THROW(NotImplemented);
+    }
+    EXEC_NET_CALL_STATEMENT(_impl->UpdateWeights(network));
+}
+
 bool ExecutableNetwork::operator!() const noexcept {
     return !_impl || !actual;
 }
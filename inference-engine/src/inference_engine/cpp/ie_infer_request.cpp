@@ -369,6 +369,22 @@ std::vector<VariableState> InferRequest::QueryState() {
     return controller;
 }
 
+void InferRequest::SetStateSessions(const std::vector<std::string>& sessionIds) {
+    if (actual) IE_THROW(NotImplemented) << "State sessions are not supported by the legacy infer request";
+
+    INFER_REQ_CALL_STATEMENT(_impl->SetStateSessions(sessionIds);)
+}
+
+void InferRequest::SetStateSession(const std::string& sessionId) {
+    SetStateSessions({sessionId});
+}
+
+void InferRequest::ReleaseStateSession(const std::string& sessionId) {
+    if (actual) IE_THROW(NotImplemented) << "State sessions are not supported by the legacy infer request";
+
+    INFER_REQ_CALL_STATEMENT(_impl->ReleaseStateSession(sessionId);)
+}
+
 bool InferRequest::operator!() const noexcept {
     return !_impl || !actual;
 }
@@ -164,6 +164,14 @@ std::vector<std::shared_ptr<IVariableStateInternal>> IInferRequestInternal::Quer
     IE_THROW(NotImplemented);
 }
 
+void IInferRequestInternal::SetStateSessions(const std::vector<std::string>& sessionIds) {
+    IE_THROW(NotImplemented);
+}
+
+void IInferRequestInternal::ReleaseStateSession(const std::string& sessionId) {
+    IE_THROW(NotImplemented);
+}
+
 void IInferRequestInternal::StartAsync() {
     checkBlobs();
     StartAsyncImpl();
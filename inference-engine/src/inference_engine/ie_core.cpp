@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
@@ -195,6 +196,23 @@ class Core::Impl : public ICore {
 
                 config.erase(it);
             }
+
+            it = config.find(CONFIG_KEY(ENABLE_MMAP));
+            if (it != config.end()) {
+                if (it->second == CONFIG_VALUE(YES)) {
+                    _mapWeights = true;
+                } else if (it->second == CONFIG_VALUE(NO)) {
+                    _mapWeights = false;
+                } else {
+                    IE_THROW() << "Wrong value " << it->second << " for " << CONFIG_KEY(ENABLE_MMAP) << " config key";
+                }
+
+                config.erase(it);
+            }
+        }
+
+        bool isWeightsMappingEnabled() const {
+            return _mapWeights;
         }
 
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
@@ -206,6 +224,7 @@ class Core::Impl : public ICore {
     private:
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
+        std::atomic<bool> _mapWeights{true};
     };
 
     // Core settings (cache config, etc)
@@ -454,7 +473,7 @@ public:
 
     CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_RT, "Core::Impl::ReadNetwork from file");
-        return details::ReadNetwork(modelPath, binPath, extensions);
+        return details::ReadNetwork(modelPath, binPath, extensions, coreConfig.isWeightsMappingEnabled());
     }
 
     CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights) const override {
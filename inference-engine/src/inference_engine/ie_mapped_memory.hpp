@@ -0,0 +1,41 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Platform specific helpers to map files to the memory and to inspect which pages are loaded
+ * @file ie_mapped_memory.hpp
+ */
+
+#pragma once
+
+#include <file_utils.h>
+#include <ie_blob.h>
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Maps the whole file to the memory as a U8 blob. The mapping is copy-on-write, the file pages
+ * are read from the disk on the first access only and the mapping is released with the last blob reference.
+ * @note The file must not be truncated while the blob is alive.
+ * @param path A path to the file
+ * @return The mapped blob or nullptr if the file can't be mapped, e.g. it is empty
+ */
+Blob::Ptr mapFile(const FileUtils::FilePath& path);
+
+/**
+ * @brief Returns the size of the virtual memory page
+ */
+size_t getPageSize();
+
+/**
+ * @brief Returns the number of bytes of the memory range loaded to the physical memory of the current process,
+ * counted with the page granularity
+ * @param data A start of the range
+ * @param size A size of the range in bytes
+ */
+size_t getResidentSize(const void* data, size_t size);
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -4,6 +4,7 @@
 
 #include "ie_network_reader.hpp"
 #include "ie_itt.hpp"
+#include "ie_mapped_memory.hpp"
 
 #include <details/ie_so_pointer.hpp>
 #include <file_utils.h>
@@ -150,7 +151,8 @@ void assertIfIRv7LikeModel(std::istream & modelStream) {
 
 }  // namespace
 
-CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts) {
+CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts,
+                                bool mapWeights) {
     // Register readers if it is needed
     registerReaders();
 
@@ -193,28 +195,32 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
                 }
             }
             if (!bPath.empty()) {
-                // Open weights file
+                // Map weights file, so the constants data is read from the disk on the first access only
+                Blob::Ptr weights = mapWeights ? details::mapFile(FileUtils::toFilePath(bPath)) : nullptr;
+                if (!weights) {
+                    // Open weights file
 #if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-                std::wstring weights_path = FileUtils::multiByteCharToWString(bPath.c_str());
+                    std::wstring weights_path = FileUtils::multiByteCharToWString(bPath.c_str());
 #else
-                std::string weights_path = bPath;
+                    std::string weights_path = bPath;
 #endif
-                std::ifstream binStream;
-                binStream.open(weights_path, std::ios::binary);
-                if (!binStream.is_open())
-                    IE_THROW() << "Weights file " << bPath << " cannot be opened!";
-
-                binStream.seekg(0, std::ios::end);
-                size_t fileSize = binStream.tellg();
-                binStream.seekg(0, std::ios::beg);
-
-                Blob::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
-
-                {
-                    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_RT, "ReadNetworkWeights");
-                    weights->allocate();
-                    binStream.read(weights->buffer(), fileSize);
-                    binStream.close();
+                    std::ifstream binStream;
+                    binStream.open(weights_path, std::ios::binary);
+                    if (!binStream.is_open())
+                        IE_THROW() << "Weights file " << bPath << " cannot be opened!";
+
+                    binStream.seekg(0, std::ios::end);
+                    size_t fileSize = binStream.tellg();
+                    binStream.seekg(0, std::ios::beg);
+
+                    weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
+
+                    {
+                        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_RT, "ReadNetworkWeights");
+                        weights->allocate();
+                        binStream.read(weights->buffer(), fileSize);
+                        binStream.close();
+                    }
                 }
 
                 // read model with weights
@@ -5,6 +5,15 @@
 #include <ie_ngraph_utils.hpp>
 #include "cnn_network_ngraph_impl.hpp"
 #include "ie_itt.hpp"
+#include "ie_mapped_memory.hpp"
+
+#include <ngraph/op/constant.hpp>
+#include <ngraph/op/util/sub_graph_base.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
 
 namespace InferenceEngine {
 namespace details {
@@ -21,5 +30,39 @@ CNNNetwork cloneNetwork(const CNNNetwork& network) {
     IE_THROW() << "InferenceEngine::details::cloneNetwork requires ngraph-based `network` object to clone";
 }
 
+size_t getResidentConstantsSize(const CNNNetwork& network) {
+    auto function = network.getFunction();
+    if (!function)
+        IE_THROW() << "InferenceEngine::details::getResidentConstantsSize requires ngraph-based `network` object";
+
+    // the [first, last) page ranges of the constants data, several constants may share a page or the whole data
+    const size_t pageSize = getPageSize();
+    std::vector<std::pair<uintptr_t, uintptr_t>> pageRanges;
+    std::function<void(const ngraph::Function&)> collect = [&](const ngraph::Function& f) {
+        for (const auto& op : f.get_ops()) {
+            if (auto constant = ngraph::as_type<ngraph::op::v0::Constant>(op.get())) {
+                const auto data = reinterpret_cast<uintptr_t>(constant->get_data_ptr());
+                const size_t size = (ngraph::shape_size(constant->get_shape()) * constant->get_element_type().bitwidth() + 7) / 8;
+                if (data && size)
+                    pageRanges.emplace_back(data / pageSize, (data + size + pageSize - 1) / pageSize);
+            } else if (auto subGraph = dynamic_cast<const ngraph::op::util::SubGraphOp*>(op.get())) {
+                collect(*subGraph->get_function());
+            }
+        }
+    };
+    collect(*function);
+
+    std::sort(pageRanges.begin(), pageRanges.end());
+    size_t residentSize = 0;
+    for (size_t i = 0; i < pageRanges.size();) {
+        auto first = pageRanges[i].first;
+        auto last = pageRanges[i].second;
+        for (i++; i < pageRanges.size() && pageRanges[i].first <= last; i++)
+            last = (std::max)(last, pageRanges[i].second);
+        residentSize += getResidentSize(reinterpret_cast<const void*>(first * pageSize), (last - first) * pageSize);
+    }
+    return residentSize;
+}
+
 }  // namespace details
 }  // namespace InferenceEngine
@@ -0,0 +1,136 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ie_mapped_memory.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+class MappedFileAllocator : public IAllocator {
+public:
+    MappedFileAllocator(void* data, size_t size) : _data(data), _size(size) {}
+
+    ~MappedFileAllocator() {
+        munmap(_data, _size);
+    }
+
+    void* lock(void* handle, LockOp) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        return size <= _size ? _data : nullptr;
+    }
+
+    bool free(void*) noexcept override {
+        return true;
+    }
+
+private:
+    void* _data;
+    size_t _size;
+};
+
+#ifdef __linux__
+// reads the flags of the pages from the page map, which contains one 64 bit entry per page of the process
+bool countPresentPages(uintptr_t firstPage, uintptr_t lastPage, size_t& count) {
+    const int fd = open("/proc/self/pagemap", O_RDONLY);
+    if (fd == -1)
+        return false;
+
+    std::vector<uint64_t> entries((std::min)(lastPage - firstPage, uintptr_t(4096)));
+    count = 0;
+    for (uintptr_t page = firstPage; page < lastPage;) {
+        const size_t entriesNum = (std::min)(uintptr_t(entries.size()), lastPage - page);
+        const ssize_t bytesRead = pread(fd, entries.data(), entriesNum * sizeof(uint64_t), page * sizeof(uint64_t));
+        if (bytesRead <= 0) {
+            close(fd);
+            return false;
+        }
+
+        const size_t entriesRead = bytesRead / sizeof(uint64_t);
+        // bit 63 is set for the present pages and bit 62 for the swapped ones
+        count += std::count_if(entries.begin(), entries.begin() + entriesRead, [](uint64_t entry) {
+            return (entry >> 62) != 0;
+        });
+        page += entriesRead;
+    }
+
+    close(fd);
+    return true;
+}
+#endif
+
+}  // namespace
+
+Blob::Ptr mapFile(const FileUtils::FilePath& path) {
+    const int fd = open(FileUtils::fromFilePath(path).c_str(), O_RDONLY);
+    if (fd == -1)
+        return nullptr;
+
+    struct stat fileStat = {};
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+        close(fd);
+        return nullptr;
+    }
+
+    const size_t size = static_cast<size_t>(fileStat.st_size);
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    // the mapping keeps the file referenced
+    close(fd);
+    if (data == MAP_FAILED)
+        return nullptr;
+
+    auto allocator = std::make_shared<MappedFileAllocator>(data, size);
+    auto blob = make_shared_blob<uint8_t>({Precision::U8, {size}, C}, allocator);
+    blob->allocate();
+    return blob;
+}
+
+size_t getPageSize() {
+    static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return pageSize;
+}
+
+size_t getResidentSize(const void* data, size_t size) {
+    if (size == 0)
+        return 0;
+
+    const size_t pageSize = getPageSize();
+    const uintptr_t firstPage = reinterpret_cast<uintptr_t>(data) / pageSize;
+    const uintptr_t lastPage = (reinterpret_cast<uintptr_t>(data) + size + pageSize - 1) / pageSize;
+
+    size_t pagesNum = 0;
+#ifdef __linux__
+    // unlike mincore() the page map doesn't count the pages cached by the system, but not touched by the process
+    if (countPresentPages(firstPage, lastPage, pagesNum))
+        return pagesNum * pageSize;
+    using ResidencyFlag = unsigned char;
+#else
+    using ResidencyFlag = char;
+#endif
+
+    std::vector<ResidencyFlag> residency(lastPage - firstPage);
+    if (mincore(reinterpret_cast<void*>(firstPage * pageSize), residency.size() * pageSize, residency.data()) != 0)
+        return 0;
+    pagesNum = std::count_if(residency.begin(), residency.end(), [](ResidencyFlag flag) { return (flag & 1) != 0; });
+    return pagesNum * pageSize;
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
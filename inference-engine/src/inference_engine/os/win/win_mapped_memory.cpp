@@ -0,0 +1,120 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef NOMINMAX
+# define NOMINMAX
+#endif
+
+// QueryWorkingSetEx is taken from kernel32, so psapi.lib isn't needed
+#ifndef PSAPI_VERSION
+# define PSAPI_VERSION 2
+#endif
+
+#include <windows.h>
+#include <psapi.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ie_mapped_memory.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+class MappedFileAllocator : public IAllocator {
+public:
+    MappedFileAllocator(void* data, size_t size) : _data(data), _size(size) {}
+
+    ~MappedFileAllocator() {
+        UnmapViewOfFile(_data);
+    }
+
+    void* lock(void* handle, LockOp) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        return size <= _size ? _data : nullptr;
+    }
+
+    bool free(void*) noexcept override {
+        return true;
+    }
+
+private:
+    void* _data;
+    size_t _size;
+};
+
+}  // namespace
+
+Blob::Ptr mapFile(const FileUtils::FilePath& path) {
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#endif
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    LARGE_INTEGER fileSize = {};
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0) {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    // the view keeps both the mapping and the file referenced
+    HANDLE mapping = CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping)
+        return nullptr;
+    void* data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!data)
+        return nullptr;
+
+    const size_t size = static_cast<size_t>(fileSize.QuadPart);
+    auto allocator = std::make_shared<MappedFileAllocator>(data, size);
+    auto blob = make_shared_blob<uint8_t>({Precision::U8, {size}, C}, allocator);
+    blob->allocate();
+    return blob;
+}
+
+size_t getPageSize() {
+    static const size_t pageSize = [] {
+        SYSTEM_INFO systemInfo;
+        GetSystemInfo(&systemInfo);
+        return static_cast<size_t>(systemInfo.dwPageSize);
+    }();
+    return pageSize;
+}
+
+size_t getResidentSize(const void* data, size_t size) {
+    if (size == 0)
+        return 0;
+
+    const size_t pageSize = getPageSize();
+    const uintptr_t firstPage = reinterpret_cast<uintptr_t>(data) / pageSize;
+    const uintptr_t lastPage = (reinterpret_cast<uintptr_t>(data) + size + pageSize - 1) / pageSize;
+
+    std::vector<PSAPI_WORKING_SET_EX_INFORMATION> pages(lastPage - firstPage);
+    for (size_t i = 0; i < pages.size(); i++)
+        pages[i].VirtualAddress = reinterpret_cast<PVOID>((firstPage + i) * pageSize);
+    if (!QueryWorkingSetEx(GetCurrentProcess(), pages.data(), static_cast<DWORD>(pages.size() * sizeof(pages[0]))))
+        return 0;
+
+    const size_t pagesNum = std::count_if(pages.begin(), pages.end(), [](const PSAPI_WORKING_SET_EX_INFORMATION& page) {
+        return page.VirtualAttributes.Valid != 0;
+    });
+    return pagesNum * pageSize;
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -0,0 +1,41 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <ngraph/ngraph.hpp>
+#include "layer_transformation.hpp"
+
+namespace ngraph {
+namespace pass {
+namespace low_precision {
+
+/**
+ * @brief RecurrentCellTransformation quantizes LSTMSequence and GRUSequence:
+ * weights FakeQuantize operations are decomposed to I8 constants with per output channel dequantization and
+ * dequantization operations on the layer input are kept in front of the cell, both are executed by the cell itself.
+ */
+class TRANSFORMATIONS_API RecurrentCellTransformation : public LayerTransformation {
+public:
+    RecurrentCellTransformation(const Params& params) : LayerTransformation(params) {}
+    void registerMatcherIn(GraphRewrite& pass, TransformationContext& context) const override;
+    bool transform(TransformationContext& context, ngraph::pattern::Matcher &m) const override;
+    bool canBeTransformed(const TransformationContext& context, std::shared_ptr<Node> layer) const override;
+    bool isQuantized(std::shared_ptr<Node> layer) const noexcept override;
+    bool isPrecisionPreserved(std::shared_ptr<Node> layer) const noexcept override;
+
+    // returns true if the dequantization operation is on the layer input or weights of a quantized recurrent cell:
+    // such operations are executed by the cell and must not be fused by cleanup transformations
+    static bool isDequantizationOnCell(
+        const std::shared_ptr<Node>& dequantizationOperation,
+        const ILayerTransformationsManager* layerTransformationsManager);
+
+private:
+    static size_t getWeightsIndex(const std::shared_ptr<Node>& layer);
+};
+
+} // namespace low_precision
+} // namespace pass
+} // namespace ngraph
@@ -10,6 +10,7 @@
 
 #include "low_precision/common/ie_lpt_exception.hpp"
 #include "low_precision/network_helper.hpp"
+#include "low_precision/recurrent_cell.hpp"
 
 namespace ngraph {
 namespace pass {
@@ -94,6 +95,10 @@ bool FuseConvertTransformation::transform(TransformationContext& context, ngraph
 }
 
 bool FuseConvertTransformation::canBeTransformed(const TransformationContext& context, std::shared_ptr<Node> op) const {
+    if (RecurrentCellTransformation::isDequantizationOnCell(op, layerTransformationsManager)) {
+        return false;
+    }
+
     const auto convert = as_type_ptr<opset1::Convert>(op->get_input_node_shared_ptr(0));
     // issue #40395
     if (convert == nullptr) {
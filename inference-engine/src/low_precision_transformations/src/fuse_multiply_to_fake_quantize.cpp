@@ -7,6 +7,7 @@
 #include <ngraph/ngraph.hpp>
 #include "low_precision/fake_quantize.hpp"
 #include "low_precision/network_helper.hpp"
+#include "low_precision/recurrent_cell.hpp"
 
 namespace ngraph {
 namespace pass {
@@ -70,6 +71,10 @@ bool FuseMultiplyToFakeQuantizeTransformation::transform(TransformationContext&
 }
 
 bool FuseMultiplyToFakeQuantizeTransformation::canBeTransformed(const TransformationContext& context, std::shared_ptr<Node> operation) const {
+    if (RecurrentCellTransformation::isDequantizationOnCell(operation, layerTransformationsManager)) {
+        return false;
+    }
+
     if (!is_type<opset1::Constant>(operation->get_input_node_shared_ptr(1))) {
         return false;
     }
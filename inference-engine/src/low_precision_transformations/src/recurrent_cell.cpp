@@ -0,0 +1,288 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "low_precision/recurrent_cell.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ngraph/opsets/opset5.hpp>
+#include <ngraph/variant.hpp>
+
+#include "low_precision/common/ie_lpt_exception.hpp"
+#include "low_precision/network_helper.hpp"
+
+using namespace ngraph;
+using namespace ngraph::pass;
+using namespace ngraph::pass::low_precision;
+
+namespace recurrent_cell {
+
+// weights have [num_directions, gates_count * hidden_size, input_size] shape, dequantization is supported
+// per tensor or per output channel only
+bool isPerOutputChannel(const Shape& shape, const size_t outputChannels) {
+    if (shape_size(shape) == 1ul) {
+        return true;
+    }
+    return (shape.size() >= 2ul) && (shape_size(shape) == outputChannels) &&
+        (shape[shape.size() - 2ul] == outputChannels) && (shape.back() == 1ul);
+}
+
+float getScalarValue(const std::shared_ptr<opset1::Constant>& constant, const float defaultValue) {
+    return constant == nullptr ? defaultValue : constant->cast_vector<float>()[0];
+}
+
+// returns per output channel dequantization scales of W or R, empty vector if the weights are not quantized
+std::vector<float> getWeightsScales(const std::shared_ptr<Node>& layer, const size_t index, const size_t channels) {
+    std::vector<float> scales;
+    const auto fakeQuantize = as_type_ptr<opset1::FakeQuantize>(layer->get_input_node_shared_ptr(index));
+    if (fakeQuantize != nullptr) {
+        // FakeQuantize is decomposed to I8 without zero point: scale = (output high - output low) / (levels - 1)
+        const QuantizationDetails details = QuantizationDetails::getDetails(fakeQuantize);
+        if (details.outputLowValues.empty() || (details.outputLowValues.size() != details.outputHighValues.size())) {
+            return {};
+        }
+        for (size_t oc = 0ul; oc < channels; ++oc) {
+            const size_t i = details.outputLowValues.size() == 1ul ? 0ul : oc;
+            scales.push_back((details.outputHighValues[i] - details.outputLowValues[i]) / (details.levels - 1ul));
+        }
+        return scales;
+    }
+
+    const FakeQuantizeDequantization dequantization = NetworkHelper::getDequantization(layer, index);
+    if (dequantization.multiplyConstant == nullptr) {
+        return {};
+    }
+    const std::vector<float> values = dequantization.multiplyConstant->cast_vector<float>();
+    for (size_t oc = 0ul; oc < channels; ++oc) {
+        scales.push_back(values.size() == 1ul ? values[0] : values[oc]);
+    }
+    return scales;
+}
+
+} // namespace recurrent_cell
+
+size_t RecurrentCellTransformation::getWeightsIndex(const std::shared_ptr<Node>& layer) {
+    if (is_type<opset5::LSTMSequence>(layer) || is_type<op::v0::LSTMSequence>(layer)) {
+        return 4ul;
+    }
+    if (is_type<opset5::GRUSequence>(layer)) {
+        return 3ul;
+    }
+    return 0ul;
+}
+
+bool RecurrentCellTransformation::isDequantizationOnCell(
+    const std::shared_ptr<Node>& dequantizationOperation,
+    const ILayerTransformationsManager* layerTransformationsManager) {
+    if (layerTransformationsManager == nullptr) {
+        return false;
+    }
+
+    std::shared_ptr<Node> operation = dequantizationOperation;
+    // Convert -> Subtract -> Multiply -> cell
+    for (size_t i = 0ul; i < 3ul; ++i) {
+        const auto targetInputs = operation->output(0).get_target_inputs();
+        if (targetInputs.size() != 1ul) {
+            return false;
+        }
+
+        const auto input = *targetInputs.begin();
+        const auto consumer = input.get_node()->shared_from_this();
+        const size_t weightsIndex = getWeightsIndex(consumer);
+        if (weightsIndex != 0ul) {
+            const size_t index = input.get_index();
+            return ((index == 0ul) || (index == weightsIndex) || (index == weightsIndex + 1ul)) &&
+                layerTransformationsManager->isQuantized(consumer);
+        }
+
+        if (!is_type<opset1::Convert>(consumer) && !is_type<opset1::Subtract>(consumer) && !is_type<opset1::Multiply>(consumer)) {
+            return false;
+        }
+        operation = consumer;
+    }
+    return false;
+}
+
+void RecurrentCellTransformation::registerMatcherIn(GraphRewrite& pass, TransformationContext& context) const {
+    addSingleNodePattern<opset5::LSTMSequence>(pass, context);
+    addSingleNodePattern<opset5::GRUSequence>(pass, context);
+}
+
+bool RecurrentCellTransformation::transform(TransformationContext& context, ngraph::pattern::Matcher &m) const {
+    const std::shared_ptr<Node> layer = m.get_match_root();
+    const size_t weightsIndex = getWeightsIndex(layer);
+    if (weightsIndex == 0ul) {
+        return false;
+    }
+
+    if (!canBeTransformed(context, layer)) {
+        // FakeQuantize decomposition doesn't fold FakeQuantize on weights of the handled cell: fold it here
+        bool folded = false;
+        for (const size_t index : { weightsIndex, weightsIndex + 1ul }) {
+            const auto fakeQuantize = as_type_ptr<opset1::FakeQuantize>(layer->get_input_node_shared_ptr(index));
+            if ((fakeQuantize == nullptr) || !is_type<opset1::Constant>(fakeQuantize->get_input_node_ptr(0))) {
+                continue;
+            }
+
+            const std::shared_ptr<Node> resultConstant = NetworkHelper::fold_fake_quantize(fakeQuantize);
+            if (is_type<opset1::Constant>(resultConstant)) {
+                replace_node(fakeQuantize, resultConstant);
+                folded = true;
+            }
+        }
+        return folded;
+    }
+
+    for (const size_t index : { weightsIndex, weightsIndex + 1ul }) {
+        const auto fakeQuantize = as_type_ptr<opset1::FakeQuantize>(layer->get_input_node_shared_ptr(index));
+        if (fakeQuantize == nullptr) {
+            continue;
+        }
+
+        const QuantizationDetails quantizationDetails = QuantizationDetails::getDetails(fakeQuantize);
+        const DataPrecision dataPrecision = getDataPrecision(fakeQuantize, quantizationDetails, true);
+        NetworkHelper::decomposeFakeQuantize(
+            fakeQuantize,
+            dataPrecision.precision,
+            dataPrecision.min,
+            dataPrecision.max,
+            dataPrecision.hasZeroPoint,
+            updatePrecisions,
+            deqPrecision,
+            1ul);
+
+        const FakeQuantizeDequantization dequantization = NetworkHelper::getDequantization(layer, index);
+        if (!is_type<opset1::Constant>(dequantization.data.get_node())) {
+            THROW_IE_LPT_EXCEPTION(*fakeQuantize) << "FakeQuantize on weights was not folded to constant";
+        }
+
+        // low precision weights and their dequantization are executed by the cell
+        if (dequantization.convert != nullptr) {
+            auto& rt = dequantization.convert->get_rt_info();
+            rt["DISABLED_CONSTANT_FOLDING"] = std::make_shared<ngraph::VariantWrapper<std::string>>("");
+        }
+    }
+
+    return true;
+}
+
+bool RecurrentCellTransformation::canBeTransformed(const TransformationContext& context, std::shared_ptr<Node> layer) const {
+    const size_t weightsIndex = getWeightsIndex(layer);
+    if ((weightsIndex == 0ul) || !isQuantized(layer)) {
+        return false;
+    }
+
+    // the layer input dequantization is executed by the cell: only per tensor values are supported
+    const FakeQuantizeDequantization dequantization = NetworkHelper::getDequantization(layer, 0ul);
+    if (dequantization.empty() || (dequantization.multiply == nullptr)) {
+        return false;
+    }
+
+    if (updatePrecisions && (std::find(
+        precisionsOnActivations.begin(),
+        precisionsOnActivations.end(),
+        dequantization.data.get_element_type()) == precisionsOnActivations.end())) {
+        return false;
+    }
+
+    if (!NetworkHelper::isScalarLike(dequantization.multiplyConstant) ||
+        ((dequantization.subtract != nullptr) && !NetworkHelper::isScalarLike(dequantization.subtractConstant))) {
+        return false;
+    }
+
+    // the cell quantizes the hidden state with the layer input quantization parameters, while the hidden state values
+    // produced by the cell are in [-1, 1] interval: the hidden state input has to be quantized in the same way and
+    // the quantization interval has to cover the hidden state values
+    const FakeQuantizeDequantization stateDequantization = NetworkHelper::getDequantization(layer, 1ul);
+    if (stateDequantization.empty() || (stateDequantization.multiply == nullptr) ||
+        (stateDequantization.data.get_element_type() != dequantization.data.get_element_type()) ||
+        !NetworkHelper::isScalarLike(stateDequantization.multiplyConstant) ||
+        ((stateDequantization.subtract != nullptr) && !NetworkHelper::isScalarLike(stateDequantization.subtractConstant))) {
+        return false;
+    }
+
+    const float scale = recurrent_cell::getScalarValue(dequantization.multiplyConstant, 1.f);
+    const float shift = recurrent_cell::getScalarValue(dequantization.subtractConstant, 0.f);
+    if ((scale != recurrent_cell::getScalarValue(stateDequantization.multiplyConstant, 1.f)) ||
+        (shift != recurrent_cell::getScalarValue(stateDequantization.subtractConstant, 0.f))) {
+        return false;
+    }
+
+    const element::Type dataPrecision = dequantization.data.get_element_type();
+    if (((DataPrecision::getMinValue(dataPrecision, 256ul) - shift) * scale > -1.f) ||
+        ((DataPrecision::getMaxValue(dataPrecision, 256ul) - shift) * scale < 1.f)) {
+        return false;
+    }
+
+    const Shape weightsShape = layer->get_input_shape(weightsIndex);
+    if ((weightsShape.size() != 3ul) || (weightsShape[0] != 1ul)) {
+        return false;
+    }
+
+    const size_t outputChannels = weightsShape[1];
+    for (const size_t index : { weightsIndex, weightsIndex + 1ul }) {
+        const auto fakeQuantize = as_type_ptr<opset1::FakeQuantize>(layer->get_input_node_shared_ptr(index));
+        if (fakeQuantize == nullptr) {
+            const FakeQuantizeDequantization weightsDequantization = NetworkHelper::getDequantization(layer, index);
+            if ((weightsDequantization.subtract != nullptr) ||
+                !recurrent_cell::isPerOutputChannel(weightsDequantization.multiplyConstant->get_shape(), outputChannels)) {
+                return false;
+            }
+            continue;
+        }
+
+        if (!is_type<opset1::Constant>(fakeQuantize->get_input_node_ptr(0)) ||
+            !QuantizationDetails::isSupportedLevel(fakeQuantize->get_levels())) {
+            return false;
+        }
+
+        for (size_t i = 1ul; i < fakeQuantize->get_input_size(); ++i) {
+            if (!recurrent_cell::isPerOutputChannel(fakeQuantize->get_input_shape(i), outputChannels)) {
+                return false;
+            }
+        }
+
+        // zero point is not supported
+        const DataPrecision dataPrecision = getDataPrecision(fakeQuantize, QuantizationDetails::getDetails(fakeQuantize), true);
+        if ((dataPrecision.precision != element::i8) || dataPrecision.hasZeroPoint) {
+            return false;
+        }
+    }
+
+    // the cell applies the same per output channel scale to W and R
+    const std::vector<float> wScales = recurrent_cell::getWeightsScales(layer, weightsIndex, outputChannels);
+    if (wScales.empty() || (wScales != recurrent_cell::getWeightsScales(layer, weightsIndex + 1ul, outputChannels))) {
+        return false;
+    }
+
+    return true;
+}
+
+bool RecurrentCellTransformation::isQuantized(std::shared_ptr<Node> layer) const noexcept {
+    const size_t weightsIndex = getWeightsIndex(layer);
+    if (weightsIndex == 0ul) {
+        return false;
+    }
+
+    for (const size_t index : { weightsIndex, weightsIndex + 1ul }) {
+        const auto parent = layer->get_input_node_shared_ptr(index);
+        if (is_type<opset1::FakeQuantize>(parent) && NetworkHelper::isConstantPath(parent)) {
+            continue;
+        }
+
+        const FakeQuantizeDequantization dequantization = NetworkHelper::getDequantization(layer, index);
+        if (dequantization.empty() || (dequantization.multiply == nullptr) ||
+            !is_type<opset1::Constant>(dequantization.data.get_node())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool RecurrentCellTransformation::isPrecisionPreserved(std::shared_ptr<Node> layer) const noexcept {
+    return false;
+}
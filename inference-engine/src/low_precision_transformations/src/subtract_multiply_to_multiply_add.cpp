@@ -10,6 +10,7 @@
 
 #include "low_precision/common/ie_lpt_exception.hpp"
 #include "low_precision/network_helper.hpp"
+#include "low_precision/recurrent_cell.hpp"
 #include "low_precision/common/dequantization_op.hpp"
 
 namespace ngraph {
@@ -137,6 +138,10 @@ bool SubtractMultiplyToMultiplyAddTransformation::transform(TransformationContex
 }
 
 bool SubtractMultiplyToMultiplyAddTransformation::canBeTransformed(const TransformationContext& context, std::shared_ptr<Node> op) const {
+    if (RecurrentCellTransformation::isDequantizationOnCell(op, layerTransformationsManager)) {
+        return false;
+    }
+
     FakeQuantizeDequantization dequantization = get(op);
     if (dequantization.empty() || (dequantization.multiply == nullptr)) {
         return false;
@@ -14,6 +14,7 @@
 #include "ie_system_conf.h"
 
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <cpu/cpu_config.hpp>
 
 namespace MKLDNNPlugin {
 
@@ -111,6 +112,32 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_ENFORCE_BF16
                     << ". Expected only YES/NO";
             }
+        } else if (key == CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE) {
+            float val_f = -1.f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE
+                                    << ". Expected only float numbers";
+            }
+            if (val_f < 0.f || val_f > 1.f)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE
+                                    << ". Expected only values in the [0, 1] range";
+            fcSparseWeiDecompressionRate = val_f;
+        } else if (key == CPUConfigParams::KEY_CPU_INT8_WEIGHTS_DECOMPRESSION_MAX_ROWS ||
+                   key == CPUConfigParams::KEY_CPU_FP16_WEIGHTS_DECOMPRESSION_MAX_ROWS) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << key << ". Expected only integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << key << ". Expected only non-negative numbers";
+            if (key == CPUConfigParams::KEY_CPU_INT8_WEIGHTS_DECOMPRESSION_MAX_ROWS)
+                fcInt8WeiDecompressionMaxRows = val_i;
+            else
+                fcFp16WeiDecompressionMaxRows = val_i;
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
@@ -158,6 +185,9 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO });
+        _config.insert({ CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE, std::to_string(fcSparseWeiDecompressionRate) });
+        _config.insert({ CPUConfigParams::KEY_CPU_INT8_WEIGHTS_DECOMPRESSION_MAX_ROWS, std::to_string(fcInt8WeiDecompressionMaxRows) });
+        _config.insert({ CPUConfigParams::KEY_CPU_FP16_WEIGHTS_DECOMPRESSION_MAX_ROWS, std::to_string(fcFp16WeiDecompressionMaxRows) });
     }
 }
 
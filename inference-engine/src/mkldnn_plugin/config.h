@@ -25,6 +25,9 @@ struct Config {
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
     int batchLimit = 0;
+    float fcSparseWeiDecompressionRate = 1.0f;
+    int fcInt8WeiDecompressionMaxRows = 16;
+    int fcFp16WeiDecompressionMaxRows = 0;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
@@ -10,7 +10,11 @@
 #include "mkldnn_infer_request.h"
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
+#include "mkldnn_plugin.h"
 #include "nodes/mkldnn_memory_node.hpp"
+#include "nodes/common/cpu_memcpy.h"
+#include <blob_factory.hpp>
+#include <ie_ngraph_utils.hpp>
 #include <threading/ie_executor_manager.hpp>
 
 #include <threading/ie_cpu_streams_executor.hpp>
@@ -20,6 +24,7 @@
 #include <utility>
 #include <cstring>
 #include <ngraph/opsets/opset1.hpp>
+#include <ngraph/op/util/sub_graph_base.hpp>
 #include <transformations/utils/utils.hpp>
 
 using namespace MKLDNNPlugin;
@@ -40,7 +45,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
-    _numaNodesWeights(numaNodesWeights),
+    _numaNodesWeights(&numaNodesWeights),
         _network(network) {
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -87,22 +92,24 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
     // producer as storage for tensor to keep it between infer calls.
-    if (_graphs.size() == 1) {
-        for (auto &node : GetGraph()._graph.GetNodes()) {
-            if (node->getType() == MemoryInput) {
-                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-                auto state_store = memoryNode->getStore();
-                auto state_name = memoryNode->getId();
-
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
+    std::vector<std::pair<std::string, TensorDesc>> stateVariables;
+    for (auto &node : GetGraph()._graph.GetNodes()) {
+        if (node->getType() == MemoryInput) {
+            auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+            auto state_store = memoryNode->getStore();
+            auto state_name = memoryNode->getId();
 
+            // Remove suffix with pair ID. Internal information.
+            auto suffix_idx = state_name.find("/id=");
+            if (suffix_idx != std::string::npos)
+                state_name = state_name.substr(0, suffix_idx);
+
+            if (_graphs.size() == 1)
                 memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
-            }
+            stateVariables.emplace_back(state_name, MKLDNNMemoryDesc(state_store->GetDescriptor()));
         }
     }
+    stateStore = std::make_shared<MKLDNNVariableStateStore>(stateVariables);
 }
 
 MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
@@ -122,7 +129,8 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
-                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
+                graphLock._graph._numaNodeId = numaNodeId;
+                graphLock._graph.CreateGraph(_network, extensionManager, (*_numaNodesWeights)[numaNodeId]);
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -163,6 +171,167 @@ InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetExecGraphInfo() {
     return GetGraph()._graph.dump();
 }
 
+static size_t getDataSize(const ngraph::op::Constant& constOp) {
+    return (ngraph::shape_size(constOp.get_shape()) * constOp.get_element_type().bitwidth() + 7) / 8;
+}
+
+// the body of a sub-graph operation is compiled into a separate graph, which constants aren't updated
+static bool haveSameConstants(const ngraph::Function& lhs, const ngraph::Function& rhs) {
+    const auto lhsOps = lhs.get_ordered_ops();
+    const auto rhsOps = rhs.get_ordered_ops();
+    if (lhsOps.size() != rhsOps.size())
+        return false;
+
+    for (size_t i = 0; i < lhsOps.size(); i++) {
+        auto lhsConstOp = ngraph::as_type_ptr<ngraph::op::Constant>(lhsOps[i]);
+        auto rhsConstOp = ngraph::as_type_ptr<ngraph::op::Constant>(rhsOps[i]);
+        if (!lhsConstOp != !rhsConstOp)
+            return false;
+        if (lhsConstOp && (getDataSize(*lhsConstOp) != getDataSize(*rhsConstOp) ||
+                           std::memcmp(lhsConstOp->get_data_ptr(), rhsConstOp->get_data_ptr(), getDataSize(*lhsConstOp)) != 0))
+            return false;
+
+        auto lhsSubGraphOp = std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(lhsOps[i]);
+        auto rhsSubGraphOp = std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(rhsOps[i]);
+        if (lhsSubGraphOp && rhsSubGraphOp && !haveSameConstants(*lhsSubGraphOp->get_function(), *rhsSubGraphOp->get_function()))
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNExecNetwork::UpdateWeights(const InferenceEngine::CNNNetwork &network) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::UpdateWeights");
+    std::lock_guard<std::mutex> weightsLock{_weightsMutex};
+
+    if (network.getFunction() == nullptr) {
+        IE_THROW() << "CPU plug-in doesn't support not ngraph-based model!";
+    }
+
+    // the constants must be transformed the same way as on the network loading, so the inputs configuration
+    // affecting the transformations is taken from the loaded network
+    CNNNetwork clonedNetwork = InferenceEngine::details::cloneNetwork(network);
+    for (const auto& input : clonedNetwork.getInputsInfo()) {
+        auto loadedInput = _networkInputs.find(input.first);
+        if (loadedInput == _networkInputs.end())
+            IE_THROW() << "Network topology doesn't match the loaded network: unknown input " << input.first;
+        input.second->setPrecision(loadedInput->second->getPrecision());
+        input.second->setLayout(loadedInput->second->getLayout());
+        input.second->getPreProcess() = loadedInput->second->getPreProcess();
+    }
+    Config cfg;
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        cfg = _cfg;
+    }
+    Engine::Transformation(clonedNetwork, cfg);
+
+    const auto loadedOps = _network.getFunction()->get_ordered_ops();
+    const auto ops = clonedNetwork.getFunction()->get_ordered_ops();
+    if (loadedOps.size() != ops.size())
+        IE_THROW() << "Network topology doesn't match the loaded network";
+
+    std::unordered_map<ngraph::Node*, size_t> loadedOpIndices, opIndices;
+    for (size_t i = 0; i < ops.size(); i++) {
+        loadedOpIndices[loadedOps[i].get()] = i;
+        opIndices[ops[i].get()] = i;
+    }
+
+    std::map<std::string, Blob::Ptr> constants;
+    for (size_t i = 0; i < ops.size(); i++) {
+        const auto& loadedOp = loadedOps[i];
+        const auto& op = ops[i];
+        bool sameOp = loadedOp->get_type_info() == op->get_type_info() &&
+                      loadedOp->get_input_size() == op->get_input_size() &&
+                      loadedOp->get_output_size() == op->get_output_size();
+        for (size_t port = 0; sameOp && port < op->get_input_size(); port++) {
+            sameOp = loadedOpIndices[loadedOp->get_input_node_ptr(port)] == opIndices[op->get_input_node_ptr(port)];
+        }
+        for (size_t port = 0; sameOp && port < op->get_output_size(); port++) {
+            sameOp = loadedOp->get_output_element_type(port) == op->get_output_element_type(port) &&
+                     loadedOp->get_output_partial_shape(port) == op->get_output_partial_shape(port);
+        }
+        if (!sameOp)
+            IE_THROW() << "Network topology doesn't match the loaded network at operation " << op->get_friendly_name();
+
+        auto loadedSubGraphOp = std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(loadedOp);
+        if (loadedSubGraphOp && !haveSameConstants(*loadedSubGraphOp->get_function(),
+                                                   *std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(op)->get_function()))
+            IE_THROW(NotImplemented) << "Constants of the body of operation " << op->get_friendly_name() << " can't be updated";
+
+        auto loadedConstOp = ngraph::as_type_ptr<ngraph::op::Constant>(loadedOp);
+        if (!loadedConstOp)
+            continue;
+
+        auto constOp = ngraph::as_type_ptr<ngraph::op::Constant>(op);
+        const auto& name = loadedConstOp->get_friendly_name();
+        auto updated = _updatedConstants.find(name);
+        const void* currentData = updated != _updatedConstants.end() ? updated->second->cbuffer().as<const void*>()
+                                                                      : loadedConstOp->get_data_ptr();
+        const size_t dataSize = getDataSize(*constOp);
+        if (std::memcmp(currentData, constOp->get_data_ptr(), dataSize) == 0)
+            continue;
+
+        if (constOp->get_element_type().bitwidth() < 8)
+            IE_THROW(NotImplemented) << "Constant " << name << " of type " << constOp->get_element_type() << " can't be updated";
+
+        // the data is copied, so that the network with the new weights may be released
+        TensorDesc desc(details::convertPrecision(constOp->get_element_type()), {ngraph::shape_size(constOp->get_shape())}, Layout::C);
+        auto blob = make_blob_with_precision(desc);
+        blob->allocate();
+        cpu_memcpy(blob->buffer(), constOp->get_data_ptr(), dataSize);
+        constants[name] = blob;
+    }
+
+    if (constants.empty())
+        return;
+
+    // the graphs are identical, but all of them are checked before any of them is changed
+    for (auto& graph : _graphs) {
+        auto graphLock = Graph::Lock(graph);
+        if (graphLock._graph.IsReady())
+            graphLock._graph.ValidateConstants(constants);
+    }
+
+    // the constant outputs shared with the other networks through the plugin weights cache are copied to the own
+    // cache of the network, the copies are allocated by the streams of the graphs to keep their NUMA node placement
+    if (!_ownNumaNodesWeights)
+        _ownNumaNodesWeights.reset(new NumaNodesWeights);
+    if (cfg.streamExecutorConfig._streams != 0) {
+        std::vector<Task> tasks(_graphs.size(), [&] {
+            int streamId = 0;
+            auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+            if (nullptr != streamsExecutor)
+                streamId = streamsExecutor->GetStreamId();
+            auto graphLock = Graph::Lock(_graphs[streamId % _graphs.size()]);
+            if (graphLock._graph.IsReady())
+                graphLock._graph.MoveConstantsToCache(constants, (*_ownNumaNodesWeights)[graphLock._graph._numaNodeId]);
+        });
+        _taskExecutor->runAndWait(tasks);
+    }
+
+    // all the graphs are locked, since the constant outputs may be shared between them via the weights cache,
+    // the requests wait only for the constant nodes execution
+    std::vector<Graph::Lock> graphLocks;
+    graphLocks.reserve(_graphs.size());
+    for (auto& graph : _graphs)
+        graphLocks.emplace_back(graph);
+
+    std::unordered_set<MKLDNNWeightsSharing*> updatedCaches;
+    for (auto& graphLock : graphLocks) {
+        auto& graph = graphLock._graph;
+        if (!graph.IsReady())
+            continue;
+
+        // the graphs not reached by the streams above are moved by the calling thread
+        const auto& cache = (*_ownNumaNodesWeights)[graph._numaNodeId];
+        graph.MoveConstantsToCache(constants, cache);
+        graph.UpdateConstants(constants, updatedCaches.insert(cache.get()).second);
+    }
+
+    for (const auto& constant : constants)
+        _updatedConstants[constant.first] = constant.second;
+}
+
 Parameter MKLDNNExecNetwork::GetConfig(const std::string &name) const {
     if (_graphs.size() == 0)
         IE_THROW() << "No graph was found";
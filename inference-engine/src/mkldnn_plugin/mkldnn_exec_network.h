@@ -8,6 +8,7 @@
 
 #include "mkldnn_graph.h"
 #include "mkldnn_extension_mngr.h"
+#include "mkldnn_memory_state.h"
 #include <threading/ie_thread_local.hpp>
 
 #include <vector>
@@ -41,6 +42,8 @@ public:
 
     InferenceEngine::CNNNetwork GetExecGraphInfo() override;
 
+    void UpdateWeights(const InferenceEngine::CNNNetwork &network) override;
+
     INFERENCE_ENGINE_DEPRECATED("Use InferRequest::QueryState instead")
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
@@ -48,6 +51,7 @@ protected:
     friend class MKLDNNInferRequest;
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
+    MKLDNNVariableStateStore::Ptr               stateStore;
     const InferenceEngine::CNNNetwork           _network;
     std::mutex                                  _cfgMutex;
     Config                                      _cfg;
@@ -55,6 +59,7 @@ protected:
     std::string                                 _name;
     struct Graph : public MKLDNNGraph {
         std::mutex  _mutex;
+        int         _numaNodeId = 0;
         struct Lock : public std::unique_lock<std::mutex> {
             explicit Lock(Graph& graph) : std::unique_lock<std::mutex>(graph._mutex), _graph(graph) {}
             Graph&                          _graph;
@@ -62,7 +67,13 @@ protected:
     };
     // WARNING: Do not use _graphs directly.
     std::deque<Graph>                           _graphs;
-    NumaNodesWeights&                           _numaNodesWeights;
+    // the weights cache of the plugin shared with the other networks
+    NumaNodesWeights*                           _numaNodesWeights;
+    // the copies of the constant outputs updated by UpdateWeights(), they aren't shared with the other networks
+    std::unique_ptr<NumaNodesWeights>           _ownNumaNodesWeights;
+    std::mutex                                  _weightsMutex;
+    // the current data of the constants replaced by UpdateWeights()
+    std::unordered_map<std::string, InferenceEngine::Blob::Ptr> _updatedConstants;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -13,18 +13,24 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <iterator>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
 #include "mkldnn_graph_optimizer.h"
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
-#include "mkldnn_memory_solver.hpp"
+#include "memory_solver.hpp"
 #include "mkldnn_itt.h"
 #include "mkldnn_infer_request.h"
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
 #include <nodes/mkldnn_convert_node.h>
+#include <nodes/mkldnn_concat_node.h>
+#include <nodes/mkldnn_split_node.h>
 
 #include <ie_algorithm.hpp>
 #include <blob_factory.hpp>
@@ -40,6 +46,8 @@
 #include "utils/ngraph_utils.hpp"
 #include "utils/cpu_utils.hpp"
 
+#include <ie_parallel.hpp>
+
 #include <ngraph/node.hpp>
 #include <ngraph/function.hpp>
 #include <ngraph/variant.hpp>
@@ -316,28 +324,111 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
     }
 }
 
+namespace {
+
+#ifdef CPU_DEBUG_CAPS
+// prints the time spent by the graph load stages, if OV_CPU_LOAD_TIME_STATS is set
+class LoadTimeStats {
+public:
+    explicit LoadTimeStats(const std::string& graphName) : graphName(graphName), last(std::chrono::steady_clock::now()) {}
+
+    ~LoadTimeStats() {
+        if (!std::getenv("OV_CPU_LOAD_TIME_STATS"))
+            return;
+
+        double total = 0;
+        std::cout << "Graph " << graphName << " load time:";
+        for (const auto& stage : stages) {
+            std::cout << " " << stage.first << " " << stage.second << " ms,";
+            total += stage.second;
+        }
+        std::cout << " total " << total << " ms" << std::endl;
+    }
+
+    void mark(const char* stage) {
+        const auto now = std::chrono::steady_clock::now();
+        stages.emplace_back(stage, std::chrono::duration<double, std::milli>(now - last).count());
+        last = now;
+    }
+
+private:
+    std::string graphName;
+    std::chrono::steady_clock::time_point last;
+    std::vector<std::pair<const char*, double>> stages;
+};
+#endif
+
+// Runs the func for the independent nodes on the threads of the current stream. The nodes are taken one by one,
+// so the expensive nodes, which should go first, don't delay the rest. Each node is processed in an isolated region:
+// a thread waiting for the nested parallel work of the node (e.g. a reorder) doesn't take another node, which may
+// wait for the weights cache memory locked by the other stream. The first error in the nodes order is re-thrown.
+template <typename F>
+void parallelForEachNode(const std::vector<MKLDNNNodePtr>& nodes, const F& func) {
+    if (nodes.empty())
+        return;
+
+    std::vector<std::exception_ptr> errors(nodes.size());
+    std::atomic<size_t> next{0};
+    const int nthr = static_cast<int>((std::min)(nodes.size(), static_cast<size_t>(parallel_get_max_threads())));
+    parallel_nt(nthr, [&](const int, const int) {
+        for (size_t i = next++; i < nodes.size(); i = next++) {
+            auto process = [&] {
+                try {
+                    func(nodes[i]);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            };
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+            tbb::this_task_arena::isolate(process);
+#else
+            process();
+#endif
+        }
+    });
+
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+
+}  // namespace
+
 void MKLDNNGraph::InitGraph() {
     MKLDNNGraphOptimizer optimizer;
+    ENABLE_CPU_DEBUG_CAP(LoadTimeStats loadTimeStats(_name))
 
     SortTopologically();
     InitNodes();
+    ENABLE_CPU_DEBUG_CAP(loadTimeStats.mark("InitNodes"))
 
     optimizer.ApplyCommonGraphOptimizations(*this);
     SortTopologically();
+    ENABLE_CPU_DEBUG_CAP(loadTimeStats.mark("CommonOptimizations"))
 
     InitDescriptors();
     RemoveDroppedEdges();
+    ENABLE_CPU_DEBUG_CAP(loadTimeStats.mark("InitDescriptors"))
 
     InitOptimalPrimitiveDescriptors();
+    ENABLE_CPU_DEBUG_CAP(loadTimeStats.mark("InitOptimalPrimitiveDescriptors"))
 
     InitEdges();
 
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
+    ENABLE_CPU_DEBUG_CAP(loadTimeStats.mark("InitEdges"))
 
     Allocate();
+    InitBindableInputs();
+    ENABLE_CPU_DEBUG_CAP(loadTimeStats.mark("Allocate"))
 
     CreatePrimitives();
+    ENABLE_CPU_DEBUG_CAP(loadTimeStats.mark("CreatePrimitives"))
+
+    PrepareInternalBlobs();
+    ENABLE_CPU_DEBUG_CAP(loadTimeStats.mark("PrepareInternalBlobs"))
 
 #ifndef CPU_DEBUG_CAPS
     for (auto &graphNode : graphNodes) {
@@ -349,6 +440,7 @@ void MKLDNNGraph::InitGraph() {
     printGraphInfo();
 #endif
     ExecuteConstantNodesOnly();
+    ENABLE_CPU_DEBUG_CAP(loadTimeStats.mark("ExecuteConstantNodes"))
 }
 
 void MKLDNNGraph::InitNodes() {
@@ -393,11 +485,9 @@ void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
 
 void MKLDNNGraph::ExecuteConstantNodesOnly() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::ExecuteConstantNodesOnly");
-    mkldnn::stream stream(eng);
-
     using shared_memory_ptr = MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr;
 
-    auto acquireSharedOutputs = [this](MKLDNNNodePtr & graphNode) {
+    auto acquireSharedOutputs = [this](const MKLDNNNodePtr & graphNode) {
         std::vector<shared_memory_ptr> outputs;
         bool hasLocalAllocatedEdges = false;
         bool hasExternalInvalidEdges = false;
@@ -419,22 +509,54 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
+    // the nodes of a level depend on the nodes of the previous levels only, so they are executed in parallel
+    std::unordered_map<MKLDNNNode*, size_t> nodeLevels;
+    std::vector<std::vector<MKLDNNNodePtr>> levels;
     for (auto &graphNode : graphNodes) {
         if (!graphNode->isConstant())
             continue;
 
-        if (weightsCache) {
-            auto sharedOutputs = acquireSharedOutputs(graphNode);
+        size_t level = 0;
+        for (size_t i = 0; i < graphNode->getParentEdges().size(); i++) {
+            auto parentLevel = nodeLevels.find(graphNode->getParentEdgeAt(i)->getParent().get());
+            if (parentLevel != nodeLevels.end())
+                level = (std::max)(level, parentLevel->second + 1);
+        }
+        nodeLevels[graphNode.get()] = level;
+        if (levels.size() <= level)
+            levels.resize(level + 1);
+        levels[level].push_back(graphNode);
+    }
 
-            if (std::get<0>(sharedOutputs) || std::get<1>(sharedOutputs)) {
-                graphNode->execute(stream);
+    auto getOutputsSize = [](const MKLDNNNodePtr& node) {
+        size_t size = 0;
+        for (size_t i = 0; i < node->getChildEdges().size(); i++)
+            size += node->getChildEdgeAt(i)->getMemory().GetSize();
+        return size;
+    };
 
-                for (auto & output : std::get<2>(sharedOutputs))
-                    output->valid(true);
+    for (auto &level : levels) {
+        std::stable_sort(level.begin(), level.end(), [&](const MKLDNNNodePtr& lhs, const MKLDNNNodePtr& rhs) {
+            return getOutputsSize(lhs) > getOutputsSize(rhs);
+        });
+
+        parallelForEachNode(level, [&](const MKLDNNNodePtr& graphNode) {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, graphNode->profiling.execute);
+            mkldnn::stream stream(eng);
+
+            if (weightsCache) {
+                auto sharedOutputs = acquireSharedOutputs(graphNode);
+
+                if (std::get<0>(sharedOutputs) || std::get<1>(sharedOutputs)) {
+                    graphNode->execute(stream);
+
+                    for (auto & output : std::get<2>(sharedOutputs))
+                        output->valid(true);
+                }
+            } else {
+                graphNode->execute(stream);
             }
-        } else {
-            graphNode->execute(stream);
-        }
+        });
     }
 }
 
@@ -515,6 +637,14 @@ static inline bool isConstOutput(MKLDNNEdgePtr edge) {
     return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
 }
 
+static const void* getConstData(const MKLDNNEdgePtr& edge) {
+    auto parent = edge->getParent();
+    if (parent->getType() != Input)
+        return nullptr;
+    auto inputNode = dynamic_cast<MKLDNNInputNode*>(parent.get());
+    return inputNode ? inputNode->getConstDataOfLayout(edge->getDesc()) : nullptr;
+}
+
 static edge_clusters_t findEdgeClusters(const std::vector<MKLDNNEdgePtr> & graphEdges) {
     typedef std::unordered_map<MKLDNNEdgePtr, size_t> edge_cluster_idx_map_t;
 
@@ -572,7 +702,13 @@ void MKLDNNGraph::AllocateWithReuse() {
         for (auto &edge : cluster) {
             if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation
                 && edge->getParent()->isConstant()) {
-                edge->externalAllocate(weightsCache);
+                // the constant consumed during the compilation isn't copied, the edge refers to the constant data
+                auto constData = cluster.size() == 1 && !edge->getChild()->readsInputOnExecute(edge->getOutputNum())
+                                 ? getConstData(edge) : nullptr;
+                if (constData)
+                    edge->allocate(constData);
+                else
+                    edge->externalAllocate(weightsCache);
                 erase = true;
             }
         }
@@ -701,7 +837,74 @@ void MKLDNNGraph::CreatePrimitives() {
     }
 }
 
-void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
+void MKLDNNGraph::PrepareInternalBlobs() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::PrepareInternalBlobs");
+    std::vector<MKLDNNNodePtr> nodes;
+    std::copy_if(graphNodes.begin(), graphNodes.end(), std::back_inserter(nodes), [](const MKLDNNNodePtr& node) {
+        return !node->internalBlobs.empty();
+    });
+
+    auto getInternalBlobsSize = [](const MKLDNNNodePtr& node) {
+        size_t size = 0;
+        for (const auto& blob : node->internalBlobs)
+            size += blob->byteSize();
+        return size;
+    };
+    std::stable_sort(nodes.begin(), nodes.end(), [&](const MKLDNNNodePtr& lhs, const MKLDNNNodePtr& rhs) {
+        return getInternalBlobsSize(lhs) > getInternalBlobsSize(rhs);
+    });
+
+    parallelForEachNode(nodes, [](const MKLDNNNodePtr& node) {
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.createPrimitive);
+        node->fillInternalBlobMemory();
+    });
+}
+
+void MKLDNNGraph::InitBindableInputs() {
+    // with the dynamic batch the input memory is partially filled, so the inputs are always copied
+    if (config.batchLimit)
+        return;
+
+    for (const auto& input : inputNodesMap) {
+        const auto& node = input.second;
+        bool canBeInPlace = !node->getChildEdges().empty();
+        for (size_t i = 0; canBeInPlace && i < node->getChildEdges().size(); i++) {
+            auto& child = node->getChildEdgeAt(i)->getChild();
+            if (child->isConstant() || child->isInplace())
+                canBeInPlace = false;
+            auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+            if (canBeInPlace && concat && concat->isOptimized())
+                canBeInPlace = false;
+
+            // Cannot be in-place before split because split is using different ptrs without offsets
+            auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
+            if (canBeInPlace && split)
+                canBeInPlace = false;
+
+            for (size_t j = 0; canBeInPlace && j < child->getChildEdges().size(); j++) {
+                if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
+                        node->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
+                    canBeInPlace = false;
+            }
+        }
+
+        if (canBeInPlace) {
+            auto edge = node->getChildEdgeAt(0);
+            bindableInputs[input.first] = {edge->getMemory().GetPrimitive().get_data_handle(), edge->getBlob()->getTensorDesc()};
+        }
+    }
+}
+
+#ifdef CPU_DEBUG_CAPS
+MKLDNNGraph::~MKLDNNGraph() {
+    if (std::getenv("OV_CPU_INPUT_COPY_STATS") && (boundInputsCount || copiedInputsCount)) {
+        std::cout << "Graph " << _name << " inputs: " << boundInputsCount << " bound, "
+                  << copiedInputsCount << " copied" << std::endl;
+    }
+}
+#endif
+
+void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool bindable) {
     if (!IsReady()) IE_THROW()<< "Wrong state. Topology not ready.";
 
     auto input = inputNodesMap.find(name);
@@ -709,6 +912,20 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         MKLDNNDims outDims = input->second->getChildEdgeAt(0)->getDims();
 
         const void *ext_data_ptr = in->cbuffer();
+
+        auto bindableInput = bindableInputs.find(name);
+        if (bindableInput != bindableInputs.end()) {
+            // the input memory previously bound to another blob is restored, if the data has to be copied
+            const bool bind = bindable && in->getTensorDesc() == bindableInput->second.desc &&
+                              _meanImages.find(name) == _meanImages.end();
+            void *data_ptr = bind ? const_cast<void *>(ext_data_ptr) : bindableInput->second.ownData;
+            for (size_t i = 0; i < input->second->getChildEdges().size(); i++) {
+                auto& memPrim = input->second->getChildEdgeAt(i)->getMemory().GetPrimitivePtr();
+                if (memPrim->get_data_handle() != data_ptr)
+                    memPrim->set_data_handle(data_ptr);
+            }
+        }
+
         void *inter_data_ptr = input->second->getChildEdgeAt(0)->getMemory().GetData();
 
         if (ext_data_ptr != inter_data_ptr) {
@@ -718,6 +935,9 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
             ext_mem.Create(ext_tdesc, ext_data_ptr, false);
 
             input->second->getChildEdgeAt(0)->getMemory().SetData(ext_mem, 0, false);
+            ENABLE_CPU_DEBUG_CAP(copiedInputsCount++);
+        } else {
+            ENABLE_CPU_DEBUG_CAP(boundInputsCount++);
         }
 
         // todo: make sure 'name' exists in this map...
@@ -806,6 +1026,142 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
     }
 }
 
+void MKLDNNGraph::collectConstants(const std::map<std::string, Blob::Ptr>& constants,
+                                   std::vector<std::pair<MKLDNNInputNode*, Blob::Ptr>>& replacements,
+                                   std::unordered_set<MKLDNNNode*>& dependentNodes) const {
+    if (status != Ready) {
+        IE_THROW() << "Wrong state. Topology is not ready.";
+    }
+
+    // the constant names aren't guaranteed to be unique, so the ambiguous names are mapped onto nullptr
+    std::unordered_map<std::string, MKLDNNInputNode*> constInputs;
+    for (auto& node : graphNodes) {
+        if (node->getType() == Input && node->isConstant()) {
+            auto inserted = constInputs.emplace(node->getName(), dynamic_cast<MKLDNNInputNode*>(node.get()));
+            if (!inserted.second)
+                inserted.first->second = nullptr;
+        }
+    }
+
+    for (const auto& constant : constants) {
+        auto found = constInputs.find(constant.first);
+        auto inputNode = found != constInputs.end() ? found->second : nullptr;
+        // the constant without consumers was merged into another node
+        if (!inputNode || inputNode->getChildEdges().empty() || inputNode->isConstBlobConsumed())
+            IE_THROW(NotImplemented) << "Constant " << constant.first << " was consumed during the graph compilation and can't be updated";
+
+        std::vector<MKLDNNNode*> nodesToVisit = {inputNode};
+        while (!nodesToVisit.empty()) {
+            auto node = nodesToVisit.back();
+            nodesToVisit.pop_back();
+            for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+                auto edge = node->getChildEdgeAt(i);
+                auto child = edge->getChild();
+                if (!child->readsInputOnExecute(edge->getOutputNum()))
+                    IE_THROW(NotImplemented) << "Constant " << constant.first << " can't be updated, since input " << edge->getOutputNum()
+                                             << " of node " << child->getName() << " was consumed during the graph compilation";
+                if (child->isConstant() && dependentNodes.insert(child.get()).second)
+                    nodesToVisit.push_back(child.get());
+            }
+        }
+        replacements.emplace_back(inputNode, constant.second);
+    }
+}
+
+void MKLDNNGraph::ValidateConstants(const std::map<std::string, Blob::Ptr>& constants) const {
+    std::vector<std::pair<MKLDNNInputNode*, Blob::Ptr>> replacements;
+    std::unordered_set<MKLDNNNode*> dependentNodes;
+    collectConstants(constants, replacements, dependentNodes);
+}
+
+void MKLDNNGraph::rebindMemory(const MKLDNNMemoryPtr& oldMemory, const MKLDNNMemoryPtr& newMemory) {
+    auto oldData = static_cast<uint8_t*>(oldMemory->GetData());
+    auto newData = static_cast<uint8_t*>(newMemory->GetData());
+    const size_t size = oldMemory->GetSize();
+
+    // the in-place edges keep own memory objects pointing to the shared data
+    for (auto& edge : graphEdges) {
+        auto& memory = edge->getMemoryPtr();
+        if (!memory)
+            continue;
+        if (memory == oldMemory) {
+            memory = newMemory;
+            continue;
+        }
+
+        auto data = static_cast<uint8_t*>(memory->GetPrimitive().get_data_handle());
+        if (data >= oldData && data < oldData + size) {
+            MKLDNNMemoryPtr rebound(new MKLDNNMemory(eng));
+            rebound->Create(memory->GetDescriptor(), newData + (data - oldData));
+            memory = rebound;
+        }
+    }
+
+    for (auto& node : graphNodes)
+        node->rebindPrimArgs(oldData, size, newData);
+}
+
+void MKLDNNGraph::MoveConstantsToCache(const std::map<std::string, Blob::Ptr>& constants, const MKLDNNWeightsSharing::Ptr& cache) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::MoveConstantsToCache");
+
+    if (!weightsCache || !cache || weightsCache == cache)
+        return;
+
+    std::vector<std::pair<MKLDNNInputNode*, Blob::Ptr>> replacements;
+    std::unordered_set<MKLDNNNode*> dependentNodes;
+    collectConstants(constants, replacements, dependentNodes);
+    for (auto& replacement : replacements)
+        dependentNodes.insert(replacement.first);
+
+    for (auto& node : graphNodes) {
+        if (dependentNodes.count(node.get()) == 0)
+            continue;
+
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto edge = node->getChildEdgeAt(i);
+            if (!edge->isUseExternalMemory())
+                continue;
+
+            // the copy is found if the edge was moved by the previous update or by another graph
+            auto sharedMemory = edge->getMemoryPtr();
+            MKLDNNMemoryPtr memory = *cache->findOrCreate(edge->name(), [&] () {
+                MKLDNNMemoryPtr copy(new MKLDNNMemory(eng));
+                copy->Create(sharedMemory->GetDescriptor());
+                cpu_memcpy(copy->GetData(), sharedMemory->GetData(), sharedMemory->GetSize());
+                return copy;
+            });
+            if (memory != sharedMemory)
+                rebindMemory(sharedMemory, memory);
+        }
+    }
+}
+
+void MKLDNNGraph::UpdateConstants(const std::map<std::string, Blob::Ptr>& constants, bool updateSharedMemory) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::UpdateConstants");
+
+    // check all the constants before any of them is replaced
+    std::vector<std::pair<MKLDNNInputNode*, Blob::Ptr>> replacements;
+    std::unordered_set<MKLDNNNode*> dependentNodes;
+    collectConstants(constants, replacements, dependentNodes);
+
+    for (auto& replacement : replacements) {
+        replacement.first->replaceConstBlob(replacement.second);
+        dependentNodes.insert(replacement.first);
+    }
+
+    mkldnn::stream stream(eng);
+    for (auto& node : graphNodes) {
+        if (dependentNodes.count(node.get()) == 0)
+            continue;
+
+        bool hasLocalOutputs = !weightsCache;
+        for (size_t i = 0; i < node->getChildEdges().size() && !hasLocalOutputs; i++)
+            hasLocalOutputs = !node->getChildEdgeAt(i)->isUseExternalMemory();
+        if (updateSharedMemory || hasLocalOutputs)
+            node->execute(stream);
+    }
+}
+
 void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
     if (!IsReady()) {
         IE_THROW() << "Wrong state. Topology is not ready.";
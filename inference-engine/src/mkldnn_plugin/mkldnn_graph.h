@@ -15,9 +15,12 @@
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <unordered_set>
+#include <utility>
 
 namespace MKLDNNPlugin {
 class MKLDNNInferRequest;
+class MKLDNNInputNode;
 class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
@@ -29,6 +32,9 @@ public:
     };
 
     MKLDNNGraph() = default;
+#ifdef CPU_DEBUG_CAPS
+    ~MKLDNNGraph();
+#endif
 
     Status GetStatus() {
         return status;
@@ -54,9 +60,39 @@ public:
         return _meanImages.find(name) != _meanImages.end();
     }
 
-    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    /**
+     * @brief Feeds the blob to the graph input. The input memory is bound to the blob data, if the blob matches
+     * the input memory descriptor and may be bound, otherwise the data is copied to the own input memory.
+     * @param bindable the blob data stays valid till the end of the inference
+     */
+    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool bindable = false);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
+    /**
+     * @brief Checks that the data of the constants can be replaced by UpdateConstants(), throws otherwise,
+     * e.g. if the constant data was consumed during the compilation
+     * @param constants new data of the constants by the constant node names
+     */
+    void ValidateConstants(const std::map<std::string, InferenceEngine::Blob::Ptr>& constants) const;
+
+    /**
+     * @brief Copies the outputs of the constant nodes depending on the constants from the graph weights cache to
+     * the given one and makes the graph use the copies, so that they can be updated without affecting the other
+     * graphs sharing the weights cache. The copies are allocated by the calling thread.
+     * @param constants the constants to be updated
+     * @param cache the weights cache keeping the copies, shared by the graphs of the same NUMA node
+     */
+    void MoveConstantsToCache(const std::map<std::string, InferenceEngine::Blob::Ptr>& constants,
+                              const MKLDNNWeightsSharing::Ptr& cache);
+
+    /**
+     * @brief Replaces the data of the constants without compiling the graph again and executes the constant nodes
+     * depending on them. The graph is left intact if some constant can't be replaced.
+     * @param constants new data of the constants by the constant node names
+     * @param updateSharedMemory the constant outputs shared through the weights cache are updated as well
+     */
+    void UpdateConstants(const std::map<std::string, InferenceEngine::Blob::Ptr>& constants, bool updateSharedMemory = true);
+
     void Infer(MKLDNNInferRequest* request = nullptr, int batch = -1);
 
     std::vector<MKLDNNNodePtr>& GetNodes() {
@@ -169,6 +205,7 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _meanImages.clear();
+        bindableInputs.clear();
     }
     Status status { NotReady };
     Config config;
@@ -189,6 +226,18 @@ protected:
     std::map<std::string, MeanImage> _meanImages;
     std::string _name;
 
+    struct BindableInput {
+        void* ownData;
+        InferenceEngine::TensorDesc desc;
+    };
+    // inputs which memory may be bound to the user blobs instead of copying them
+    std::map<std::string, BindableInput> bindableInputs;
+
+#ifdef CPU_DEBUG_CAPS
+    size_t boundInputsCount = 0;
+    size_t copiedInputsCount = 0;
+#endif
+
     bool isQuantizedFlag = false;
 
     static mkldnn::engine eng;
@@ -202,9 +251,18 @@ protected:
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
+    void InitBindableInputs();
     void CreatePrimitives();
+    void PrepareInternalBlobs();
     void ExecuteConstantNodesOnly();
 
+    // collects the constant nodes to be replaced and the constant nodes depending on them
+    void collectConstants(const std::map<std::string, InferenceEngine::Blob::Ptr>& constants,
+                          std::vector<std::pair<MKLDNNInputNode*, InferenceEngine::Blob::Ptr>>& replacements,
+                          std::unordered_set<MKLDNNNode*>& dependentNodes) const;
+    // makes the edges and the primitives using the data of the old memory use the new memory
+    void rebindMemory(const MKLDNNMemoryPtr& oldMemory, const MKLDNNMemoryPtr& newMemory);
+
     friend class MKLDNNInferRequest;
     friend class MKLDNNGraphlessInferRequest;
     friend InferenceEngine::CNNNetwork dump_graph_as_ie_ngraph_net(const MKLDNNGraph &graph);
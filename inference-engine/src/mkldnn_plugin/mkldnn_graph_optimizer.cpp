@@ -11,6 +11,9 @@
 #include "nodes/mkldnn_concat_node.h"
 #include "nodes/mkldnn_reorder_node.h"
 #include "nodes/mkldnn_conv_node.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
+#include "nodes/mkldnn_rnn.h"
+#include "nodes/mkldnn_embedding_bag_sum_node.h"
 #include "nodes/mkldnn_bin_conv_node.h"
 #include "nodes/mkldnn_fake_quantize_node.h"
 #include "nodes/mkldnn_mvn_node.h"
@@ -41,6 +44,7 @@
 #include <memory>
 #include <set>
 #include <algorithm>
+#include <numeric>
 
 #include "mkldnn_itt.h"
 
@@ -51,7 +55,19 @@ using namespace InferenceEngine;
 MKLDNNGraphOptimizer::MKLDNNGraphOptimizer() {}
 
 void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
-    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::MKLDNN_LT, "ApplyCommonGraphOptimizations", "FuseConvolutionAndBias");
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::MKLDNN_LT, "ApplyCommonGraphOptimizations", "FuseFullyConnectedAndWeightsDecompression");
+    FuseFullyConnectedAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseRNNAndDequantization");
+    FuseRNNAndDequantization(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEmbeddingBagAndTableDequantization");
+    FuseEmbeddingBagAndTableDequantization(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndBias");
     FuseConvolutionAndBias(graph);
     graph.RemoveDroppedNodes();
 
@@ -147,6 +163,408 @@ void MKLDNNGraphOptimizer::ApplyImplSpecificGraphOptimizations(MKLDNNGraph &grap
     graph.RemoveDroppedEdges();
 }
 
+void MKLDNNGraphOptimizer::FuseFullyConnectedAndWeightsDecompression(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSutableConstEltwise = [](const MKLDNNNodePtr& node) {
+        return node->getType() == Eltwise && node->isConstant() && node->getFusedWith().empty() && node->getChildEdges().size() == 1;
+    };
+
+    auto getConstInputPort = [](const MKLDNNNodePtr& node) {
+        for (int port = 0; port < node->getParentEdges().size(); port++) {
+            auto parent = node->getParentEdgesAtPort(port)[0]->getParent();
+            if (parent->getType() == Input && parent->isConstant() && parent->getChildEdges().size() == 1)
+                return port;
+        }
+        return -1;
+    };
+
+    // Reads scalar or per output channel ([OC, 1]) decompression parameter
+    auto readPerChannelConstant = [](const MKLDNNNodePtr& node, size_t OC, std::vector<float>& values) {
+        auto* inputNode = dynamic_cast<MKLDNNInputNode*>(node.get());
+        if (inputNode == nullptr || !inputNode->getConstBlob())
+            return false;
+
+        const auto& blobDesc = inputNode->getConstBlob()->getTensorDesc();
+        if (blobDesc.getPrecision() != Precision::FP32)
+            return false;
+
+        const auto& dims = blobDesc.getDims();
+        const size_t size = std::accumulate(dims.begin(), dims.end(), size_t{1}, std::multiplies<size_t>());
+        if (size != 1 && !(dims.size() == 2 && dims[0] == OC && dims[1] == 1))
+            return false;
+
+        auto data = inputNode->getConstBlob()->cbuffer().as<const float*>() + blobDesc.getBlockingDesc().getOffsetPadding();
+        if (size == 1)
+            values.assign(OC, data[0]);
+        else
+            values.assign(data, data + OC);
+        return true;
+    };
+
+    for (auto &node : graphNodes) {
+        auto fcNode = std::dynamic_pointer_cast<MKLDNNFullyConnectedNode>(node);
+        if (fcNode == nullptr || fcNode->withWeightsDecompression() || !fcNode->getFusedWith().empty())
+            continue;
+
+        const auto& outDims = fcNode->getChildEdgeAt(0)->getDims();
+        const size_t OC = outDims[outDims.ndims() - 1];
+        // bigger layers are faster in oneDNN with the weights folded to FP32 and the post operations fused
+        const size_t rows = OC != 0 ? static_cast<size_t>(outDims.size()) / OC : 0;
+        if (rows == 0)
+            continue;
+
+        std::vector<float> scales;
+        std::vector<float> zeroPoints;
+
+        // FP16 weights: Const(FP16) -> Convert, expanded by the kernel without scales
+        auto weightsParent = fcNode->getParentEdgesAtPort(1)[0]->getParent();
+        if (weightsParent->getType() == Convert && weightsParent->isConstant() && weightsParent->getChildEdges().size() == 1) {
+            auto weights = weightsParent->getParentEdgesAtPort(0)[0]->getParent();
+            const auto& weightsDims = weightsParent->getParentEdgesAtPort(0)[0]->getDims();
+            if (weights->getType() == Input && weights->isConstant() && weights->getChildEdges().size() == 1 &&
+                    weights->getOriginalOutputPrecisionAtPort(0) == Precision::FP16 &&
+                    weightsDims.ndims() == 2 && weightsDims[0] == OC) {
+                fcNode->setWeightsDecompression(std::vector<float>(OC, 1.f), {});
+                graph.DropNode(weightsParent);
+                fcNode->setOriginalInputPrecisionAtPort(1, Precision::FP16);
+            }
+            continue;
+        }
+
+        // Multiply by per output channel scale
+        auto multiply = weightsParent;
+        if (rows > static_cast<size_t>(graph.getProperty().fcInt8WeiDecompressionMaxRows) || !isSutableConstEltwise(multiply))
+            continue;
+
+        int scalePort = -1;
+        if (multiply->getAlgorithm() == EltwiseMultiply && multiply->getParentEdges().size() == 2) {
+            scalePort = getConstInputPort(multiply);
+            if (scalePort < 0 || !readPerChannelConstant(multiply->getParentEdgesAtPort(scalePort)[0]->getParent(), OC, scales))
+                continue;
+        } else if (multiply->getAlgorithm() == EltwisePowerStatic && multiply->getParentEdges().size() == 1) {
+            auto powerNode = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(multiply);
+            if (!powerNode || powerNode->getAlpha() != 1.0f || powerNode->getGamma() != 0.0f)
+                continue;
+            scales.assign(OC, powerNode->getBeta());
+        } else {
+            continue;
+        }
+
+        // Optional subtraction of per output channel zero point
+        auto subtract = multiply->getParentEdgesAtPort(scalePort == 0 ? 1 : 0)[0]->getParent();
+        int zeroPointPort = -1;
+        if (subtract->getType() == Eltwise) {
+            if (!isSutableConstEltwise(subtract))
+                continue;
+
+            if (subtract->getAlgorithm() == EltwiseSubtract && subtract->getParentEdges().size() == 2) {
+                zeroPointPort = 1;
+                if (getConstInputPort(subtract) != zeroPointPort ||
+                    !readPerChannelConstant(subtract->getParentEdgesAtPort(zeroPointPort)[0]->getParent(), OC, zeroPoints))
+                    continue;
+            } else if (subtract->getAlgorithm() == EltwiseAdd && subtract->getParentEdges().size() == 2) {
+                zeroPointPort = getConstInputPort(subtract);
+                if (zeroPointPort < 0 || !readPerChannelConstant(subtract->getParentEdgesAtPort(zeroPointPort)[0]->getParent(), OC, zeroPoints))
+                    continue;
+                for (auto& zp : zeroPoints)
+                    zp = -zp;
+            } else if (subtract->getAlgorithm() == EltwisePowerStatic && subtract->getParentEdges().size() == 1) {
+                auto powerNode = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(subtract);
+                if (!powerNode || powerNode->getAlpha() != 1.0f || powerNode->getBeta() != 1.0f)
+                    continue;
+                zeroPoints.assign(OC, -powerNode->getGamma());
+            } else {
+                continue;
+            }
+        } else {
+            subtract = nullptr;
+        }
+
+        // Convert of compressed weights
+        auto convert = subtract ? subtract->getParentEdgesAtPort(zeroPointPort == 0 ? 1 : 0)[0]->getParent()
+                                : multiply->getParentEdgesAtPort(scalePort == 0 ? 1 : 0)[0]->getParent();
+        if (convert->getType() != Convert || !convert->isConstant() || convert->getChildEdges().size() != 1)
+            continue;
+
+        auto weights = convert->getParentEdgesAtPort(0)[0]->getParent();
+        const auto weightsPrecision = weights->getOriginalOutputPrecisionAtPort(0);
+        if (weights->getType() != Input || !weights->isConstant() || weights->getChildEdges().size() != 1 ||
+            !one_of(weightsPrecision, Precision::U8, Precision::I8))
+            continue;
+
+        const auto& weightsDims = convert->getParentEdgesAtPort(0)[0]->getDims();
+        if (weightsDims.ndims() != 2 || weightsDims[0] != OC)
+            continue;
+
+        if (std::none_of(zeroPoints.begin(), zeroPoints.end(), [](float zp) { return zp != 0.f; }))
+            zeroPoints.clear();
+        fcNode->setWeightsDecompression(std::move(scales), std::move(zeroPoints));
+
+        if (scalePort >= 0) {
+            auto scaleEdge = multiply->getParentEdgesAtPort(scalePort)[0];
+            removeEdge(graph, scaleEdge);
+        }
+        graph.DropNode(multiply);
+
+        if (subtract) {
+            if (zeroPointPort >= 0) {
+                auto zeroPointEdge = subtract->getParentEdgesAtPort(zeroPointPort)[0];
+                removeEdge(graph, zeroPointEdge);
+            }
+            graph.DropNode(subtract);
+        }
+
+        graph.DropNode(convert);
+        fcNode->setOriginalInputPrecisionAtPort(1, weightsPrecision);
+    }
+}
+
+void MKLDNNGraphOptimizer::FuseRNNAndDequantization(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto getConstInputPort = [](const MKLDNNNodePtr& node) {
+        for (int port = 0; port < node->getParentEdges().size(); port++) {
+            auto parent = node->getParentEdgesAtPort(port)[0]->getParent();
+            if (parent->getType() == Input && parent->isConstant() && parent->getChildEdges().size() == 1)
+                return port;
+        }
+        return -1;
+    };
+
+    // Reads scalar or per output channel dequantization value
+    auto readConstant = [](const MKLDNNNodePtr& node, size_t OC, std::vector<float>& values) {
+        auto* inputNode = dynamic_cast<MKLDNNInputNode*>(node.get());
+        if (inputNode == nullptr || !inputNode->getConstBlob())
+            return false;
+
+        const auto& blobDesc = inputNode->getConstBlob()->getTensorDesc();
+        if (blobDesc.getPrecision() != Precision::FP32)
+            return false;
+
+        const auto& dims = blobDesc.getDims();
+        const size_t size = std::accumulate(dims.begin(), dims.end(), size_t{1}, std::multiplies<size_t>());
+        if (size != 1 && size != OC)
+            return false;
+
+        auto data = inputNode->getConstBlob()->cbuffer().as<const float*>() + blobDesc.getBlockingDesc().getOffsetPadding();
+        if (size == 1)
+            values.assign(OC, data[0]);
+        else
+            values.assign(data, data + OC);
+        return true;
+    };
+
+    // Multiply by constant scale: Eltwise Multiply or PowerStatic
+    auto readMultiplyScales = [&](const MKLDNNNodePtr& node, size_t OC, std::vector<float>& scales, int& scalePort) {
+        scalePort = -1;
+        if (node->getType() != Eltwise || !node->getFusedWith().empty() || node->getChildEdges().size() != 1)
+            return false;
+
+        if (node->getAlgorithm() == EltwiseMultiply && node->getParentEdges().size() == 2) {
+            scalePort = getConstInputPort(node);
+            return scalePort >= 0 && readConstant(node->getParentEdgesAtPort(scalePort)[0]->getParent(), OC, scales);
+        } else if (node->getAlgorithm() == EltwisePowerStatic && node->getParentEdges().size() == 1) {
+            auto powerNode = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(node);
+            if (!powerNode || powerNode->getAlpha() != 1.0f || powerNode->getGamma() != 0.0f)
+                return false;
+            scales.assign(OC, powerNode->getBeta());
+            return true;
+        }
+        return false;
+    };
+
+    auto dropEltwise = [&](const MKLDNNNodePtr& node, int constPort) {
+        if (constPort >= 0) {
+            auto constEdge = node->getParentEdgesAtPort(constPort)[0];
+            removeEdge(graph, constEdge);
+        }
+        graph.DropNode(node);
+    };
+
+    for (auto &node : graphNodes) {
+        auto rnnNode = std::dynamic_pointer_cast<MKLDNNRNN>(node);
+        if (rnnNode == nullptr || rnnNode->withWeightsDequantization())
+            continue;
+
+        // W and R: Const(I8) -> Convert -> Multiply by per output channel scale
+        const size_t weightsPorts[] = {rnnNode->getWeightsIdx(), rnnNode->getRecurrenceWeightsIdx()};
+        const auto& wDims = rnnNode->getParentEdgesAtPort(weightsPorts[0])[0]->getDims();
+        const size_t OC = wDims[wDims.ndims() - 2];
+
+        std::vector<float> weightsScales[2];
+        int weightsScalePorts[2] = {-1, -1};
+        MKLDNNNodePtr weightsMultiplies[2];
+        MKLDNNNodePtr weightsConverts[2];
+        bool isSuitableWeights = true;
+        for (int i = 0; i < 2 && isSuitableWeights; i++) {
+            weightsMultiplies[i] = rnnNode->getParentEdgesAtPort(weightsPorts[i])[0]->getParent();
+            if (!weightsMultiplies[i]->isConstant() ||
+                    !readMultiplyScales(weightsMultiplies[i], OC, weightsScales[i], weightsScalePorts[i])) {
+                isSuitableWeights = false;
+                break;
+            }
+
+            weightsConverts[i] = weightsMultiplies[i]->getParentEdgesAtPort(weightsScalePorts[i] == 0 ? 1 : 0)[0]->getParent();
+            auto weights = weightsConverts[i]->getParentEdgesAtPort(0)[0]->getParent();
+            isSuitableWeights = weightsConverts[i]->getType() == Convert && weightsConverts[i]->isConstant() &&
+                                weightsConverts[i]->getChildEdges().size() == 1 &&
+                                weights->getType() == Input && weights->isConstant() &&
+                                weights->getOriginalOutputPrecisionAtPort(0) == Precision::I8;
+        }
+        if (!isSuitableWeights)
+            continue;
+
+        rnnNode->setWeightsDequantization(weightsScales[0], weightsScales[1]);
+        for (int i = 0; i < 2; i++) {
+            dropEltwise(weightsMultiplies[i], weightsScalePorts[i]);
+            graph.DropNode(weightsConverts[i]);
+            rnnNode->setOriginalInputPrecisionAtPort(weightsPorts[i], Precision::I8);
+        }
+
+        // Layer input: U8 -> [Convert] -> [Subtract zero point] -> Multiply by scale
+        // Without it the node dequantizes weights and keeps executing in the original precision.
+        // The primitive quantizes the hidden state with the layer input parameters too: LPT transforms
+        // the cell only if the hidden state input is quantized with the same parameters.
+        if (!rnnNode->isInt8Supported())
+            continue;
+
+        auto multiply = rnnNode->getParentEdgesAtPort(0)[0]->getParent();
+        std::vector<float> scale;
+        int scalePort = -1;
+        if (multiply->isConstant() || !readMultiplyScales(multiply, 1, scale, scalePort) || scale[0] <= 0.f)
+            continue;
+
+        auto subtract = multiply->getParentEdgesAtPort(scalePort == 0 ? 1 : 0)[0]->getParent();
+        int zeroPointPort = -1;
+        float shift = 0.f;
+        if (subtract->getType() == Eltwise) {
+            if (!subtract->getFusedWith().empty() || subtract->getChildEdges().size() != 1)
+                continue;
+
+            std::vector<float> zeroPoint;
+            if (subtract->getAlgorithm() == EltwiseSubtract && subtract->getParentEdges().size() == 2) {
+                zeroPointPort = 1;
+                if (getConstInputPort(subtract) != zeroPointPort ||
+                        !readConstant(subtract->getParentEdgesAtPort(zeroPointPort)[0]->getParent(), 1, zeroPoint))
+                    continue;
+                shift = zeroPoint[0];
+            } else if (subtract->getAlgorithm() == EltwiseAdd && subtract->getParentEdges().size() == 2) {
+                zeroPointPort = getConstInputPort(subtract);
+                if (zeroPointPort < 0 || !readConstant(subtract->getParentEdgesAtPort(zeroPointPort)[0]->getParent(), 1, zeroPoint))
+                    continue;
+                shift = -zeroPoint[0];
+            } else if (subtract->getAlgorithm() == EltwisePowerStatic && subtract->getParentEdges().size() == 1) {
+                auto powerNode = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(subtract);
+                if (!powerNode || powerNode->getAlpha() != 1.0f || powerNode->getBeta() != 1.0f)
+                    continue;
+                shift = -powerNode->getGamma();
+            } else {
+                continue;
+            }
+        } else {
+            subtract = nullptr;
+        }
+
+        auto dequantizationInput = subtract ? subtract : multiply;
+        const int dataPort = subtract ? (zeroPointPort == 0 ? 1 : 0) : (scalePort == 0 ? 1 : 0);
+        auto convert = dequantizationInput->getParentEdgesAtPort(dataPort)[0]->getParent();
+        Precision srcPrecision;
+        if (convert->getType() == Convert && convert->getChildEdges().size() == 1) {
+            srcPrecision = convert->getOriginalInputPrecisionAtPort(0);
+        } else {
+            convert = nullptr;
+            srcPrecision = dequantizationInput->getOriginalInputPrecisionAtPort(dataPort);
+        }
+        if (srcPrecision != Precision::U8)
+            continue;
+
+        rnnNode->setInputDequantization(scale[0], shift);
+
+        dropEltwise(multiply, scalePort);
+        if (subtract)
+            dropEltwise(subtract, zeroPointPort);
+        if (convert)
+            graph.DropNode(convert);
+        rnnNode->setOriginalInputPrecisionAtPort(0, Precision::U8);
+    }
+}
+
+void MKLDNNGraphOptimizer::FuseEmbeddingBagAndTableDequantization(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    // Reads scalar or per row scale
+    auto readScales = [](const MKLDNNNodePtr& node, size_t rows, std::vector<float>& values) {
+        auto* inputNode = dynamic_cast<MKLDNNInputNode*>(node.get());
+        if (inputNode == nullptr || !inputNode->isConstant() || !inputNode->getConstBlob() || node->getChildEdges().size() != 1)
+            return false;
+
+        const auto& blobDesc = inputNode->getConstBlob()->getTensorDesc();
+        if (blobDesc.getPrecision() != Precision::FP32)
+            return false;
+
+        const auto& dims = blobDesc.getDims();
+        const size_t size = std::accumulate(dims.begin(), dims.end(), size_t{1}, std::multiplies<size_t>());
+        if (size != 1 && !(size == rows && dims[0] == rows))
+            return false;
+
+        auto data = inputNode->getConstBlob()->cbuffer().as<const float*>() + blobDesc.getBlockingDesc().getOffsetPadding();
+        values.assign(data, data + size);
+        return true;
+    };
+
+    for (auto &node : graphNodes) {
+        if (!one_of(node->getType(), EmbeddingBagOffsetsSum, EmbeddingBagPackedSum, EmbeddingSegmentsSum))
+            continue;
+        auto embeddingNode = dynamic_cast<MKLDNNEmbeddingBagSumNode*>(node.get());
+        if (embeddingNode == nullptr || !embeddingNode->getTableScales().empty())
+            continue;
+
+        // Const(I8) -> Convert -> Multiply by scalar or per row scale
+        auto multiply = node->getParentEdgesAtPort(0)[0]->getParent();
+        if (multiply->getType() != Eltwise || !multiply->isConstant() || !multiply->getFusedWith().empty() ||
+                multiply->getChildEdges().size() != 1)
+            continue;
+
+        const size_t rows = node->getParentEdgesAtPort(0)[0]->getDims()[0];
+        std::vector<float> scales;
+        int scalePort = -1;
+        if (multiply->getAlgorithm() == EltwiseMultiply && multiply->getParentEdges().size() == 2) {
+            for (int port = 0; port < 2 && scalePort < 0; port++) {
+                if (readScales(multiply->getParentEdgesAtPort(port)[0]->getParent(), rows, scales))
+                    scalePort = port;
+            }
+            if (scalePort < 0)
+                continue;
+        } else if (multiply->getAlgorithm() == EltwisePowerStatic && multiply->getParentEdges().size() == 1) {
+            auto powerNode = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(multiply);
+            if (!powerNode || powerNode->getAlpha() != 1.0f || powerNode->getGamma() != 0.0f)
+                continue;
+            scales.assign(1, powerNode->getBeta());
+        } else {
+            continue;
+        }
+
+        auto convert = multiply->getParentEdgesAtPort(scalePort == 0 ? 1 : 0)[0]->getParent();
+        if (convert->getType() != Convert || !convert->isConstant() || convert->getChildEdges().size() != 1)
+            continue;
+
+        auto table = convert->getParentEdgesAtPort(0)[0]->getParent();
+        if (table->getType() != Input || !table->isConstant() || table->getOriginalOutputPrecisionAtPort(0) != Precision::I8)
+            continue;
+
+        embeddingNode->setTableScales(scales);
+
+        if (scalePort >= 0) {
+            auto scaleEdge = multiply->getParentEdgesAtPort(scalePort)[0];
+            removeEdge(graph, scaleEdge);
+        }
+        graph.DropNode(multiply);
+        graph.DropNode(convert);
+        node->setOriginalInputPrecisionAtPort(0, Precision::I8);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseConvolutionAndBias(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
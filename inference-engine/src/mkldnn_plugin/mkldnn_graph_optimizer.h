@@ -19,6 +19,9 @@ public:
     void ApplyImplSpecificGraphOptimizations(MKLDNNGraph& graph);
 
 private:
+    void FuseFullyConnectedAndWeightsDecompression(MKLDNNGraph &graph);
+    void FuseRNNAndDequantization(MKLDNNGraph &graph);
+    void FuseEmbeddingBagAndTableDequantization(MKLDNNGraph &graph);
     void FuseConvolutionAndBias(MKLDNNGraph &graph);
     void FuseDeconvolutionAndSimpleOperation(MKLDNNGraph &graph);
     void FuseMultiplyAndAdd(MKLDNNGraph &graph);
@@ -8,8 +8,6 @@
 #include <string>
 #include <map>
 #include <blob_factory.hpp>
-#include <nodes/mkldnn_concat_node.h>
-#include <nodes/mkldnn_split_node.h>
 #include <ie_compound_blob.h>
 #include <ie_common.h>
 #include "mkldnn_exec_network.h"
@@ -20,6 +18,7 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "mkldnn_async_infer_request.h"
 #include <debug.h>
+#include <algorithm>
 #include "utils/general_utils.h"
 #include "utils/cpu_utils.hpp"
 
@@ -69,6 +68,7 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
 
 MKLDNNPlugin::MKLDNNInferRequest::~MKLDNNInferRequest() {
     --(execNetwork->_numRequests);
+    execNetwork->stateStore->unlock(stateSessionIds);
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision inPrec) {
@@ -95,7 +95,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, I
         cpu_convert(srcData, dstData, inputBlob->getTensorDesc().getPrecision(), iconv->getTensorDesc().getPrecision(), iconv->size());
     }
 
-    graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
+    // the converted blob is reused by the next inference, so only the user blob may be bound to the graph input
+    graph->PushInputData(inputName, needConvert ? iconv : inputBlob, !needConvert);
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
@@ -131,12 +132,10 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+                    auto cur_state = getBoundState(cur_id);
+                    if (sessionStates.size() > 1)
+                        cur_state->gatherRows(getSessionStates(cur_id));
+                    cur_node->bindState(cur_state->getReadBuffer(), cur_state->getWriteBuffer());
                 }
             }
         }
@@ -147,15 +146,17 @@ void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
             auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+            // the state is kept if there is no Assign or it is constant and isn't executed by the inference
+            if (!cur_node->isStateWritten())
+                continue;
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                    // Assign has written the next state to the write buffer
+                    auto cur_state = getBoundState(cur_id);
+                    cur_state->swapBuffers();
+                    if (sessionStates.size() > 1)
+                        cur_state->scatterRows(getSessionStates(cur_id));
                 }
             }
         }
@@ -238,10 +239,6 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
 
         _inputs[name] = make_blob_with_precision(desc);
         _inputs[name]->allocate();
-        if (blobs[name]->getTensorDesc() == desc &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
-            externalPtr[name] = _inputs[name]->buffer();
-        }
         data = _inputs[name];
         checkBlob(data, name, true);
         return data;
@@ -338,12 +335,6 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             if (blobs.find(name) == blobs.end())
                 IE_THROW() << "MKLDNN graph doesn't contain input node with name: " << name;
 
-            if (data->getTensorDesc() == blobs.at(name)->getTensorDesc() &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
-                externalPtr[name] = data->buffer();
-            } else if (externalPtr.find(name) != externalPtr.end()) {
-                externalPtr.erase(name);
-            }
             _inputs[name] = data;
         }
     } else {
@@ -391,39 +382,6 @@ static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *
 
 void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
     for (auto& it : externalPtr) {
-        auto input = graph->inputNodesMap.find(it.first);
-        if (input != graph->inputNodesMap.end()) {
-            if (input->second->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
-                continue;
-            // Input cannot be in-place with other primitives
-            bool canBeInPlace = true;
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                auto& child = input->second->getChildEdgeAt(i)->getChild();
-                if (child->isConstant())
-                    canBeInPlace = false;
-                auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
-                if (canBeInPlace && concat && concat->isOptimized())
-                    canBeInPlace = false;
-
-                // Cannot be in-place before split because split is using different ptrs without offsets
-                auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
-                if (canBeInPlace && split)
-                    canBeInPlace = false;
-
-                if (child->isInplace())
-                    canBeInPlace = false;
-                for (size_t j = 0; canBeInPlace && j < child->getChildEdges().size(); j++) {
-                    if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
-                            input->second->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
-                        canBeInPlace = false;
-                }
-            }
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                changeEdgePtr(input->second->getChildEdgeAt(i), it.second);
-            }
-            continue;
-        }
-
         MKLDNNNodePtr output;
         for (auto& out : graph->outputNodesMap) {
             if (out.first == it.first) {
@@ -457,7 +415,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
                 changeEdgePtr(output->getParentEdgeAt(0), it.second);
             continue;
         }
-        IE_THROW() << "Cannot find input/output blob: " << it.first;
+        IE_THROW() << "Cannot find output blob: " << it.first;
     }
 }
 
@@ -475,9 +433,77 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBatch(int new_batch) {
 }
 
 std::vector<InferenceEngine::IVariableStateInternal::Ptr> MKLDNNPlugin::MKLDNNInferRequest::QueryState() {
+    // states of several sessions are available as batched states gathered for the last inference
+    if (sessionStates.size() == 1)
+        return {sessionStates.front().begin(), sessionStates.front().end()};
+    if (sessionStates.size() > 1)
+        return {sessionBatchStates.begin(), sessionBatchStates.end()};
     return memoryStates;
 }
 
+void MKLDNNPlugin::MKLDNNInferRequest::SetStateSessions(const std::vector<std::string>& sessionIds) {
+    if (!sessionIds.empty()) {
+        for (const auto& state : memoryStates) {
+            const auto& dims = state->GetState()->getTensorDesc().getDims();
+            const size_t batch = dims.empty() ? 1 : dims[0];
+            if (batch != sessionIds.size())
+                IE_THROW() << "Number of state sessions " << sessionIds.size()
+                           << " doesn't match the batch " << batch << " of state " << state->GetName();
+        }
+    }
+
+    // the current sessions stay locked if the new ones can't be locked
+    sessionStates = execNetwork->stateStore->lock(sessionIds, stateSessionIds);
+    stateSessionIds = sessionIds;
+
+    // several sessions are gathered to the separate batched states, so the own states of the request are kept
+    if (sessionStates.size() > 1 && sessionBatchStates.empty()) {
+        for (const auto& state : memoryStates) {
+            auto memoryState = std::dynamic_pointer_cast<MKLDNNVariableState>(state);
+            IE_ASSERT(memoryState != nullptr);
+            sessionBatchStates.push_back(std::make_shared<MKLDNNVariableState>(memoryState->GetName(), memoryState->getDesc()));
+        }
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::ReleaseStateSession(const std::string& sessionId) {
+    execNetwork->stateStore->release(sessionId);
+}
+
+MKLDNNPlugin::MKLDNNVariableState::Ptr MKLDNNPlugin::MKLDNNInferRequest::getBoundState(const std::string& name) const {
+    // the single session state is bound to the graph directly
+    if (sessionStates.size() == 1)
+        return getSessionStates(name).front();
+
+    if (sessionStates.size() > 1) {
+        for (const auto& state : sessionBatchStates) {
+            if (state->GetName() == name)
+                return state;
+        }
+    } else {
+        for (const auto& state : memoryStates) {
+            if (state->GetName() == name) {
+                auto memoryState = std::dynamic_pointer_cast<MKLDNNVariableState>(state);
+                IE_ASSERT(memoryState != nullptr);
+                return memoryState;
+            }
+        }
+    }
+    IE_THROW() << "Cannot find state " << name;
+}
+
+MKLDNNPlugin::MKLDNNVariableStateStore::States MKLDNNPlugin::MKLDNNInferRequest::getSessionStates(const std::string& name) const {
+    MKLDNNVariableStateStore::States states;
+    for (const auto& session : sessionStates) {
+        auto state = std::find_if(session.begin(), session.end(), [&](const MKLDNNVariableState::Ptr& sessionState) {
+            return sessionState->GetName() == name;
+        });
+        IE_ASSERT(state != session.end());
+        states.push_back(*state);
+    }
+    return states;
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::SetAsyncRequest(MKLDNNAsyncInferRequest* asyncRequest) {
     _asyncRequest = asyncRequest;
 }
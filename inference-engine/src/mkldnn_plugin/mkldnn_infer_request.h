@@ -5,9 +5,11 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include "mkldnn_memory_state.h"
 #include <memory>
 #include <string>
 #include <map>
+#include <vector>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
@@ -36,6 +38,10 @@ public:
 
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> QueryState() override;
 
+    void SetStateSessions(const std::vector<std::string>& sessionIds) override;
+
+    void ReleaseStateSession(const std::string& sessionId) override;
+
     /**
      * @brief      Sets the pointer to asynchronous inference request that holds this request
      * @param[in]  asyncRequest Pointer to asynchronous inference request
@@ -51,6 +57,12 @@ private:
     void PushInputData();
     void PushStates();
     void PullStates();
+    MKLDNNVariableStateStore::States getSessionStates(const std::string& name) const;
+    /**
+     * @brief Returns the state whose buffers are bound to the graph: the own state of the request, the state of
+     * the single session or the batched state gathered from several sessions
+     */
+    MKLDNNVariableState::Ptr getBoundState(const std::string& name) const;
 
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
@@ -60,6 +72,9 @@ private:
     std::map<std::string, void*>        externalPtr;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
+    std::vector<std::string>            stateSessionIds;
+    std::vector<MKLDNNVariableStateStore::States> sessionStates;
+    MKLDNNVariableStateStore::States    sessionBatchStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
 };
 }  // namespace MKLDNNPlugin
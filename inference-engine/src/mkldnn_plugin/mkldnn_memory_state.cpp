@@ -6,24 +6,234 @@
 #include "mkldnn_extension_utils.h"
 #include "blob_factory.hpp"
 
+#include <algorithm>
+#include <new>
+
 using namespace InferenceEngine;
 
 namespace MKLDNNPlugin {
 
+namespace {
+
+/**
+ * @brief Returns size in bytes from the begin of the data to the last element of the blocked layout
+ */
+size_t getPaddedByteSize(const TensorDesc& desc) {
+    const auto& blockingDesc = desc.getBlockingDesc();
+    const auto& blockDims = blockingDesc.getBlockDims();
+    if (blockDims.empty())
+        return desc.getPrecision().size();
+
+    size_t size = blockingDesc.getOffsetPadding() + 1;
+    size_t minSize = 1;
+    for (size_t i = 0; i < blockDims.size(); i++) {
+        size += (blockDims[i] - 1) * blockingDesc.getStrides()[i];
+        minSize *= blockDims[i];
+    }
+    return std::max(size, minSize) * desc.getPrecision().size();
+}
+
+/**
+ * @brief Allocates at least the padded size of the state, TBlob requests the size of the logical dims only
+ */
+class PaddedStateAllocator : public IAllocator {
+public:
+    explicit PaddedStateAllocator(size_t size) : size(size) {}
+
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t requested) noexcept override {
+        return new (std::nothrow) uint8_t[std::max(requested, size)];
+    }
+
+    bool free(void* handle) noexcept override {
+        delete[] static_cast<uint8_t*>(handle);
+        return true;
+    }
+
+private:
+    size_t size;
+};
+
+}  // namespace
+
+MKLDNNVariableState::MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
+        name(name) {
+    allocateBuffers(MKLDNNMemoryDesc(storage->GetDescriptor()));
+    IE_ASSERT(storage->GetSize() <= bufferSize);
+    cpu_memcpy(buffers[readIdx]->buffer(), storage->GetData(), storage->GetSize());
+}
+
+MKLDNNVariableState::MKLDNNVariableState(std::string name, const TensorDesc& desc) :
+        name(name) {
+    allocateBuffers(desc);
+    Reset();
+}
+
+void MKLDNNVariableState::allocateBuffers(const TensorDesc& stateDesc) {
+    desc = stateDesc;
+    bufferSize = getPaddedByteSize(desc);
+    auto allocator = std::make_shared<PaddedStateAllocator>(bufferSize);
+    for (auto& buffer : buffers) {
+        buffer = make_blob_with_precision(desc, allocator);
+        buffer->allocate();
+    }
+}
+
 std::string  MKLDNNVariableState::GetName() const {
     return name;
 }
 
 void  MKLDNNVariableState::Reset() {
-    std::memset(this->storage->buffer(), 0, storage->byteSize());
+    std::memset(buffers[readIdx]->buffer(), 0, bufferSize);
 }
 
 void  MKLDNNVariableState::SetState(Blob::Ptr newState) {
-    storage = newState;
+    if (newState->byteSize() != buffers[readIdx]->byteSize())
+        IE_THROW() << "Cannot set state " << name << ": blob size " << newState->byteSize()
+                   << " doesn't match the state size " << buffers[readIdx]->byteSize();
+    if (newState->byteSize() == bufferSize) {
+        buffers[readIdx] = newState;
+        return;
+    }
+
+    // the graph accesses the whole padded buffer, so the padded state is copied to the own buffer
+    cpu_memcpy(buffers[readIdx]->buffer(), newState->cbuffer(), newState->byteSize());
 }
 
 InferenceEngine::Blob::CPtr MKLDNNVariableState::GetState() const {
-    return storage;
+    return buffers[readIdx];
+}
+
+void* MKLDNNVariableState::getReadBuffer() const {
+    return buffers[readIdx]->buffer();
+}
+
+void* MKLDNNVariableState::getWriteBuffer() const {
+    return buffers[readIdx ^ 1]->buffer();
+}
+
+void MKLDNNVariableState::swapBuffers() {
+    readIdx ^= 1;
+}
+
+size_t MKLDNNVariableState::getRowStride() const {
+    return desc.getBlockingDesc().getStrides().front() * desc.getPrecision().size();
+}
+
+void MKLDNNVariableState::gatherRows(const std::vector<Ptr>& rows) {
+    const size_t rowStride = getRowStride();
+    auto dst = static_cast<uint8_t*>(getReadBuffer());
+    for (size_t i = 0; i < rows.size(); i++) {
+        IE_ASSERT(rows[i]->bufferSize <= rowStride);
+        cpu_memcpy(dst + i * rowStride, rows[i]->getReadBuffer(), rows[i]->bufferSize);
+    }
+}
+
+void MKLDNNVariableState::scatterRows(const std::vector<Ptr>& rows) const {
+    const size_t rowStride = getRowStride();
+    auto src = static_cast<const uint8_t*>(getReadBuffer());
+    for (size_t i = 0; i < rows.size(); i++) {
+        IE_ASSERT(rows[i]->bufferSize <= rowStride);
+        cpu_memcpy(rows[i]->getReadBuffer(), src + i * rowStride, rows[i]->bufferSize);
+    }
+}
+
+MKLDNNVariableStateStore::MKLDNNVariableStateStore(std::vector<std::pair<std::string, TensorDesc>> variables) {
+    for (auto& variable : variables) {
+        auto& desc = variable.second;
+        if (desc.getDims().empty() || desc.getDims()[0] == 1) {
+            this->variables.push_back(variable);
+            continue;
+        }
+
+        // session keeps one batch item, so the batch has to be the outermost not blocked dimension of the state
+        const auto& blockingDesc = desc.getBlockingDesc();
+        const auto& order = blockingDesc.getOrder();
+        if (order.empty() || order[0] != 0 || std::count(order.begin(), order.end(), 0) != 1 ||
+                blockingDesc.getOffsetPadding() != 0) {
+            unsupportedVariable = variable.first;
+            continue;
+        }
+
+        // the batch item keeps blocking, strides and padding of the batched state, so its rows are copied as is
+        auto dims = desc.getDims();
+        dims[0] = 1;
+        auto blockDims = blockingDesc.getBlockDims();
+        blockDims[0] = 1;
+        BlockingDesc itemBlockingDesc(blockDims, order, blockingDesc.getOffsetPadding(),
+                                      blockingDesc.getOffsetPaddingToData(), blockingDesc.getStrides());
+        this->variables.emplace_back(variable.first, TensorDesc(desc.getPrecision(), dims, itemBlockingDesc));
+    }
+}
+
+std::vector<MKLDNNVariableStateStore::States> MKLDNNVariableStateStore::lock(const std::vector<std::string>& sessionIds,
+                                                                            const std::vector<std::string>& lockedSessionIds) {
+    if (!sessionIds.empty() && !unsupportedVariable.empty())
+        IE_THROW() << "State " << unsupportedVariable << " can't be split to the batch items of the sessions";
+
+    auto isLockedByCaller = [&](const std::string& sessionId) {
+        return std::find(lockedSessionIds.begin(), lockedSessionIds.end(), sessionId) != lockedSessionIds.end();
+    };
+
+    std::lock_guard<std::mutex> lock{mutex};
+    for (const auto& sessionId : sessionIds) {
+        auto session = sessions.find(sessionId);
+        if (session != sessions.end() && session->second.locked && !isLockedByCaller(sessionId))
+            IE_THROW() << "State session " << sessionId << " is used by another infer request";
+        if (std::count(sessionIds.begin(), sessionIds.end(), sessionId) != 1)
+            IE_THROW() << "State session " << sessionId << " is used more than once in the batch";
+    }
+
+    std::vector<States> result;
+    for (const auto& sessionId : sessionIds) {
+        auto& session = sessions[sessionId];
+        if (session.states.empty()) {
+            if (!pool.empty()) {
+                session.states = std::move(pool.back());
+                pool.pop_back();
+            } else {
+                for (const auto& variable : variables)
+                    session.states.push_back(std::make_shared<MKLDNNVariableState>(variable.first, variable.second));
+            }
+        }
+        session.locked = true;
+        result.push_back(session.states);
+    }
+
+    for (const auto& sessionId : lockedSessionIds) {
+        auto session = sessions.find(sessionId);
+        if (session != sessions.end() && std::find(sessionIds.begin(), sessionIds.end(), sessionId) == sessionIds.end())
+            session->second.locked = false;
+    }
+    return result;
+}
+
+void MKLDNNVariableStateStore::unlock(const std::vector<std::string>& sessionIds) {
+    std::lock_guard<std::mutex> lock{mutex};
+    for (const auto& sessionId : sessionIds) {
+        auto session = sessions.find(sessionId);
+        if (session != sessions.end())
+            session->second.locked = false;
+    }
+}
+
+void MKLDNNVariableStateStore::release(const std::string& sessionId) {
+    std::lock_guard<std::mutex> lock{mutex};
+    auto session = sessions.find(sessionId);
+    if (session == sessions.end())
+        return;
+    if (session->second.locked)
+        IE_THROW() << "Cannot release state session " << sessionId << " used by an infer request";
+
+    for (auto& state : session->second.states)
+        state->Reset();
+    pool.push_back(std::move(session->second.states));
+    sessions.erase(session);
 }
 
 }  // namespace MKLDNNPlugin
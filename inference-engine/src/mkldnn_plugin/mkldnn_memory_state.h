@@ -10,26 +10,101 @@
 #include "nodes/common/cpu_memcpy.h"
 
 #include <string>
+#include <vector>
+#include <mutex>
+#include <unordered_map>
 
 namespace MKLDNNPlugin {
 
+/**
+ * @brief Variable state keeps two buffers: the current state read by ReadValue and the next state written by Assign.
+ * Buffers are swapped after each inference, so the state is not copied between the graph and the request.
+ */
 class MKLDNNVariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
-            name(name) {
-        this->storage = make_blob_with_precision(MKLDNNMemoryDesc(storage->GetDescriptor()));
-        this->storage->allocate();
-        cpu_memcpy(this->storage->buffer(), storage->GetData(), storage->GetSize());
-    }
+    typedef std::shared_ptr<MKLDNNVariableState> Ptr;
+
+    MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage);
+
+    /**
+     * @brief Creates zero filled state
+     */
+    MKLDNNVariableState(std::string name, const InferenceEngine::TensorDesc& desc);
 
     std::string GetName() const override;
     void Reset() override;
     void SetState(InferenceEngine::Blob::Ptr newState) override;
     InferenceEngine::Blob::CPtr GetState() const override;
 
+    const InferenceEngine::TensorDesc& getDesc() const {
+        return desc;
+    }
+
+    void* getReadBuffer() const;
+    void* getWriteBuffer() const;
+    void swapBuffers();
+
+    /**
+     * @brief Copies current states of the batch items to the batch rows of the current state
+     */
+    void gatherRows(const std::vector<Ptr>& rows);
+
+    /**
+     * @brief Copies batch rows of the current state to the current states of the batch items
+     */
+    void scatterRows(const std::vector<Ptr>& rows) const;
+
 private:
+    /**
+     * @brief Allocates both buffers of the full size of the blocked descriptor including padding,
+     * since the buffers are bound to the graph memory of the same layout
+     */
+    void allocateBuffers(const InferenceEngine::TensorDesc& desc);
+    size_t getRowStride() const;
+
     std::string name;
-    InferenceEngine::Blob::Ptr storage;
+    InferenceEngine::TensorDesc desc;
+    InferenceEngine::Blob::Ptr buffers[2];
+    size_t bufferSize = 0;
+    size_t readIdx = 0;
+};
+
+/**
+ * @brief Keeps variable states of named sessions, it is shared by all infer requests of the executable network.
+ * Each session state holds one batch item of the network states. States of the released sessions are
+ * returned to the pool and reused by new sessions.
+ */
+class MKLDNNVariableStateStore {
+public:
+    typedef std::shared_ptr<MKLDNNVariableStateStore> Ptr;
+    typedef std::vector<MKLDNNVariableState::Ptr> States;
+
+    /**
+     * @param variables names and descriptors of the network states
+     */
+    explicit MKLDNNVariableStateStore(std::vector<std::pair<std::string, InferenceEngine::TensorDesc>> variables);
+
+    /**
+     * @brief Returns states of the sessions, new sessions are created with default states.
+     * Sessions are locked for other requests until they are unlocked.
+     * @param lockedSessionIds sessions already locked by the caller, the ones missing in @p sessionIds are unlocked
+     * after the new sessions are locked, nothing is changed if the new sessions can't be locked
+     */
+    std::vector<States> lock(const std::vector<std::string>& sessionIds, const std::vector<std::string>& lockedSessionIds = {});
+    void unlock(const std::vector<std::string>& sessionIds);
+    void release(const std::string& sessionId);
+
+private:
+    struct Session {
+        States states;
+        bool locked = false;
+    };
+
+    std::vector<std::pair<std::string, InferenceEngine::TensorDesc>> variables;
+    std::string unsupportedVariable;
+    std::unordered_map<std::string, Session> sessions;
+    std::vector<States> pool;
+    std::mutex mutex;
 };
 
 }  // namespace MKLDNNPlugin
\ No newline at end of file
@@ -180,6 +180,7 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "ShuffleChannels", ShuffleChannels},
         { "DFT", DFT},
         { "IDFT", DFT},
+        { "Einsum", Einsum},
         { "Abs", Math},
         { "Acos", Math},
         { "Acosh", Math},
@@ -503,6 +504,7 @@ std::string MKLDNNNode::getPrimitiveDescriptorType() {
     SEARCH_TYPE(winograd);
     SEARCH_TYPE(_dw);
     SEARCH_TYPE(_1x1);
+    SEARCH_TYPE(sparse);
 
     if (type == impl_desc_type::unknown)
         str_type = "unknown";
@@ -774,19 +776,14 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
         intDescs.push_back(it(itpd, 0));
 
     internalBlobMemory.clear();
+    internalBlobKeys.clear();
     for (size_t i = 0; i < internalBlobs.size(); i++) {
         const auto &internalBlob = internalBlobs[i];
 
+        // the memory is only allocated here, fillInternalBlobMemory() reorders the data into it
         auto create = [&] () {
-            auto newDesc = MKLDNNMemoryDesc(internalBlob->getTensorDesc());
-
-            MKLDNNMemory memory{ engine };
-            memory.Create(newDesc, internalBlob->buffer());
-
             MKLDNNMemoryPtr _ptr = MKLDNNMemoryPtr(new MKLDNNMemory(engine));
             _ptr->Create(intDescs[i]);
-            _ptr->SetData(memory);
-
             return _ptr;
         };
 
@@ -799,7 +796,8 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
                                             + "_" + std::to_string(internalBlob->byteSize())
                                             + "_" + std::to_string(data_hash);
 
-            ptr = *weightCache->findOrCreate(string_hash, create);
+            ptr = *weightCache->findOrCreate(string_hash, create, false);
+            internalBlobKeys.push_back(string_hash);
         } else {
             ptr = create();
         }
@@ -808,6 +806,29 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
     }
 }
 
+void MKLDNNNode::fillInternalBlobMemory() {
+    for (size_t i = 0; i < internalBlobs.size() && i < internalBlobMemory.size(); i++) {
+        const auto &internalBlob = internalBlobs[i];
+
+        auto fill = [&] () {
+            MKLDNNMemory memory{ engine };
+            memory.Create(MKLDNNMemoryDesc(internalBlob->getTensorDesc()), internalBlob->buffer());
+            internalBlobMemory[i]->SetData(memory);
+        };
+
+        if (i < internalBlobKeys.size()) {
+            // the memory shared between the streams is filled by the first graph, the others wait for it
+            auto sharedMemory = weightCache->get(internalBlobKeys[i]);
+            if (!sharedMemory->isValid()) {
+                fill();
+                sharedMemory->valid(true);
+            }
+        } else {
+            fill();
+        }
+    }
+}
+
 bool MKLDNNNode::isInplace() const {
     auto selected_pd = getSelectedPrimitiveDescriptor();
     if (selected_pd == nullptr)
@@ -1137,6 +1158,16 @@ void MKLDNNNode::setDynamicBatchLim(int lim) {
     }
 }
 
+void MKLDNNNode::rebindPrimArgs(const void* oldData, size_t size, void* newData) {
+    auto oldBegin = static_cast<const uint8_t*>(oldData);
+    for (auto& arg : primArgs) {
+        auto data = static_cast<const uint8_t*>(arg.second.get_data_handle());
+        if (data >= oldBegin && data < oldBegin + size)
+            arg.second = mkldnn::memory(arg.second.get_desc(), arg.second.get_engine(),
+                                        static_cast<uint8_t*>(newData) + (data - oldBegin));
+    }
+}
+
 bool MKLDNNNode::isFusedWith(Type fusedNodeType) const {
     for (auto fusedNode : fusedWith) {
         if (fusedNode->type == fusedNodeType)
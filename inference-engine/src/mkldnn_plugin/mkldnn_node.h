@@ -150,6 +150,8 @@ static std::string NameFromType(Type type) {
             return "DFT";
         case Math:
             return "Math";
+        case Einsum:
+            return "Einsum";
         default:
             return "Unknown";
     }
@@ -281,6 +283,12 @@ public:
     virtual void cleanup();
     void remove();
 
+    /**
+     * @brief Reorders the internal blobs data into the memory allocated for them when the primitive was created.
+     * The nodes don't depend on each other here, so the graph fills the memory of all the nodes in parallel.
+     */
+    void fillInternalBlobMemory();
+
     const std::vector<MKLDNNEdgeWeakPtr> &getParentEdges() const noexcept {
         return parentEdges;
     }
@@ -409,6 +417,12 @@ public:
 
     virtual void setDynamicBatchLim(int lim);
 
+    /**
+     * @brief Makes the primitive arguments pointing to the data in [oldData, oldData + size) point to the same offsets
+     * of newData
+     */
+    void rebindPrimArgs(const void* oldData, size_t size, void* newData);
+
     void resolveNotAllocatedEdges();
     virtual void execute(mkldnn::stream strm);
     virtual void initSupportedPrimitiveDescriptors();
@@ -586,6 +600,16 @@ public:
         return false;
     }
 
+    /**
+     * @brief Checks whether the node reads the data of the input port from the edge memory on each execution.
+     * Only such inputs may be fed by the constants replaced after the graph is compiled. The main data input is
+     * always read on execution, the other inputs are often consumed by the node constructor or during compilation.
+     * @param port input port index
+     */
+    virtual bool readsInputOnExecute(size_t port) const {
+        return port == 0;
+    }
+
     void setQuantizedGraphFlag(bool flag) {
         isInQuantizedGraph = flag;
     }
@@ -646,6 +670,8 @@ protected:
     ConstantType constant = ConstantType::Unknown;
     std::vector<InferenceEngine::Blob::Ptr> internalBlobs;
     std::vector<MKLDNNMemoryPtr> internalBlobMemory;
+    // weights cache keys of the internal blobs memory
+    std::vector<std::string> internalBlobKeys;
     std::vector<PrimitiveDescInfo> supportedPrimitiveDescriptors;
     std::unordered_map<int, mkldnn::memory> primArgs;
     MKLDNNPrimitive prim;
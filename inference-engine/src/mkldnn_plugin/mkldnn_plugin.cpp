@@ -51,6 +51,7 @@
 #include <transformations/op_conversions/rnn_cell_decomposition.hpp>
 #include <transformations/op_conversions/gru_cell_decomposition.hpp>
 #include <transformations/op_conversions/log_softmax_decomposition.hpp>
+#include <transformations/op_conversions/einsum_decomposition.hpp>
 #include <transformations/op_conversions/convert_interpolate1_to_interpolate4.hpp>
 #include <transformations/op_conversions/convert_shuffle_channels3.hpp>
 #include <transformations/op_conversions/simplify_ctc_greedy_decoder_seq_len.hpp>
@@ -81,13 +82,19 @@
 #include <low_precision/convolution_backprop_data.hpp>
 #include <low_precision/group_convolution.hpp>
 #include <low_precision/multiply_to_group_convolution.hpp>
+#include <low_precision/recurrent_cell.hpp>
 #include <low_precision/network_helper.hpp>
 
 #include <ie_algorithm.hpp>
 
 #include "nodes/mkldnn_mvn_node.h"
 #include "nodes/mkldnn_fake_quantize_node.h"
+#include "nodes/mkldnn_einsum_node.h"
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
+#include "ngraph_transformations/fc_weights_decompression.hpp"
+#include "ngraph_transformations/embedding_table_decompression.hpp"
+#include "ngraph_transformations/preprocessing.hpp"
+#include "ngraph_transformations/op/fully_connected.hpp"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
 # ifdef _WIN32
@@ -112,11 +119,13 @@ Engine::~Engine() {
     ExecutorManager::getInstance()->clear("CPUCallbackExecutor");
 }
 
-static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
+void Engine::Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     auto nGraphFunc = clonedNetwork.getFunction();
 
     ngraph::pass::Manager manager;
     manager.register_pass<ngraph::pass::InitNodeInfo>();
+    // Mean and scale pre-processing is executed inside the graph instead of the infer request
+    manager.register_pass<AddPreprocessing>(clonedNetwork.getInputsInfo());
 
     const bool useLpt =
         (conf.lpTransformsMode == Config::LPTransformsMode::On) &&
@@ -125,6 +134,11 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
         manager.register_pass<ngraph::pass::DisableConvertConstantFoldingOnConstPath>(
             std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8, ngraph::element::i4, ngraph::element::u4 });
     }
+    // Compressed weights of MatMuls with a few source rows are kept as is and decompressed inside FullyConnected kernel
+    if (conf.fcInt8WeiDecompressionMaxRows > 0)
+        manager.register_pass<MarkFCWeightsDecompression>(static_cast<size_t>(conf.fcInt8WeiDecompressionMaxRows));
+    // Int8 embedding tables are dequantized inside EmbeddingBag kernels
+    manager.register_pass<MarkEmbeddingTableDecompression>();
 
     auto get_convert_precisions = []() {
         precisions_array array = {
@@ -171,7 +185,12 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
         manager.register_pass<ngraph::pass::low_precision::ConvertSubtractConstant>(
             std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8, ngraph::element::i4, ngraph::element::u4 });
     }
-    manager.register_pass<ngraph::pass::ConvertPrecision>(precisions);
+    // FP16 weights of bandwidth bound MatMuls are kept in FP16 and expanded inside FullyConnected kernel
+    if (conf.fcFp16WeiDecompressionMaxRows > 0)
+        manager.register_pass<MarkFCWeightsFP16Decompression>(static_cast<size_t>(conf.fcFp16WeiDecompressionMaxRows));
+    // weights decompressed by the Converts marked above keep their precision
+    manager.register_pass<ngraph::pass::ConvertPrecision>(precisions, type_to_fuse_map{}, true);
+    manager.register_pass<FoldPreprocessingIntoConvolution>();
 
     auto pass_config = manager.get_pass_config();
 
@@ -272,6 +291,12 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
                 return MKLDNNMVNNode::isSupportedOperation(node, errorMessage);
             });
 
+    pass_config->set_callback<ngraph::pass::EinsumDecomposition>(
+            [](const_node_ptr &node) -> bool {
+                std::string errorMessage;
+                return MKLDNNEinsumNode::isSupportedOperation(node, errorMessage);
+            });
+
     pass_config->set_callback<ngraph::pass::SoftmaxFusion>(
             [](const_node_ptr &node) -> bool {
                 return node->input_value(0).get_partial_shape().rank().get_length() > 5;
@@ -300,12 +325,13 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
         pass_config->set_callback<ngraph::pass::ConvertQuantizeDequantize>([](const_node_ptr &node) -> bool {
             return ngraph::pass::low_precision::NetworkHelper::areQuantizeAndDequantizeSupportedForMultiply(node);
         });
-
-        pass_config->set_callback<ngraph::pass::ConvertSubtract>([](const_node_ptr &node) -> bool {
-            return ngraph::pass::low_precision::NetworkHelper::areQuantizeAndDequantizeSupportedForSubtract(node);
-        });
     }
 
+    pass_config->set_callback<ngraph::pass::ConvertSubtract>([useLpt](const_node_ptr &node) -> bool {
+        return isFCWeightsDecompressionSubtract(node) ||
+               (useLpt && ngraph::pass::low_precision::NetworkHelper::areQuantizeAndDequantizeSupportedForSubtract(node));
+    });
+
     manager.run_passes(nGraphFunc);
 
     using namespace ngraph::pass::low_precision;
@@ -333,7 +359,11 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
             .addStandaloneCleanup<MultiplyToGroupConvolutionTransformation, ngraph::opset1::Multiply>(
                 LayerTransformation::Params(params).setPrecisionsOnActivations({ ngraph::element::u8 }))
             .add<ConvolutionBackpropDataTransformation, ngraph::opset1::ConvolutionBackpropData>(
-                    LayerTransformation::Params(params).setSupportAsymmetricQuantization(false)));
+                    LayerTransformation::Params(params).setSupportAsymmetricQuantization(false))
+            .add<RecurrentCellTransformation, ngraph::opset6::LSTMSequence>(
+                LayerTransformation::Params(params).setPrecisionsOnActivations({ ngraph::element::u8 }))
+            .add<RecurrentCellTransformation, ngraph::opset6::GRUSequence>(
+                LayerTransformation::Params(params).setPrecisionsOnActivations({ ngraph::element::u8 })));
 
         transformer.transform(nGraphFunc);
     }
@@ -367,6 +397,15 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     postLPTPassManager.run_passes(nGraphFunc);
 
     ConvertToCPUSpecificOpset(nGraphFunc);
+
+    // FullyConnected nodes read the rate from rt_info, as the other per node options
+    if (conf.fcSparseWeiDecompressionRate < 1.f) {
+        for (auto& node : nGraphFunc->get_ordered_ops()) {
+            if (std::dynamic_pointer_cast<FullyConnectedNode>(node))
+                node->get_rt_info()["sparseWeightsDecompressionRate"] =
+                    std::make_shared<ngraph::VariantWrapper<std::string>>(std::to_string(conf.fcSparseWeiDecompressionRate));
+        }
+    }
 }
 
 InferenceEngine::ExecutableNetworkInternal::Ptr
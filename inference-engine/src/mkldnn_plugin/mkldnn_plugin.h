@@ -36,6 +36,12 @@ public:
     InferenceEngine::QueryNetworkResult QueryNetwork(const InferenceEngine::CNNNetwork& network,
                                                      const std::map<std::string, std::string>& config) const override;
 
+    /**
+     * @brief Converts the network to the CPU specific operation set, the executable network is created from
+     * the converted network
+     */
+    static void Transformation(InferenceEngine::CNNNetwork& clonedNetwork, const Config& conf);
+
 private:
     Config engConfig;
     NumaNodesWeights weightsSharing;
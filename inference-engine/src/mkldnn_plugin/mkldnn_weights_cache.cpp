@@ -36,23 +36,28 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::findOrCreate
                             const std::string& key,
                             std::function<MKLDNNMemoryPtr(void)> create,
                             bool valid) {
-    std::unique_lock<std::mutex> lock(guard);
-    auto found = sharedWeights.find(key);
-
     MKLDNNMemoryInfo::Ptr ptr;
-    MKLDNNMemoryPtr newPtr;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto& found = sharedWeights[key];
+        if (!found)
+            found = std::make_shared<MKLDNNMemoryInfo>(nullptr, valid);
+        ptr = found;
+    }
 
-    if (found == sharedWeights.end()
-        || !(ptr = found->second)
-        || ptr->sharedMemory.expired()) {
+    // the memory is created under the key lock only, so the graphs of the different streams may create
+    // the memory for the different keys at the same time
+    std::unique_lock<std::mutex> memoryLock(ptr->guard);
+    MKLDNNMemoryPtr newPtr;
+    if (ptr->sharedMemory.expired()) {
         newPtr = create();
-        ptr = std::make_shared<MKLDNNMemoryInfo>(newPtr, valid);
-        sharedWeights[key] = ptr;
+        ptr->sharedMemory = newPtr;
+        ptr->valid = valid;
     }
 
-    return std::make_shared<MKLDNNSharedMemory>(ptr->valid
-                                                ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
-                                                : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
+    if (ptr->valid)
+        memoryLock.unlock();
+    return std::make_shared<MKLDNNSharedMemory>(std::move(memoryLock), ptr, newPtr);
 }
 
 MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const std::string& key) const {
@@ -0,0 +1,50 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_table_decompression.hpp"
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/variant.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::MarkEmbeddingTableDecompression, "MarkEmbeddingTableDecompression", 0);
+
+MKLDNNPlugin::MarkEmbeddingTableDecompression::MarkEmbeddingTableDecompression() {
+    auto m_embedding = ngraph::pattern::wrap_type<ngraph::opset3::EmbeddingBagOffsetsSum,
+                                                  ngraph::opset3::EmbeddingBagPackedSum,
+                                                  ngraph::opset3::EmbeddingSegmentsSum>();
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto embedding = m.get_match_root();
+        auto multiply = std::dynamic_pointer_cast<ngraph::opset3::Multiply>(embedding->get_input_node_shared_ptr(0));
+        if (!multiply) {
+            return false;
+        }
+
+        const size_t scalePort = ngraph::is_type<ngraph::opset3::Constant>(multiply->get_input_node_ptr(1)) ? 1 : 0;
+        auto scale = std::dynamic_pointer_cast<ngraph::opset3::Constant>(multiply->get_input_node_shared_ptr(scalePort));
+        auto convert = std::dynamic_pointer_cast<ngraph::opset3::Convert>(multiply->get_input_node_shared_ptr(1 - scalePort));
+        if (!scale || !convert || multiply->get_output_target_inputs(0).size() != 1 ||
+            convert->get_output_target_inputs(0).size() != 1 || convert->get_output_element_type(0) != ngraph::element::f32) {
+            return false;
+        }
+
+        auto table = std::dynamic_pointer_cast<ngraph::opset3::Constant>(convert->get_input_node_shared_ptr(0));
+        if (!table || table->get_element_type() != ngraph::element::i8 || table->get_shape().size() < 2) {
+            return false;
+        }
+
+        const size_t rows = table->get_shape()[0];
+        const auto& scaleShape = scale->get_shape();
+        if (ngraph::shape_size(scaleShape) != 1 &&
+            !(ngraph::shape_size(scaleShape) == rows && scaleShape.size() == table->get_shape().size() && scaleShape[0] == rows)) {
+            return false;
+        }
+
+        convert->get_rt_info()["DISABLED_CONSTANT_FOLDING"] = std::make_shared<ngraph::VariantWrapper<std::string>>("");
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(m_embedding, "MarkEmbeddingTableDecompression");
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,33 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Description:
+ *     Keeps dequantization of int8 embedding table unfolded, so the plugin can store the table
+ *     in int8 and apply the scale inside the EmbeddingBag kernel.
+ *
+ *          Constant (i8)
+ *             |
+ *          Convert    Constant
+ *              \      /
+ *              Multiply
+ *                 |
+ *     EmbeddingBagOffsetsSum / EmbeddingBagPackedSum / EmbeddingSegmentsSum
+ *
+ *     Multiply constant has to be a scalar or a value per table row.
+ */
+
+class MarkEmbeddingTableDecompression : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MarkEmbeddingTableDecompression();
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,204 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fc_weights_decompression.hpp"
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/variant.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::MarkFCWeightsDecompression, "MarkFCWeightsDecompression", 0);
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::MarkFCWeightsFP16Decompression, "MarkFCWeightsFP16Decompression", 0);
+
+namespace {
+
+const char disabledConstantFolding[] = "DISABLED_CONSTANT_FOLDING";
+
+bool isMarkedConvert(const ngraph::Output<ngraph::Node>& output) {
+    const auto convert = std::dynamic_pointer_cast<const ngraph::opset1::Convert>(output.get_node_shared_ptr());
+    return convert &&
+           ngraph::is_type<ngraph::opset1::Constant>(convert->get_input_node_ptr(0)) &&
+           convert->get_rt_info().count(disabledConstantFolding) != 0;
+}
+
+// Decompression scale or zero point must be either a scalar or a value per output channel
+bool isPerChannelConstant(const ngraph::Shape& shape, size_t OC, bool transposedWeights) {
+    if (ngraph::shape_size(shape) == 1)
+        return true;
+    if (transposedWeights)
+        return shape == ngraph::Shape{OC, 1};
+    return shape == ngraph::Shape{1, OC} || shape == ngraph::Shape{OC};
+}
+
+// the kernel reads each weight once per block of source rows, so only a few rows are faster than oneDNN
+bool hasFewRows(const std::shared_ptr<ngraph::Node>& matmul, size_t maxRows) {
+    if (matmul->get_output_partial_shape(0).is_dynamic())
+        return false;
+    const auto& outShape = matmul->get_output_shape(0);
+    return !outShape.empty() && outShape.back() != 0 && ngraph::shape_size(outShape) / outShape.back() <= maxRows;
+}
+
+}  // namespace
+
+bool MKLDNNPlugin::isFCWeightsDecompressionSubtract(const std::shared_ptr<const ngraph::Node>& node) {
+    return ngraph::is_type<ngraph::opset1::Subtract>(node) &&
+           isMarkedConvert(node->input_value(0)) &&
+           ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(1));
+}
+
+bool MKLDNNPlugin::isFCWeightsDecompression(const std::shared_ptr<const ngraph::Node>& node) {
+    if (ngraph::is_type<ngraph::opset1::Convert>(node))
+        return node->get_rt_info().count(disabledConstantFolding) != 0 && node->get_input_element_type(0) == ngraph::element::f16 &&
+               ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(0));
+    if (!ngraph::is_type<ngraph::opset1::Multiply>(node))
+        return false;
+
+    for (size_t constPort = 0; constPort < 2; constPort++) {
+        if (!ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(constPort)))
+            continue;
+        const auto data = node->input_value(1 - constPort);
+        if (isMarkedConvert(data) || isFCWeightsDecompressionSubtract(data.get_node_shared_ptr()))
+            return true;
+    }
+    return false;
+}
+
+MKLDNNPlugin::MarkFCWeightsDecompression::MarkFCWeightsDecompression(size_t maxRows) {
+    auto m_multiply = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>(ngraph::pattern::consumers_count(1));
+    auto m_matmul = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ngraph::pattern::any_input(), m_multiply});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto & pattern_to_output = m.get_pattern_value_map();
+
+        auto matmul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(pattern_to_output[m_matmul].get_node_shared_ptr());
+        auto multiply = pattern_to_output[m_multiply].get_node_shared_ptr();
+        if (!matmul || !hasFewRows(matmul, maxRows)) {
+            return false;
+        }
+
+        const size_t scalePort = ngraph::is_type<ngraph::opset1::Constant>(multiply->get_input_node_ptr(1)) ? 1 : 0;
+        auto scale = std::dynamic_pointer_cast<ngraph::opset1::Constant>(multiply->get_input_node_shared_ptr(scalePort));
+        if (!scale) {
+            return false;
+        }
+
+        auto parent = multiply->get_input_node_shared_ptr(1 - scalePort);
+        std::shared_ptr<ngraph::opset1::Constant> zeroPoint;
+        auto subtract = std::dynamic_pointer_cast<ngraph::opset1::Subtract>(parent);
+        if (subtract) {
+            zeroPoint = std::dynamic_pointer_cast<ngraph::opset1::Constant>(subtract->get_input_node_shared_ptr(1));
+            if (!zeroPoint || subtract->get_output_target_inputs(0).size() != 1) {
+                return false;
+            }
+            parent = subtract->get_input_node_shared_ptr(0);
+        }
+
+        auto convert = std::dynamic_pointer_cast<ngraph::opset1::Convert>(parent);
+        if (!convert || convert->get_output_target_inputs(0).size() != 1 || !convert->get_output_element_type(0).is_real()) {
+            return false;
+        }
+
+        auto weights = std::dynamic_pointer_cast<ngraph::opset1::Constant>(convert->get_input_node_shared_ptr(0));
+        if (!weights || weights->get_output_target_inputs(0).size() != 1 || weights->get_shape().size() != 2) {
+            return false;
+        }
+
+        const auto weightsPrecision = weights->get_element_type();
+        const bool transposed = matmul->get_transpose_b();
+        if (!(weightsPrecision == ngraph::element::u8 || weightsPrecision == ngraph::element::i8 ||
+              (transposed && (weightsPrecision == ngraph::element::u4 || weightsPrecision == ngraph::element::i4)))) {
+            return false;
+        }
+
+        const size_t OC = transposed ? weights->get_shape()[0] : weights->get_shape()[1];
+        if (!isPerChannelConstant(scale->get_shape(), OC, transposed) ||
+            (zeroPoint && !isPerChannelConstant(zeroPoint->get_shape(), OC, transposed))) {
+            return false;
+        }
+
+        if (!transposed) {
+            // FullyConnected expects weights in [OC, IC] layout, so the transposition is moved to the constants
+            // to keep the decompression subgraph directly connected to the weights input
+            auto toPerChannelColumn = [OC](const std::shared_ptr<ngraph::opset1::Constant>& constant) {
+                if (ngraph::shape_size(constant->get_shape()) == 1)
+                    return constant;
+                auto newConstant = std::make_shared<ngraph::opset1::Constant>(constant->get_element_type(), ngraph::Shape{OC, 1},
+                                                                              constant->get_data_ptr());
+                newConstant->set_friendly_name(constant->get_friendly_name());
+                ngraph::copy_runtime_info(constant, newConstant);
+                return newConstant;
+            };
+
+            auto transposedWeights = std::make_shared<ngraph::opset1::Transpose>(weights,
+                ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {1, 0}));
+            ngraph::copy_runtime_info(weights, transposedWeights);
+            convert->input(0).replace_source_output(transposedWeights);
+
+            multiply->input(scalePort).replace_source_output(toPerChannelColumn(scale));
+            if (subtract) {
+                subtract->input(1).replace_source_output(toPerChannelColumn(zeroPoint));
+            }
+
+            matmul->set_transpose_b(true);
+
+            convert->revalidate_and_infer_types();
+            if (subtract) {
+                subtract->revalidate_and_infer_types();
+            }
+            multiply->revalidate_and_infer_types();
+            matmul->revalidate_and_infer_types();
+        }
+
+        convert->get_rt_info()[disabledConstantFolding] = std::make_shared<ngraph::VariantWrapper<std::string>>("");
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(m_matmul, "MarkFCWeightsDecompression");
+    this->register_matcher(m, callback);
+}
+
+MKLDNNPlugin::MarkFCWeightsFP16Decompression::MarkFCWeightsFP16Decompression(size_t maxRows) {
+    auto m_weights = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(ngraph::pattern::consumers_count(1));
+    auto m_matmul = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ngraph::pattern::any_input(), m_weights});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto & pattern_to_output = m.get_pattern_value_map();
+
+        auto matmul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(pattern_to_output[m_matmul].get_node_shared_ptr());
+        auto weights = std::dynamic_pointer_cast<ngraph::opset1::Constant>(pattern_to_output[m_weights].get_node_shared_ptr());
+        if (!matmul || !weights || weights->get_element_type() != ngraph::element::f16 || weights->get_shape().size() != 2 ||
+            !hasFewRows(matmul, maxRows)) {
+            return false;
+        }
+
+        std::shared_ptr<ngraph::opset1::Constant> compressedWeights = weights;
+        if (!matmul->get_transpose_b()) {
+            // FullyConnected expects weights in [OC, IC] layout
+            const size_t IC = weights->get_shape()[0], OC = weights->get_shape()[1];
+            const auto src = weights->get_data_ptr<uint16_t>();
+            std::vector<uint16_t> transposed(IC * OC);
+            for (size_t oc = 0; oc < OC; oc++)
+                for (size_t ic = 0; ic < IC; ic++)
+                    transposed[oc * IC + ic] = src[ic * OC + oc];
+
+            compressedWeights = std::make_shared<ngraph::opset1::Constant>(ngraph::element::f16, ngraph::Shape{OC, IC}, transposed.data());
+            compressedWeights->set_friendly_name(weights->get_friendly_name());
+            ngraph::copy_runtime_info(weights, compressedWeights);
+            matmul->set_transpose_b(true);
+        }
+
+        // the Convert is a no-op until ConvertPrecision changes its destination type to f32
+        auto convert = std::make_shared<ngraph::opset1::Convert>(compressedWeights, ngraph::element::f16);
+        convert->set_friendly_name(weights->get_friendly_name() + "/decompression");
+        ngraph::copy_runtime_info(weights, convert);
+        convert->get_rt_info()[disabledConstantFolding] = std::make_shared<ngraph::VariantWrapper<std::string>>("");
+
+        matmul->input(1).replace_source_output(convert);
+        matmul->revalidate_and_infer_types();
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(m_matmul, "MarkFCWeightsFP16Decompression");
+    this->register_matcher(m, callback);
+}
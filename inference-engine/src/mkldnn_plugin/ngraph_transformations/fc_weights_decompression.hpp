@@ -0,0 +1,70 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Description:
+ *     Keeps weights decompression subgraph of MatMul unfolded, so the plugin can store the weights
+ *     in the compressed form and decompress them inside the FullyConnected kernel.
+ *
+ *          Constant (u8/i8)
+ *             |
+ *          Convert    Constant
+ *              \      /
+ *              Subtract (optional)    Constant
+ *                   \                  /
+ *                        Multiply
+ *                           |
+ *                         MatMul
+ *
+ *     Subtract and Multiply constants have to be scalars or per output channel values. If MatMul
+ *     has transpose_b == false, the weights are transposed on the constant side, so the
+ *     decompression subgraph stays a direct producer of the future FullyConnected weights.
+ *     Only MatMuls with at most maxRows source rows are marked, the weights of bigger ones are folded
+ *     to FP32 and executed by oneDNN with fused post operations.
+ */
+
+class MarkFCWeightsDecompression : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    explicit MarkFCWeightsDecompression(size_t maxRows);
+};
+
+/*
+ * Description:
+ *     Keeps FP16 MatMul weights in FP16, so they are expanded to FP32 inside the FullyConnected kernel
+ *     instead of being converted by ConvertPrecision. Only MatMuls with at most maxRows source rows are
+ *     marked: they are bound by memory bandwidth, while bigger ones are faster with FP32 weights converted once.
+ *     Has to be registered right before ConvertPrecision:
+ *
+ *          Constant (f16)                         Constant (f16, [OC, IC])
+ *             |                  ==>                  |
+ *          MatMul                                  Convert (folding disabled, f32 after ConvertPrecision)
+ *                                                     |
+ *                                                  MatMul (transpose_b = true)
+ */
+
+class MarkFCWeightsFP16Decompression : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    explicit MarkFCWeightsFP16Decompression(size_t maxRows);
+};
+
+/**
+ * @brief Checks that the node is the last node of a weights decompression subgraph marked by MarkFCWeightsDecompression
+ * (Multiply) or MarkFCWeightsFP16Decompression (Convert)
+ */
+bool isFCWeightsDecompression(const std::shared_ptr<const ngraph::Node>& node);
+
+/**
+ * @brief Checks that the node is the Subtract of a weights decompression subgraph marked by MarkFCWeightsDecompression
+ */
+bool isFCWeightsDecompressionSubtract(const std::shared_ptr<const ngraph::Node>& node);
+
+}  // namespace MKLDNNPlugin
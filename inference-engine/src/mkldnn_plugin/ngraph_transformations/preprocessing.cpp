@@ -0,0 +1,251 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "preprocessing.hpp"
+
+#include <algorithm>
+#include <vector>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::AddPreprocessing, "AddPreprocessing", 0);
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::FoldPreprocessingIntoConvolution, "FoldPreprocessingIntoConvolution", 0);
+
+namespace {
+
+// returns nullptr if the mean image doesn't match the [N, C, H, W] input
+std::shared_ptr<ngraph::Node> createMeanImage(const InferenceEngine::PreProcessInfo& preProcess,
+                                              const ngraph::Shape& shape, const ngraph::element::Type& type) {
+    if (shape.size() != 4)
+        return nullptr;
+
+    const size_t imageSize = shape[2] * shape[3];
+    std::vector<float> values;
+    values.reserve(shape[1] * imageSize);
+    for (size_t c = 0; c < shape[1]; c++) {
+        const auto& meanData = preProcess[c]->meanData;
+        if (!meanData || meanData->getTensorDesc().getPrecision() != InferenceEngine::Precision::FP32 ||
+            meanData->size() != imageSize)
+            return nullptr;
+
+        auto lockedMem = meanData->cbuffer();
+        const auto* data = lockedMem.as<const float*>();
+        values.insert(values.end(), data, data + imageSize);
+    }
+
+    return ngraph::opset1::Constant::create(type, {1, shape[1], shape[2], shape[3]}, values);
+}
+
+// returns the values of the constant broadcast along the channel axis of the rank-D input or an empty vector
+// if the constant is not a per channel one
+std::vector<float> getPerChannelValues(const ngraph::opset1::Constant& constant, size_t rank, size_t channels) {
+    const auto& shape = constant.get_shape();
+    if (shape.size() > rank)
+        return {};
+
+    const size_t offset = rank - shape.size();
+    for (size_t i = 0; i < shape.size(); i++) {
+        if (shape[i] != 1 && (i + offset != 1 || shape[i] != channels))
+            return {};
+    }
+
+    auto values = constant.cast_vector<float>();
+    if (values.size() == 1)
+        values.resize(channels, values[0]);
+    return values;
+}
+
+}  // namespace
+
+MKLDNNPlugin::AddPreprocessing::AddPreprocessing(const InferenceEngine::InputsDataMap& inputsInfo)
+    : inputsInfo(inputsInfo) {}
+
+bool MKLDNNPlugin::AddPreprocessing::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    bool rewritten = false;
+    for (const auto& param : f->get_parameters()) {
+        auto inputInfo = inputsInfo.find(param->get_friendly_name());
+        if (inputInfo == inputsInfo.end())
+            continue;
+
+        auto& preProcess = inputInfo->second->getPreProcess();
+        const size_t channels = preProcess.getNumberOfChannels();
+        if (channels == 0 || !param->get_element_type().is_real() || param->get_output_partial_shape(0).is_dynamic())
+            continue;
+
+        const auto& shape = param->get_shape();
+        const auto consumers = param->output(0).get_target_inputs();
+        const bool isOutput = std::any_of(consumers.begin(), consumers.end(), [](const ngraph::Input<ngraph::Node>& consumer) {
+            return ngraph::is_type<ngraph::opset1::Result>(consumer.get_node());
+        });
+        if (shape.size() < 2 || shape[1] != channels || isOutput)
+            continue;
+
+        ngraph::Shape perChannelShape(shape.size(), 1);
+        perChannelShape[1] = channels;
+
+        std::shared_ptr<ngraph::Node> mean;
+        if (preProcess.getMeanVariant() == InferenceEngine::MEAN_VALUE) {
+            std::vector<float> values(channels);
+            for (size_t c = 0; c < channels; c++)
+                values[c] = preProcess[c]->meanValue;
+            if (std::any_of(values.begin(), values.end(), [](float value) { return value != 0.f; }))
+                mean = ngraph::opset1::Constant::create(param->get_element_type(), perChannelShape, values);
+        } else if (preProcess.getMeanVariant() == InferenceEngine::MEAN_IMAGE) {
+            mean = createMeanImage(preProcess, shape, param->get_element_type());
+            // the mismatch is reported by the infer request as before
+            if (!mean)
+                continue;
+        }
+
+        std::vector<float> scales(channels);
+        for (size_t c = 0; c < channels; c++)
+            scales[c] = preProcess[c]->stdScale;
+        const bool hasScale = std::any_of(scales.begin(), scales.end(), [](float value) { return value != 1.f; });
+
+        ngraph::Output<ngraph::Node> preprocessed = param;
+        if (mean) {
+            auto subtract = std::make_shared<ngraph::opset1::Subtract>(preprocessed, mean);
+            subtract->set_friendly_name(param->get_friendly_name() + "/mean");
+            preprocessed = subtract;
+        }
+        if (hasScale) {
+            auto multiply = std::make_shared<ngraph::opset1::Multiply>(preprocessed,
+                ngraph::opset1::Constant::create(param->get_element_type(), perChannelShape, scales));
+            multiply->set_friendly_name(param->get_friendly_name() + "/scale");
+            preprocessed = multiply;
+        }
+
+        if (preprocessed != param->output(0)) {
+            for (auto consumer : consumers)
+                consumer.replace_source_output(preprocessed);
+            rewritten = true;
+        }
+
+        preProcess.init(0);
+        preProcess.setVariant(InferenceEngine::NONE);
+    }
+
+    return rewritten;
+}
+
+MKLDNNPlugin::FoldPreprocessingIntoConvolution::FoldPreprocessingIntoConvolution() {
+    auto m_conv = ngraph::pattern::wrap_type<ngraph::opset1::Convolution>({ngraph::pattern::any_input(ngraph::pattern::has_static_shape()),
+                                                                          ngraph::pattern::wrap_type<ngraph::opset1::Constant>()});
+
+    ngraph::matcher_pass_callback callback = [](ngraph::pattern::Matcher& m) {
+        auto conv = std::dynamic_pointer_cast<ngraph::opset1::Convolution>(m.get_match_root());
+        if (!conv)
+            return false;
+
+        auto weights = std::dynamic_pointer_cast<ngraph::opset1::Constant>(conv->get_input_node_shared_ptr(1));
+        if (!weights || !weights->get_element_type().is_real())
+            return false;
+
+        const auto& weightsShape = weights->get_shape();
+        const size_t rank = conv->get_input_shape(0).size();
+        const size_t outChannels = weightsShape[0];
+        const size_t inChannels = weightsShape[1];
+
+        // the convolution input is kept as x = y * scale + shift, where y is the output of the current op
+        std::vector<float> scale(inChannels, 1.f);
+        std::vector<float> shift(inChannels, 0.f);
+        ngraph::NodeVector folded;
+        ngraph::Output<ngraph::Node> source = conv->input_value(0);
+        while (!ngraph::is_type<ngraph::opset1::Parameter>(source.get_node())) {
+            auto node = source.get_node_shared_ptr();
+            const bool isMultiply = ngraph::is_type<ngraph::opset1::Multiply>(node);
+            const bool isAdd = ngraph::is_type<ngraph::opset1::Add>(node);
+            const bool isSubtract = ngraph::is_type<ngraph::opset1::Subtract>(node);
+            if ((!isMultiply && !isAdd && !isSubtract) || source.get_target_inputs().size() != 1)
+                return false;
+
+            // the commutative ops may keep the constant on any input
+            const size_t constPort = !isSubtract && ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(0)) ? 0 : 1;
+            auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(constPort));
+            if (!constant)
+                return false;
+
+            const auto values = getPerChannelValues(*constant, rank, inChannels);
+            if (values.empty())
+                return false;
+
+            for (size_t c = 0; c < inChannels; c++) {
+                if (isMultiply) {
+                    scale[c] *= values[c];
+                } else if (isAdd) {
+                    shift[c] += values[c] * scale[c];
+                } else {
+                    shift[c] -= values[c] * scale[c];
+                }
+            }
+
+            folded.push_back(node);
+            source = node->input_value(1 - constPort);
+        }
+
+        if (folded.empty())
+            return false;
+
+        const auto isZero = [](std::ptrdiff_t value) { return value == 0; };
+        const bool hasPadding = !std::all_of(conv->get_pads_begin().begin(), conv->get_pads_begin().end(), isZero) ||
+                                !std::all_of(conv->get_pads_end().begin(), conv->get_pads_end().end(), isZero);
+        const bool hasShift = std::any_of(shift.begin(), shift.end(), [](float value) { return value != 0.f; });
+        // with padding the shift stays before the convolution as y + shift / scale
+        if (hasPadding && hasShift && std::any_of(scale.begin(), scale.end(), [](float value) { return value == 0.f; }))
+            return false;
+
+        auto weightsValues = weights->cast_vector<float>();
+        const size_t kernelSize = weightsValues.size() / (outChannels * inChannels);
+        std::vector<float> bias(outChannels, 0.f);
+        for (size_t oc = 0; oc < outChannels; oc++) {
+            for (size_t ic = 0; ic < inChannels; ic++) {
+                float* w = &weightsValues[(oc * inChannels + ic) * kernelSize];
+                for (size_t k = 0; k < kernelSize; k++) {
+                    bias[oc] += w[k] * shift[ic];
+                    w[k] *= scale[ic];
+                }
+            }
+        }
+
+        ngraph::NodeVector newOps;
+        ngraph::Output<ngraph::Node> input = source;
+        if (hasPadding && hasShift) {
+            std::vector<float> inputShift(inChannels);
+            for (size_t c = 0; c < inChannels; c++)
+                inputShift[c] = shift[c] / scale[c];
+
+            ngraph::Shape shiftShape(rank, 1);
+            shiftShape[1] = inChannels;
+            auto inputShiftAdd = std::make_shared<ngraph::opset1::Add>(source,
+                ngraph::opset1::Constant::create(source.get_element_type(), shiftShape, inputShift));
+            inputShiftAdd->set_friendly_name(conv->get_friendly_name() + "/shift");
+            input = inputShiftAdd;
+            newOps.push_back(inputShiftAdd);
+        }
+
+        auto newWeights = ngraph::opset1::Constant::create(weights->get_element_type(), weightsShape, weightsValues);
+        auto newConv = conv->clone_with_new_inputs({input, newWeights});
+        newOps.push_back(newConv);
+
+        std::shared_ptr<ngraph::Node> result = newConv;
+        if (!hasPadding && hasShift) {
+            ngraph::Shape biasShape(rank, 1);
+            biasShape[1] = outChannels;
+            newConv->set_friendly_name(conv->get_friendly_name() + "/folded");
+            result = std::make_shared<ngraph::opset1::Add>(newConv,
+                ngraph::opset1::Constant::create(conv->get_output_element_type(0), biasShape, bias));
+            newOps.push_back(result);
+        }
+
+        result->set_friendly_name(conv->get_friendly_name());
+        folded.push_back(conv);
+        ngraph::copy_runtime_info(folded, newOps);
+        ngraph::replace_node(conv, result);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(m_conv, "FoldPreprocessingIntoConvolution");
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,58 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_input_info.hpp>
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Description:
+ *     Lowers mean value / mean image subtraction and per channel scale from the inputs pre-processing info into
+ *     the graph. The lowered info is reset, so the input doesn't need a host side pre-processing step any more.
+ *     The inputs with the mean image not matching the input shape are left to the infer request.
+ *
+ *         Parameter                 Parameter
+ *             |                         |
+ *                          =>       Subtract <- Const(mean)
+ *                                       |
+ *                                   Multiply <- Const(stdScale)
+ *                                       |
+ */
+
+class AddPreprocessing : public ngraph::pass::FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    explicit AddPreprocessing(const InferenceEngine::InputsDataMap& inputsInfo);
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    InferenceEngine::InputsDataMap inputsInfo;
+};
+
+/*
+ * Description:
+ *     Folds a chain of per channel Multiply / Subtract / Add ops between a Parameter and a Convolution into
+ *     the convolution weights and a per output channel bias. The shift is folded only for the convolutions
+ *     without padding, since the padded border values would be shifted otherwise.
+ *
+ *     Parameter                      Parameter
+ *         |                              |
+ *     Subtract <- Const(m)           Convolution <- Const(W * s)
+ *         |                    =>        |
+ *     Multiply <- Const(s)              Add <- Const(-sum(W * s * m))
+ *         |                              |
+ *    Convolution <- Const(W)
+ *         |
+ */
+
+class FoldPreprocessingIntoConvolution : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    FoldPreprocessingIntoConvolution();
+};
+
+}  // namespace MKLDNNPlugin
@@ -4,6 +4,7 @@
 
 #include "reshape_fc_fusion.hpp"
 #include "op/fully_connected.hpp"
+#include "fc_weights_decompression.hpp"
 #include <numeric>
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/rt_info.hpp>
@@ -31,6 +32,11 @@ MKLDNNPlugin::ReshapeFullyConnectedFusion::ReshapeFullyConnectedFusion() {
             return false;
         }
 
+        // Decompressed weights are fused into FullyConnected only in 2D form
+        if (isFCWeightsDecompression(fc->get_input_node_shared_ptr(1))) {
+            return false;
+        }
+
         // Check that Weights[O, C*H*W] consistent with Input[N, C, H, W]
         auto shape_w = fc->input_value(1).get_shape();
         if (shape_in[0] != shape_out[0] || std::accumulate(shape_in.begin() + 1, shape_in.end(), size_t{1}, std::multiplies<size_t>()) != shape_w[1]) {
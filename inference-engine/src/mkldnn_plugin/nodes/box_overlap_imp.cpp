@@ -0,0 +1,79 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "box_overlap_imp.hpp"
+
+#include <algorithm>
+#if defined(HAVE_AVX2)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+bool box_overlaps_any(const float* box, const float* xmin, const float* ymin,
+        const float* xmax, const float* ymax, const float* area,
+        int num_boxes, float threshold, bool inclusive) {
+    const bool box_is_valid = !(box[4] <= 0.f);
+
+    int j = 0;
+#if defined(HAVE_AVX2)
+    const __m256 vc_zero = _mm256_setzero_ps();
+    const __m256 v_threshold = _mm256_set1_ps(threshold);
+
+    const __m256 v_xmin = _mm256_set1_ps(box[0]);
+    const __m256 v_ymin = _mm256_set1_ps(box[1]);
+    const __m256 v_xmax = _mm256_set1_ps(box[2]);
+    const __m256 v_ymax = _mm256_set1_ps(box[3]);
+    const __m256 v_area = _mm256_set1_ps(box[4]);
+
+    if (box_is_valid) {
+        for (; j <= num_boxes - 8; j += 8) {
+            const __m256 v_inter_xmin = _mm256_max_ps(v_xmin, _mm256_loadu_ps(xmin + j));
+            const __m256 v_inter_ymin = _mm256_max_ps(v_ymin, _mm256_loadu_ps(ymin + j));
+            const __m256 v_inter_xmax = _mm256_min_ps(v_xmax, _mm256_loadu_ps(xmax + j));
+            const __m256 v_inter_ymax = _mm256_min_ps(v_ymax, _mm256_loadu_ps(ymax + j));
+
+            const __m256 v_width  = _mm256_max_ps(_mm256_sub_ps(v_inter_xmax, v_inter_xmin), vc_zero);
+            const __m256 v_height = _mm256_max_ps(_mm256_sub_ps(v_inter_ymax, v_inter_ymin), vc_zero);
+            const __m256 v_inter = _mm256_mul_ps(v_width, v_height);
+
+            const __m256 v_area_j = _mm256_loadu_ps(area + j);
+            const __m256 v_union = _mm256_sub_ps(_mm256_add_ps(v_area, v_area_j), v_inter);
+
+            // IoU is zeroed if there is no intersection or the area of the box is not positive
+            const __m256 v_mask = _mm256_and_ps(_mm256_cmp_ps(v_inter, vc_zero, _CMP_GT_OQ),
+                                                _mm256_cmp_ps(v_area_j, vc_zero, _CMP_NLE_UQ));
+            const __m256 v_iou = _mm256_and_ps(_mm256_div_ps(v_inter, v_union), v_mask);
+
+            const __m256 v_suppressed = inclusive ? _mm256_cmp_ps(v_iou, v_threshold, _CMP_GE_OQ)
+                                                  : _mm256_cmp_ps(v_iou, v_threshold, _CMP_GT_OQ);
+            if (_mm256_movemask_ps(v_suppressed))
+                return true;
+        }
+    }
+#endif
+
+    for (; j < num_boxes; j++) {
+        const float width  = (std::max)((std::min)(box[2], xmax[j]) - (std::max)(box[0], xmin[j]), 0.f);
+        const float height = (std::max)((std::min)(box[3], ymax[j]) - (std::max)(box[1], ymin[j]), 0.f);
+        const float inter = width * height;
+
+        float iou = 0.f;
+        if (inter > 0.f && box_is_valid && !(area[j] <= 0.f))
+            iou = inter / (box[4] + area[j] - inter);
+
+        if (inclusive ? iou >= threshold : iou > threshold)
+            return true;
+    }
+
+    return false;
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,24 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+/**
+ * @brief Checks whether the box {xmin, ymin, xmax, ymax, area} overlaps at least one of the num_boxes boxes given by
+ * separate arrays of coordinates and areas with IoU greater than the threshold (or equal to it, if inclusive is set).
+ * IoU of the boxes without intersection or with non-positive area is 0.
+ */
+bool box_overlaps_any(const float* box, const float* xmin, const float* ymin,
+        const float* xmax, const float* ymax, const float* area,
+        int num_boxes, float threshold, bool inclusive);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
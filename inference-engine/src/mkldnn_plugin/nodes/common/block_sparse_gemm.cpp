@@ -0,0 +1,287 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "block_sparse_gemm.h"
+
+#include <cpu/x64/jit_generator.hpp>
+#include <mkldnn.hpp>  // TODO: just to replace mkldnn->dnnl via macros
+#include <ie_parallel.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+using namespace mkldnn;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_args_block_sparse_gemm, field)
+
+struct jit_args_block_sparse_gemm {
+    const float* src;
+    float* dst;
+    const float* blocks;
+    const size_t* src_offsets;
+    const float* bias;
+    size_t blocks_num;
+};
+
+struct jit_block_sparse_gemm_config_params {
+    size_t rows;
+    size_t src_stride;
+    size_t dst_stride;
+};
+
+struct jit_uni_block_sparse_gemm_kernel {
+    void (*ker_)(const jit_args_block_sparse_gemm *);
+
+    void operator()(const jit_args_block_sparse_gemm *args) { assert(ker_); ker_(args); }
+
+    jit_uni_block_sparse_gemm_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_block_sparse_gemm_kernel() {}
+
+    virtual void create_ker() = 0;
+};
+
+// Each nonzero block is loaded once and multiplied by the broadcasted source values of jcp.rows rows,
+// the accumulators of all rows stay in registers until the end of the block list
+template <cpu_isa_t isa>
+struct jit_uni_block_sparse_gemm_kernel_f32 : public jit_uni_block_sparse_gemm_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_block_sparse_gemm_kernel_f32)
+
+    jit_uni_block_sparse_gemm_kernel_f32(jit_block_sparse_gemm_config_params jcp)
+        : jcp_(jcp), jit_uni_block_sparse_gemm_kernel(), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    static size_t maxRows() {
+        // accumulators of all rows, the block and the broadcasted source value have to fit into the registers
+        return isa == x64::avx512_common ? 8 : 4;
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_blocks, ptr[reg_params + GET_OFF(blocks)]);
+        mov(reg_src_offsets, ptr[reg_params + GET_OFF(src_offsets)]);
+        mov(reg_bias, ptr[reg_params + GET_OFF(bias)]);
+        mov(reg_blocks_num, ptr[reg_params + GET_OFF(blocks_num)]);
+
+        for (size_t r = 0; r < jcp_.rows; r++)
+            for (size_t v = 0; v < vecs; v++)
+                uni_vmovups(get_acc(r, v), ptr[reg_bias + v * vlen]);
+
+        Xbyak::Label loop_label;
+        Xbyak::Label exit_label;
+
+        L(loop_label); {
+            cmp(reg_blocks_num, 0);
+            je(exit_label, T_NEAR);
+
+            mov(reg_src_k, ptr[reg_src_offsets]);
+            add(reg_src_k, reg_src);
+
+            for (size_t v = 0; v < vecs; v++)
+                uni_vmovups(get_wei(v), ptr[reg_blocks + v * vlen]);
+
+            for (size_t r = 0; r < jcp_.rows; r++) {
+                uni_vbroadcastss(vmm_src, ptr[reg_src_k + r * jcp_.src_stride]);
+                for (size_t v = 0; v < vecs; v++)
+                    uni_vfmadd231ps(get_acc(r, v), get_wei(v), vmm_src);
+            }
+
+            add(reg_blocks, BlockSparseGemm::blockSize * sizeof(float));
+            add(reg_src_offsets, sizeof(size_t));
+            sub(reg_blocks_num, 1);
+
+            jmp(loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        for (size_t r = 0; r < jcp_.rows; r++)
+            for (size_t v = 0; v < vecs; v++)
+                uni_vmovups(ptr[reg_dst + r * jcp_.dst_stride + v * vlen], get_acc(r, v));
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const size_t vlen = cpu_isa_traits<isa>::vlen;
+    const size_t vecs = BlockSparseGemm::blockSize * sizeof(float) / cpu_isa_traits<isa>::vlen;
+
+    Vmm get_acc(size_t row, size_t vec) const { return Vmm(static_cast<int>(row * vecs + vec)); }
+    Vmm get_wei(size_t vec) const { return Vmm(static_cast<int>(jcp_.rows * vecs + vec)); }
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_blocks = r10;
+    Xbyak::Reg64 reg_src_offsets = r11;
+    Xbyak::Reg64 reg_bias = r12;
+    Xbyak::Reg64 reg_blocks_num = r13;
+    Xbyak::Reg64 reg_src_k = r14;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_src = Vmm(isa == x64::avx512_common ? 31 : 15);
+
+    jit_block_sparse_gemm_config_params jcp_;
+};
+
+const size_t BlockSparseGemm::blockSize;
+
+namespace {
+
+bool isZeroBlock(const float* weights, size_t N, size_t K, size_t nb, size_t k) {
+    const size_t nEnd = std::min(N, (nb + 1) * BlockSparseGemm::blockSize);
+    for (size_t n = nb * BlockSparseGemm::blockSize; n < nEnd; n++) {
+        if (weights[n * K + k] != 0.f)
+            return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+float BlockSparseGemm::getZeroBlocksRate(const float* weights, size_t N, size_t K) {
+    const size_t nBlocks = div_up(N, blockSize);
+    if (nBlocks * K == 0)
+        return 0.f;
+
+    std::vector<size_t> zeroBlocks(nBlocks, 0);
+    parallel_for(nBlocks, [&](size_t nb) {
+        for (size_t k = 0; k < K; k++)
+            zeroBlocks[nb] += isZeroBlock(weights, N, K, nb, k);
+    });
+
+    size_t zeroBlocksNum = 0;
+    for (auto num : zeroBlocks)
+        zeroBlocksNum += num;
+    return static_cast<float>(zeroBlocksNum) / static_cast<float>(nBlocks * K);
+}
+
+BlockSparseGemm::BlockSparseGemm(const float* weights, const float* bias, size_t N, size_t K) : N(N), K(K) {
+    const size_t nBlocks = div_up(N, blockSize);
+
+    blockOffsets.resize(nBlocks + 1, 0);
+    parallel_for(nBlocks, [&](size_t nb) {
+        for (size_t k = 0; k < K; k++)
+            blockOffsets[nb + 1] += !isZeroBlock(weights, N, K, nb, k);
+    });
+    for (size_t nb = 0; nb < nBlocks; nb++)
+        blockOffsets[nb + 1] += blockOffsets[nb];
+    blocksNum = blockOffsets[nBlocks];
+
+    // the blocks of the last group of output channels are padded with zeros
+    blocks.resize(blocksNum * blockSize, 0.f);
+    srcOffsets.resize(blocksNum);
+    parallel_for(nBlocks, [&](size_t nb) {
+        const size_t nEnd = std::min(N, (nb + 1) * blockSize);
+        size_t b = blockOffsets[nb];
+        for (size_t k = 0; k < K; k++) {
+            if (isZeroBlock(weights, N, K, nb, k))
+                continue;
+
+            for (size_t n = nb * blockSize; n < nEnd; n++)
+                blocks[b * blockSize + n - nb * blockSize] = weights[n * K + k];
+            srcOffsets[b] = k * sizeof(float);
+            b++;
+        }
+    });
+
+    paddedBias.resize(nBlocks * blockSize, 0.f);
+    if (bias)
+        std::copy(bias, bias + N, paddedBias.begin());
+
+    auto jcp = jit_block_sparse_gemm_config_params();
+    jcp.src_stride = K * sizeof(float);
+    jcp.dst_stride = N * sizeof(float);
+
+    auto createKernel = [&](size_t rows) -> std::shared_ptr<jit_uni_block_sparse_gemm_kernel> {
+        jcp.rows = rows;
+        if (mayiuse(x64::avx512_common))
+            return std::make_shared<jit_uni_block_sparse_gemm_kernel_f32<x64::avx512_common>>(jcp);
+        if (mayiuse(x64::avx2))
+            return std::make_shared<jit_uni_block_sparse_gemm_kernel_f32<x64::avx2>>(jcp);
+        return nullptr;
+    };
+
+    if (mayiuse(x64::avx512_common))
+        kernelRows = jit_uni_block_sparse_gemm_kernel_f32<x64::avx512_common>::maxRows();
+    else if (mayiuse(x64::avx2))
+        kernelRows = jit_uni_block_sparse_gemm_kernel_f32<x64::avx2>::maxRows();
+
+    kernel = createKernel(kernelRows);
+    rowKernel = createKernel(1);
+    if (kernel) {
+        kernel->create_ker();
+        rowKernel->create_ker();
+    }
+}
+
+impl_desc_type BlockSparseGemm::getImplType() {
+    if (mayiuse(x64::avx512_common))
+        return static_cast<impl_desc_type>(impl_desc_type::jit_avx512 | impl_desc_type::sparse);
+    if (mayiuse(x64::avx2))
+        return static_cast<impl_desc_type>(impl_desc_type::jit_avx2 | impl_desc_type::sparse);
+    return static_cast<impl_desc_type>(impl_desc_type::ref_any | impl_desc_type::sparse);
+}
+
+void BlockSparseGemm::executeRef(const float* src, float* dst, size_t rows, size_t nb) const {
+    const size_t nStart = nb * blockSize;
+    const size_t nNum = std::min(N - nStart, blockSize);
+    for (size_t m = 0; m < rows; m++) {
+        float acc[blockSize];
+        std::copy(paddedBias.begin() + nStart, paddedBias.begin() + nStart + blockSize, acc);
+        for (size_t b = blockOffsets[nb]; b < blockOffsets[nb + 1]; b++) {
+            const float x = src[m * K + srcOffsets[b] / sizeof(float)];
+            const float* block = &blocks[b * blockSize];
+            for (size_t i = 0; i < blockSize; i++)
+                acc[i] += x * block[i];
+        }
+        std::copy(acc, acc + nNum, dst + m * N + nStart);
+    }
+}
+
+void BlockSparseGemm::execute(const float* src, float* dst, size_t M) const {
+    const size_t nBlocks = div_up(N, blockSize);
+    const size_t mBlocks = div_up(M, kernelRows);
+
+    parallel_for2d(mBlocks, nBlocks, [&](size_t mb, size_t nb) {
+        const size_t mStart = mb * kernelRows;
+        const size_t rows = std::min(M - mStart, kernelRows);
+        const float* srcRows = src + mStart * K;
+        float* dstRows = dst + mStart * N;
+
+        // the JIT kernels store the whole block of output channels, so the last group is processed by the reference code
+        if (!kernel || (nb + 1) * blockSize > N) {
+            executeRef(srcRows, dstRows, rows, nb);
+            return;
+        }
+
+        auto arg = jit_args_block_sparse_gemm();
+        arg.blocks = blocks.data() + blockOffsets[nb] * blockSize;
+        arg.src_offsets = srcOffsets.data() + blockOffsets[nb];
+        arg.bias = paddedBias.data() + nb * blockSize;
+        arg.blocks_num = blockOffsets[nb + 1] - blockOffsets[nb];
+        if (rows == kernelRows) {
+            arg.src = srcRows;
+            arg.dst = dstRows + nb * blockSize;
+            (*kernel)(&arg);
+        } else {
+            for (size_t m = 0; m < rows; m++) {
+                arg.src = srcRows + m * K;
+                arg.dst = dstRows + m * N + nb * blockSize;
+                (*rowKernel)(&arg);
+            }
+        }
+    });
+}
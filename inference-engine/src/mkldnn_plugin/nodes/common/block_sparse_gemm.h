@@ -0,0 +1,57 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <ie_common.h>
+#include "mkldnn/iml_type_mapper.h"
+
+struct jit_uni_block_sparse_gemm_kernel;
+
+/**
+ * @brief Computes dst[M][N] = src[M][K] * weights[N][K]^T + bias[N] for constant sparse FP32 weights.
+ * The weights are split into 1x16 blocks (16 output channels of one input channel) and only the blocks containing
+ * nonzero values are stored, so the amount of computations is proportional to the number of nonzero blocks.
+ */
+class BlockSparseGemm {
+public:
+    static const size_t blockSize = 16;
+
+    /**
+     * @brief Returns the share of 1x16 weights blocks which consist of zeros only
+     */
+    static float getZeroBlocksRate(const float* weights, size_t N, size_t K);
+
+    /**
+     * @param bias per output channel bias (may be nullptr)
+     */
+    BlockSparseGemm(const float* weights, const float* bias, size_t N, size_t K);
+
+    void execute(const float* src, float* dst, size_t M) const;
+
+    /**
+     * @brief Returns the implementation type reported for the instances created on the current platform
+     */
+    static MKLDNNPlugin::impl_desc_type getImplType();
+
+private:
+    void executeRef(const float* src, float* dst, size_t rows, size_t nb) const;
+
+    size_t N;
+    size_t K;
+    size_t blocksNum;
+
+    // nonzero blocks of the n-th group of output channels are stored in [blockOffsets[n], blockOffsets[n + 1])
+    std::vector<size_t> blockOffsets;
+    std::vector<float> blocks;
+    // byte offsets of the source values multiplied by the blocks
+    std::vector<size_t> srcOffsets;
+    std::vector<float> paddedBias;
+
+    size_t kernelRows = 1;
+    std::shared_ptr<jit_uni_block_sparse_gemm_kernel> kernel;
+    std::shared_ptr<jit_uni_block_sparse_gemm_kernel> rowKernel;
+};
@@ -6,16 +6,413 @@
 #include "cpu_memcpy.h"
 #include "utils/bfloat16.hpp"
 #include <mkldnn_selective_build.h>
+#include <cpu/x64/jit_generator.hpp>
+#include <mkldnn.hpp>  // TODO: just to replace mkldnn->dnnl via macros
+#include <ngraph/type/float16.hpp>
 #include <type_traits>
 #include <tuple>
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <cassert>
+#include <cstring>
+#include <cmath>
+#include <limits>
 #include <ie_parallel.hpp>
 
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
 
 namespace {
 
-template<typename srcType, typename dstType>
-void convert(const void *srcPtr, void *dstPtr, const size_t size) {
+#define GET_OFF(field) offsetof(jit_convert_call_args, field)
+
+struct jit_convert_config_params {
+    Precision src_prc;
+    Precision dst_prc;
+};
+
+struct jit_convert_call_args {
+    const void *src;
+    void *dst;
+    size_t work_amount;
+};
+
+struct jit_uni_convert_kernel {
+    void (*ker_)(const jit_convert_call_args *);
+
+    void operator()(const jit_convert_call_args *args) { assert(ker_); ker_(args); }
+
+    explicit jit_uni_convert_kernel(size_t step) : ker_(nullptr), step(step) {}
+    virtual ~jit_uni_convert_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    // number of elements processed by one iteration, work_amount must be a multiple of it
+    const size_t step;
+};
+
+bool isFloatingPoint(Precision prc) {
+    return one_of(prc, Precision::FP32, Precision::BF16, Precision::FP16);
+}
+
+// Integer destinations are saturated, floating point values are truncated towards zero before
+template <cpu_isa_t isa>
+struct jit_uni_convert_kernel_f32 : public jit_uni_convert_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_convert_kernel_f32)
+
+    explicit jit_uni_convert_kernel_f32(jit_convert_config_params jcp)
+        : jit_uni_convert_kernel(cpu_isa_traits<isa>::vlen / sizeof(float)), jit_generator(), jcp_(jcp) {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        const bool srcIsFloat = isFloatingPoint(jcp_.src_prc);
+        const bool dstIsFloat = isFloatingPoint(jcp_.dst_prc);
+        if (srcIsFloat && !dstIsFloat) {
+            float lowest = -2147483648.f, highest = 2147483520.f;  // the largest float less than 2^31
+            if (jcp_.dst_prc == Precision::U8) {
+                lowest = 0.f;
+                highest = 255.f;
+            } else if (jcp_.dst_prc == Precision::I8) {
+                lowest = -128.f;
+                highest = 127.f;
+            }
+            broadcast(vmm_lowest, float2int(lowest));
+            broadcast(vmm_highest, float2int(highest));
+        } else if (!srcIsFloat && !dstIsFloat) {
+            if (jcp_.dst_prc == Precision::U8 && jcp_.src_prc != Precision::U8)
+                broadcast(vmm_lowest, 0);
+            if (jcp_.dst_prc == Precision::I8 && jcp_.src_prc == Precision::I32)
+                broadcast(vmm_lowest, -128);
+            if (jcp_.dst_prc == Precision::U8 && jcp_.src_prc == Precision::I32)
+                broadcast(vmm_highest, 255);
+            if (jcp_.dst_prc == Precision::I8 && jcp_.src_prc != Precision::I8)
+                broadcast(vmm_highest, 127);
+        }
+        if (jcp_.dst_prc == Precision::BF16 && !useNativeBf16()) {
+            broadcast(vmm_one, 1);
+            broadcast(vmm_rounding, 0x7fff);
+        }
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label exit_label;
+
+        L(main_loop_label); {
+            cmp(reg_work_amount, step);
+            jl(exit_label, T_NEAR);
+
+            load(vmm_val, ptr[reg_src]);
+            if (srcIsFloat && !dstIsFloat) {
+                vmaxps(vmm_val, vmm_val, vmm_lowest);
+                vminps(vmm_val, vmm_val, vmm_highest);
+                vcvttps2dq(vmm_val, vmm_val);
+            } else if (!srcIsFloat && dstIsFloat) {
+                vcvtdq2ps(vmm_val, vmm_val);
+            } else if (!srcIsFloat && !dstIsFloat) {
+                if (one_of(jcp_.dst_prc, Precision::U8, Precision::I8) && !(jcp_.dst_prc == Precision::I8 && jcp_.src_prc == Precision::U8))
+                    vpmaxsd(vmm_val, vmm_val, vmm_lowest);
+                if (one_of(jcp_.dst_prc, Precision::U8, Precision::I8) && !(jcp_.dst_prc == Precision::U8 && jcp_.src_prc == Precision::I8))
+                    vpminsd(vmm_val, vmm_val, vmm_highest);
+            }
+            store(ptr[reg_dst], vmm_val);
+
+            add(reg_src, step * jcp_.src_prc.size());
+            add(reg_dst, step * jcp_.dst_prc.size());
+            sub(reg_work_amount, step);
+
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == sse41, Xbyak::Xmm, isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    using Vmm_half = typename conditional3<isa == sse41, Xbyak::Xmm, isa == avx2, Xbyak::Xmm, Xbyak::Ymm>::type;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg32 reg_tmp_32 = r11d;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_val = Vmm(0);
+    Vmm_half vmm_half_val = Vmm_half(0);
+    Xbyak::Xmm xmm_val = Xbyak::Xmm(0);
+    Vmm vmm_aux = Vmm(1);
+    Xbyak::Xmm xmm_aux = Xbyak::Xmm(1);
+    Vmm vmm_lowest = Vmm(2);
+    Vmm vmm_highest = Vmm(3);
+    Vmm vmm_one = Vmm(4);
+    Vmm vmm_rounding = Vmm(5);
+
+    jit_convert_config_params jcp_;
+
+    static int float2int(float value) {
+        int result;
+        std::memcpy(&result, &value, sizeof(result));
+        return result;
+    }
+
+    static bool useNativeBf16() {
+        return isa == avx512_common && mayiuse(avx512_core_bf16);
+    }
+
+    void broadcast(const Vmm& vmm, int value) {
+        mov(reg_tmp_32, value);
+        vmovd(xmm_aux, reg_tmp_32);
+        vpbroadcastd(vmm, xmm_aux);
+    }
+
+    void load(const Vmm& vmm, const Xbyak::Address& op) {
+        switch (jcp_.src_prc) {
+            case Precision::FP32:
+            case Precision::I32:
+                vmovups(vmm, op);
+                break;
+            case Precision::U8:
+                vpmovzxbd(vmm, op);
+                break;
+            case Precision::I8:
+                vpmovsxbd(vmm, op);
+                break;
+            case Precision::BF16:
+                vpmovzxwd(vmm, op);
+                vpslld(vmm, vmm, 16);
+                break;
+            case Precision::FP16:
+                vcvtph2ps(vmm, op);
+                break;
+            default:
+                assert(!"unsupported src precision");
+        }
+    }
+
+    void store(const Xbyak::Address& op, const Vmm& vmm) {
+        switch (jcp_.dst_prc) {
+            case Precision::FP32:
+            case Precision::I32:
+                vmovups(op, vmm);
+                break;
+            case Precision::BF16:
+                if (useNativeBf16()) {
+                    vcvtneps2bf16(vmm_half_val, vmm);
+                    vmovdqu(op, vmm_half_val);
+                    break;
+                }
+                // round to nearest even: (x + 0x7fff + ((x >> 16) & 1)) >> 16
+                vpsrld(vmm_aux, vmm, 16);
+                vpand(vmm_aux, vmm_aux, vmm_one);
+                vpaddd(vmm, vmm, vmm_aux);
+                vpaddd(vmm, vmm, vmm_rounding);
+                vpsrld(vmm, vmm, 16);
+                store_words(op, vmm);
+                break;
+            case Precision::FP16:
+                vcvtps2ph(op, vmm, 0x4);
+                break;
+            case Precision::U8:
+            case Precision::I8:
+                // the values are already in the destination range
+                if (isa == avx512_common) {
+                    vpmovdb(op, vmm);
+                } else {
+                    vpackssdw(vmm, vmm, vmm);
+                    vpermq(Xbyak::Ymm(vmm.getIdx()), Xbyak::Ymm(vmm.getIdx()), 0x08);
+                    if (jcp_.dst_prc == Precision::U8)
+                        vpackuswb(xmm_val, xmm_val, xmm_val);
+                    else
+                        vpacksswb(xmm_val, xmm_val, xmm_val);
+                    vmovq(op, xmm_val);
+                }
+                break;
+            default:
+                assert(!"unsupported dst precision");
+        }
+    }
+
+    void store_words(const Xbyak::Address& op, const Vmm& vmm) {
+        if (isa == avx512_common) {
+            vpmovdw(op, vmm);
+        } else {
+            vpackusdw(vmm, vmm, vmm);
+            vpermq(Xbyak::Ymm(vmm.getIdx()), Xbyak::Ymm(vmm.getIdx()), 0x08);
+            vmovdqu(op, xmm_val);
+        }
+    }
+};
+
+bool hasF16C() {
+    static Xbyak::util::Cpu cpu;
+    return cpu.has(Xbyak::util::Cpu::tF16C);
+}
+
+// Kernels are created once per precisions pair, nullptr is cached for unsupported ones
+std::shared_ptr<jit_uni_convert_kernel> getConvertKernel(Precision srcPrc, Precision dstPrc) {
+    static std::mutex kernelsMutex;
+    static std::map<std::pair<Precision::ePrecision, Precision::ePrecision>, std::shared_ptr<jit_uni_convert_kernel>> kernels;
+
+    std::lock_guard<std::mutex> lock(kernelsMutex);
+    const auto key = std::make_pair(static_cast<Precision::ePrecision>(srcPrc), static_cast<Precision::ePrecision>(dstPrc));
+    auto it = kernels.find(key);
+    if (it != kernels.end())
+        return it->second;
+
+    std::shared_ptr<jit_uni_convert_kernel> kernel;
+    const auto supportedPrecisions = {Precision::U8, Precision::I8, Precision::I32, Precision::FP16, Precision::BF16, Precision::FP32};
+    const bool isSupported = std::find(supportedPrecisions.begin(), supportedPrecisions.end(), srcPrc) != supportedPrecisions.end() &&
+                             std::find(supportedPrecisions.begin(), supportedPrecisions.end(), dstPrc) != supportedPrecisions.end();
+    if (isSupported) {
+        const auto jcp = jit_convert_config_params{srcPrc, dstPrc};
+        if (mayiuse(avx512_common)) {
+            kernel.reset(new jit_uni_convert_kernel_f32<avx512_common>(jcp));
+        } else if (mayiuse(avx2) && (hasF16C() || !one_of(Precision::FP16, srcPrc, dstPrc))) {
+            kernel.reset(new jit_uni_convert_kernel_f32<avx2>(jcp));
+        }
+        if (kernel)
+            kernel->create_ker();
+    }
+    kernels[key] = kernel;
+    return kernel;
+}
+
+void jitConvert(jit_uni_convert_kernel& kernel, const void *srcPtr, void *dstPtr, Precision srcPrc, Precision dstPrc, const size_t size) {
+    const auto src = reinterpret_cast<const uint8_t *>(srcPtr);
+    const auto dst = reinterpret_cast<uint8_t *>(dstPtr);
+    const size_t srcSize = srcPrc.size(), dstSize = dstPrc.size();
+    const size_t vectors = size / kernel.step;
+
+    // small tensors are not worth waking up the threads
+    parallel_nt(vectors < 64 ? 1 : 0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(vectors, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        auto args = jit_convert_call_args();
+        args.src = src + start * kernel.step * srcSize;
+        args.dst = dst + start * kernel.step * dstSize;
+        args.work_amount = (end - start) * kernel.step;
+        kernel(&args);
+    });
+
+    // the tail goes through the same kernel, so it is converted exactly as the rest of the tensor
+    const size_t tail = size % kernel.step;
+    if (tail) {
+        uint8_t srcTail[64] = {}, dstTail[64] = {};
+        const size_t offset = vectors * kernel.step;
+        std::memcpy(srcTail, src + offset * srcSize, tail * srcSize);
+
+        auto args = jit_convert_call_args();
+        args.src = srcTail;
+        args.dst = dstTail;
+        args.work_amount = kernel.step;
+        kernel(&args);
+
+        std::memcpy(dst + offset * dstSize, dstTail, tail * dstSize);
+    }
+}
+
+// round to nearest even as the jit kernel does
+MKLDNNPlugin::bfloat16_t toBfloat16(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    bits += 0x7fff + ((bits >> 16) & 1);
+    return MKLDNNPlugin::bfloat16_t::from_bits(static_cast<uint16_t>(bits >> 16));
+}
+
+template<typename T>
+bool isNegative(T value, std::true_type /* is_signed */) {
+    return value < 0;
+}
+
+template<typename T>
+bool isNegative(T, std::false_type /* is_signed */) {
+    return false;
+}
+
+template<typename dstType, typename srcType>
+dstType saturate(srcType value, std::true_type /* is_integral source */) {
+    using limits = std::numeric_limits<dstType>;
+    if (isNegative(value, std::is_signed<srcType>()))
+        return static_cast<int64_t>(value) < static_cast<int64_t>(limits::lowest()) ? limits::lowest() : static_cast<dstType>(value);
+    return static_cast<uint64_t>(value) > static_cast<uint64_t>(limits::max()) ? limits::max() : static_cast<dstType>(value);
+}
+
+template<typename dstType, typename srcType>
+dstType saturate(srcType srcValue, std::false_type /* is_integral source */) {
+    using limits = std::numeric_limits<dstType>;
+    // the bounds are representable in float, so the clamped value is truncated without overflow
+    static const float lowest = static_cast<float>(limits::lowest());
+    static const float highest = limits::digits <= std::numeric_limits<float>::digits
+                                 ? static_cast<float>(limits::max())
+                                 : std::nextafter(std::ldexp(1.f, limits::digits), 0.f);
+    // NaN is clamped to the lowest value as by the jit kernel
+    float value = static_cast<float>(srcValue);
+    value = value > lowest ? value : lowest;
+    value = value < highest ? value : highest;
+    return static_cast<dstType>(value);
+}
+
+// Integer destinations are saturated and floating point values are truncated towards zero before,
+// so the results are the same as the ones of the jit kernel
+template<typename dstType>
+struct SaturateCast {
+    template<typename srcType>
+    dstType operator()(srcType value) const {
+        return saturate<dstType>(value, std::is_integral<srcType>());
+    }
+};
+
+template<>
+struct SaturateCast<MKLDNNPlugin::bfloat16_t> {
+    template<typename srcType>
+    MKLDNNPlugin::bfloat16_t operator()(srcType value) const {
+        return toBfloat16(static_cast<float>(value));
+    }
+};
+
+// there is no direct conversion between the two 16 bits floating point types
+template<>
+struct SaturateCast<ngraph::float16> {
+    template<typename srcType>
+    ngraph::float16 operator()(srcType value) const {
+        return ngraph::float16(static_cast<float>(value));
+    }
+};
+
+template<>
+struct SaturateCast<float> {
+    template<typename srcType>
+    float operator()(srcType value) const {
+        return static_cast<float>(value);
+    }
+};
+
+// BOOL values are stored as U8, but they keep the plain cast
+template<typename dstType>
+struct StaticCast {
+    template<typename srcType>
+    dstType operator()(srcType value) const {
+        return static_cast<dstType>(value);
+    }
+};
+
+template<typename srcType, typename dstType, typename Cast>
+void convert(const void *srcPtr, void *dstPtr, const size_t size, const Cast& cast) {
     if (std::is_same<srcType, dstType>::value) {
         cpu_memcpy(dstPtr, srcPtr, size*sizeof(dstType));
     } else {
@@ -23,7 +420,7 @@ void convert(const void *srcPtr, void *dstPtr, const size_t size) {
         dstType *dstData = reinterpret_cast<dstType *>(dstPtr);
 
         parallel_for(size, [&](size_t i) {
-            dstData[i] = static_cast<dstType>(srcData[i]);
+            dstData[i] = cast(srcData[i]);
         });
     }
 }
@@ -38,10 +435,16 @@ struct PrecisionInfo<Precision::BF16> {
     using value_type = MKLDNNPlugin::bfloat16_t;
 };
 
+template <>
+struct PrecisionInfo<Precision::FP16> {
+    using value_type = ngraph::float16;
+};
+
 struct ConvertContext {
     const void *srcPtr;
     void *dstPtr;
     size_t size;
+    Precision dstPrc;
     bool converted;
 };
 
@@ -51,7 +454,10 @@ struct ConvertPrecision {
     using dst_t = typename std::tuple_element<1, T>::type;
 
     void operator()(ConvertContext & ctx) {
-        convert<src_t, dst_t>(ctx.srcPtr, ctx.dstPtr, ctx.size);
+        if (ctx.dstPrc == Precision::BOOL)
+            convert<src_t, dst_t>(ctx.srcPtr, ctx.dstPtr, ctx.size, StaticCast<dst_t>());
+        else
+            convert<src_t, dst_t>(ctx.srcPtr, ctx.dstPtr, ctx.size, SaturateCast<dst_t>());
         ctx.converted = true;
     }
 };
@@ -61,6 +467,17 @@ struct ConvertPrecision {
 #define MKLDNN_CVT(ST, DT) OV_CASE2(Precision::ST, Precision::DT, PrecisionInfo<Precision::ST>::value_type, PrecisionInfo<Precision::DT>::value_type)
 
 void cpu_convert(const void *srcPtr, void *dstPtr, Precision srcPrc, Precision dstPrc, const size_t size) {
+    if (srcPtr != nullptr && dstPtr != nullptr && srcPrc != dstPrc) {
+        if (auto kernel = getConvertKernel(srcPrc, dstPrc)) {
+            jitConvert(*kernel, srcPtr, dstPtr, srcPrc, dstPrc, size);
+            return;
+        }
+    }
+
+    cpu_convert_ref(srcPtr, dstPtr, srcPrc, dstPrc, size);
+}
+
+void cpu_convert_ref(const void *srcPtr, void *dstPtr, Precision srcPrc, Precision dstPrc, const size_t size) {
     using namespace MKLDNNPlugin;
 
     if (srcPtr == nullptr || dstPtr == nullptr)
@@ -71,7 +488,7 @@ void cpu_convert(const void *srcPtr, void *dstPtr, Precision srcPrc, Precision d
         return;
     }
 
-    ConvertContext ctx = { srcPtr, dstPtr, size, false };
+    ConvertContext ctx = { srcPtr, dstPtr, size, dstPrc, false };
 
     OV_SWITCH(MKLDNNPlugin, ConvertPrecision, ctx, std::tie(srcPrc, dstPrc),
     MKLDNN_CVT(U8, I8),    MKLDNN_CVT(U8, U16),    MKLDNN_CVT(U8, I16),
@@ -103,10 +520,15 @@ void cpu_convert(const void *srcPtr, void *dstPtr, Precision srcPrc, Precision d
     MKLDNN_CVT(BF16, I64), MKLDNN_CVT(BF16, FP32), MKLDNN_CVT(BF16, BOOL),
     MKLDNN_CVT(BOOL, U8),  MKLDNN_CVT(BOOL, I8),   MKLDNN_CVT(BOOL, U16),
     MKLDNN_CVT(BOOL, I16), MKLDNN_CVT(BOOL, I32),  MKLDNN_CVT(BOOL, U64),
-    MKLDNN_CVT(BOOL, I64), MKLDNN_CVT(BOOL, FP32), MKLDNN_CVT(BOOL, BF16));
+    MKLDNN_CVT(BOOL, I64), MKLDNN_CVT(BOOL, FP32), MKLDNN_CVT(BOOL, BF16),
+    MKLDNN_CVT(U8, FP16),  MKLDNN_CVT(I8, FP16),   MKLDNN_CVT(I32, FP16),
+    MKLDNN_CVT(FP32, FP16), MKLDNN_CVT(BF16, FP16), MKLDNN_CVT(FP16, U8),
+    MKLDNN_CVT(FP16, I8),  MKLDNN_CVT(FP16, I32),  MKLDNN_CVT(FP16, FP32),
+    MKLDNN_CVT(FP16, BF16));
 
     if (!ctx.converted)
         IE_THROW() << "cpu_convert can't convert from: " << srcPrc << " precision to: " << dstPrc;
 }
 
 #undef MKLDNN_CVT
+#undef GET_OFF
@@ -7,6 +7,9 @@
 /**
  * @brief Copy size elements from buffer specified srcPtr pointer to buffer specified dstPtr.
  * If the precisions srcPrc and dstPrc are different, a conversion from srcPrc to dstPrc is performed.
+ * Conversions between U8, I8, I32, FP16, BF16 and FP32 are vectorized (AVX2 or AVX-512) when available.
+ * Floating point values are truncated and integer results are saturated to the destination range
+ * (except BOOL destination), BF16 results are rounded to nearest even.
  * @param srcPtr
  * pointer to the buffer to convert from
  * @param dstPtr
@@ -21,3 +24,9 @@
  */
 
 void cpu_convert(const void *srcPtr, void *dstPtr, InferenceEngine::Precision srcPrc, InferenceEngine::Precision dstPrc, const size_t size);
+
+/**
+ * @brief Scalar implementation of cpu_convert, it is used when the vectorized conversion isn't available
+ * and gives the same results.
+ */
+void cpu_convert_ref(const void *srcPtr, void *dstPtr, InferenceEngine::Precision srcPrc, InferenceEngine::Precision dstPrc, const size_t size);
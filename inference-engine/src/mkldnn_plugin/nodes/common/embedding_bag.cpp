@@ -0,0 +1,225 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag.h"
+
+#include <cpu/x64/jit_generator.hpp>
+#include <mkldnn.hpp>  // TODO: just to replace mkldnn->dnnl via macros
+#include "utils/bfloat16.hpp"
+
+#include <cassert>
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+using namespace mkldnn;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_args_embedding_bag, field)
+
+struct jit_args_embedding_bag {
+    const void* src;
+    const void* next_src;
+    float* dst;
+    size_t work_amount;
+    float weight;
+};
+
+struct jit_embedding_bag_config_params {
+    Precision src_dt;
+};
+
+struct jit_uni_embedding_bag_kernel {
+    void (*ker_)(const jit_args_embedding_bag *);
+
+    void operator()(const jit_args_embedding_bag *args) { assert(ker_); ker_(args); }
+
+    jit_uni_embedding_bag_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_embedding_bag_kernel() {}
+
+    virtual void create_ker() = 0;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_embedding_bag_kernel_f32 : public jit_uni_embedding_bag_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_embedding_bag_kernel_f32)
+
+    jit_uni_embedding_bag_kernel_f32(jit_embedding_bag_config_params jcp) : jcp_(jcp), jit_uni_embedding_bag_kernel(), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_next_src, ptr[reg_params + GET_OFF(next_src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        uni_vbroadcastss(vmm_weight, ptr[reg_params + GET_OFF(weight)]);
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label exit_label;
+
+        const int src_data_size = jcp_.src_dt.size();
+        int step = vlen / sizeof(float);
+        L(main_loop_label); {
+            cmp(reg_work_amount, step);
+            jl(tail_loop_label, T_NEAR);
+
+            // the next row is fetched while the current one is accumulated
+            prefetcht0(ptr[reg_next_src]);
+
+            load_vector(vmm_src, ptr[reg_src], jcp_.src_dt);
+            uni_vmovups(vmm_dst, ptr[reg_dst]);
+            uni_vfmadd231ps(vmm_dst, vmm_src, vmm_weight);
+            uni_vmovups(ptr[reg_dst], vmm_dst);
+
+            add(reg_src, step * src_data_size);
+            add(reg_next_src, step * src_data_size);
+            add(reg_dst, step * sizeof(float));
+            sub(reg_work_amount, step);
+
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        step = 1;
+        L(tail_loop_label); {
+            cmp(reg_work_amount, step);
+            jl(exit_label, T_NEAR);
+
+            load_scalar(xmm_src, ptr[reg_src], jcp_.src_dt);
+            movss(xmm_dst, ptr[reg_dst]);
+            uni_vfmadd231ps(xmm_dst, xmm_src, xmm_weight);
+            movss(ptr[reg_dst], xmm_dst);
+
+            add(reg_src, step * src_data_size);
+            add(reg_dst, step * sizeof(float));
+            sub(reg_work_amount, step);
+
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    size_t vlen = cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_next_src = r9;
+    Xbyak::Reg64 reg_dst = r10;
+    Xbyak::Reg64 reg_work_amount = r11;
+    Xbyak::Reg64 reg_tmp_64 = r12;
+    Xbyak::Reg32 reg_tmp_32 = r12d;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_src = Vmm(0);
+    Xbyak::Xmm xmm_src = Xbyak::Xmm(0);
+    Vmm vmm_dst = Vmm(1);
+    Xbyak::Xmm xmm_dst = Xbyak::Xmm(1);
+    Vmm vmm_weight = Vmm(2);
+    Xbyak::Xmm xmm_weight = Xbyak::Xmm(2);
+
+    jit_embedding_bag_config_params jcp_;
+
+    inline void load_vector(Vmm vmm_src, const Xbyak::Address &op, Precision src_dt) {
+        switch (src_dt) {
+            case Precision::FP32:
+                uni_vmovups(vmm_src, op);
+                break;
+            case Precision::BF16:
+                uni_vpmovzxwd(vmm_src, op);
+                uni_vpslld(vmm_src, vmm_src, 16);
+                break;
+            case Precision::I8:
+                uni_vpmovsxbd(vmm_src, op);
+                uni_vcvtdq2ps(vmm_src, vmm_src);
+                break;
+            default:
+                assert(!"unknown src_dt");
+        }
+    }
+
+    inline void load_scalar(Xbyak::Xmm xmm_src, const Xbyak::Address &op, Precision src_dt) {
+        switch (src_dt) {
+            case Precision::FP32:
+                movss(xmm_src, op);
+                break;
+            case Precision::BF16:
+                pinsrw(xmm_src, op, 0x0);
+                uni_vpslld(xmm_src, xmm_src, 16);
+                break;
+            case Precision::I8:
+                movsx(reg_tmp_32, op);
+                movq(xmm_src, reg_tmp_64);
+                uni_vcvtdq2ps(xmm_src, xmm_src);
+                break;
+            default:
+                assert(!"unknown src_dt");
+        }
+    }
+};
+
+EmbeddingBagAccumulator::EmbeddingBagAccumulator(Precision tablePrc, size_t embDepth)
+    : table_prec(tablePrc), emb_depth(embDepth) {
+    if (!one_of(table_prec, Precision::FP32, Precision::BF16, Precision::I8))
+        IE_THROW() << "EmbeddingBagAccumulator doesn't support " << table_prec << " table precision";
+
+    auto jcp = jit_embedding_bag_config_params();
+    jcp.src_dt = table_prec;
+
+    if (mayiuse(x64::avx512_common)) {
+        emb_bag_kernel.reset(new jit_uni_embedding_bag_kernel_f32<x64::avx512_common>(jcp));
+    } else if (mayiuse(x64::avx2)) {
+        emb_bag_kernel.reset(new jit_uni_embedding_bag_kernel_f32<x64::avx2>(jcp));
+    } else if (mayiuse(x64::sse41)) {
+        emb_bag_kernel.reset(new jit_uni_embedding_bag_kernel_f32<x64::sse41>(jcp));
+    }
+    if (emb_bag_kernel)
+        emb_bag_kernel->create_ker();
+}
+
+void EmbeddingBagAccumulator::accumulate(float* dst, const uint8_t* row, const uint8_t* nextRow, float weight) const {
+    if (emb_bag_kernel) {
+        auto arg = jit_args_embedding_bag();
+        arg.src = row;
+        arg.next_src = nextRow ? nextRow : row;
+        arg.dst = dst;
+        arg.work_amount = emb_depth;
+        arg.weight = weight;
+        (*emb_bag_kernel)(&arg);
+        return;
+    }
+
+    switch (table_prec) {
+        case Precision::FP32: {
+            auto src = reinterpret_cast<const float*>(row);
+            for (size_t i = 0; i < emb_depth; i++)
+                dst[i] += src[i] * weight;
+            break;
+        }
+        case Precision::BF16: {
+            auto src = reinterpret_cast<const bfloat16_t*>(row);
+            for (size_t i = 0; i < emb_depth; i++)
+                dst[i] += static_cast<float>(src[i]) * weight;
+            break;
+        }
+        case Precision::I8: {
+            auto src = reinterpret_cast<const int8_t*>(row);
+            for (size_t i = 0; i < emb_depth; i++)
+                dst[i] += static_cast<float>(src[i]) * weight;
+            break;
+        }
+        default:
+            break;
+    }
+}
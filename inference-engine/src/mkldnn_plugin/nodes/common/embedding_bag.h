@@ -0,0 +1,30 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <ie_common.h>
+#include <ie_precision.hpp>
+
+struct jit_uni_embedding_bag_kernel;
+
+/**
+ * @brief Accumulates weighted rows of embedding table into FP32 buffer: dst[i] += row[i] * weight.
+ * Supported table precisions are FP32, BF16 and I8 (the row scale is passed as a part of the weight).
+ */
+class EmbeddingBagAccumulator {
+public:
+    EmbeddingBagAccumulator(InferenceEngine::Precision tablePrc, size_t embDepth);
+
+    /**
+     * @param nextRow row to be accumulated after this one, it is prefetched during the accumulation (may be nullptr)
+     */
+    void accumulate(float* dst, const uint8_t* row, const uint8_t* nextRow, float weight) const;
+
+private:
+    InferenceEngine::Precision table_prec;
+    size_t emb_depth;
+    std::shared_ptr<jit_uni_embedding_bag_kernel> emb_bag_kernel;
+};
@@ -0,0 +1,68 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "score_bucket_sorter.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+// for smaller sets plain sorting is cheaper than distribution into buckets
+const size_t minBucketedCount = 512;
+// average number of candidates per bucket and maximal number of buckets
+const size_t bucketCapacity = 32;
+const size_t maxBucketsNum = 4096;
+
+}  // namespace
+
+ScoreBucketSorter::ScoreBucketSorter(const float* scores, int* candidates, size_t count)
+        : scores(scores), candidates(candidates), count(count) {
+    bucketBegins = {0, count};
+    if (count < minBucketedCount)
+        return;
+
+    float minScore = scores[candidates[0]];
+    float maxScore = scores[candidates[0]];
+    for (size_t i = 1; i < count; i++) {
+        minScore = (std::min)(minScore, scores[candidates[i]]);
+        maxScore = (std::max)(maxScore, scores[candidates[i]]);
+    }
+    if (!std::isfinite(maxScore - minScore) || maxScore == minScore)
+        return;
+
+    // the bucket index doesn't increase with the score, so the buckets follow in the descending score order
+    const size_t bucketsNum = (std::min)(count / bucketCapacity, maxBucketsNum);
+    const float scale = static_cast<float>(bucketsNum) / (maxScore - minScore);
+    auto getBucket = [&](int idx) -> size_t {
+        const float pos = (maxScore - scores[idx]) * scale;
+        return pos < static_cast<float>(bucketsNum) ? static_cast<size_t>(pos) : bucketsNum - 1;
+    };
+
+    bucketBegins.assign(bucketsNum + 1, 0);
+    for (size_t i = 0; i < count; i++)
+        bucketBegins[getBucket(candidates[i]) + 1]++;
+    for (size_t b = 0; b < bucketsNum; b++)
+        bucketBegins[b + 1] += bucketBegins[b];
+
+    std::vector<int> distributed(count);
+    std::vector<size_t> bucketEnds(bucketBegins.begin(), bucketBegins.end() - 1);
+    for (size_t i = 0; i < count; i++)
+        distributed[bucketEnds[getBucket(candidates[i])]++] = candidates[i];
+    std::copy(distributed.begin(), distributed.end(), candidates);
+}
+
+size_t ScoreBucketSorter::sortFirst(size_t num) {
+    num = (std::min)(num, count);
+    while (bucketBegins[sortedBuckets] < num) {
+        std::sort(candidates + bucketBegins[sortedBuckets], candidates + bucketBegins[sortedBuckets + 1],
+                  [&](int l, int r) {
+                      return scores[l] > scores[r] || (scores[l] == scores[r] && l < r);
+                  });
+        sortedBuckets++;
+    }
+    return num;
+}
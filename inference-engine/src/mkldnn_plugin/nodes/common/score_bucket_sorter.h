@@ -0,0 +1,43 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Orders box indices by descending score (equal scores are ordered by ascending index) on demand.
+ * The candidates are distributed into score ranges in linear time and a range is sorted only when the requested
+ * number of the best candidates reaches it. Detection layers usually consume just the head of the candidates list,
+ * so for large candidate sets most of the ranges are never sorted.
+ */
+class ScoreBucketSorter {
+public:
+    /**
+     * @param scores scores of the boxes addressed by the candidates
+     * @param candidates indices of the boxes to be ordered, reordered in place
+     * @param count number of the candidates
+     */
+    ScoreBucketSorter(const float* scores, int* candidates, size_t count);
+
+    /**
+     * @brief Makes the first num candidates ordered
+     * @return number of the ordered candidates, which is less than num if there are fewer candidates
+     */
+    size_t sortFirst(size_t num);
+
+private:
+    const float* scores;
+    int* candidates;
+    size_t count;
+
+    // the candidates of the i-th bucket are stored in [bucketBegins[i], bucketBegins[i + 1])
+    std::vector<size_t> bucketBegins;
+    size_t sortedBuckets = 0;
+};
+
+}  // namespace MKLDNNPlugin
@@ -13,6 +13,8 @@
 #include "caseless.hpp"
 #include "ie_parallel.hpp"
 #include "common/tensor_desc_creator.h"
+#include "common/score_bucket_sorter.h"
+#include "box_overlap_imp.hpp"
 #include <ngraph/op/detection_output.hpp>
 
 namespace InferenceEngine {
@@ -20,12 +22,7 @@ namespace Extensions {
 namespace Cpu {
 
 using MKLDNNPlugin::TensorDescCreatorTypes;
-
-template <typename T>
-static bool SortScorePairDescend(const std::pair<float, T>& pair1,
-                                 const std::pair<float, T>& pair2) {
-    return pair1.first > pair2.first;
-}
+using MKLDNNPlugin::ScoreBucketSorter;
 
 class DetectionOutputImpl: public ExtLayerBase {
 public:
@@ -181,27 +178,23 @@ public:
         }
 
         if (with_add_box_pred) {
-            for (int n = 0; n < N; ++n) {
-                for (int p = 0; p < _num_priors; ++p) {
-                    if (arm_conf_data[n*_num_priors*2 + p * 2 + 1] < _objectness_score) {
-                        for (int c = 0; c < _num_classes; ++c) {
-                            reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = c == _background_label_id ? 1.0f : 0.0f;
-                        }
-                    } else {
-                        for (int c = 0; c < _num_classes; ++c) {
-                            reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
-                        }
+            parallel_for2d(N, _num_priors, [&](int n, int p) {
+                if (arm_conf_data[n*_num_priors*2 + p * 2 + 1] < _objectness_score) {
+                    for (int c = 0; c < _num_classes; ++c) {
+                        reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = c == _background_label_id ? 1.0f : 0.0f;
                     }
-                }
-            }
-        } else {
-            for (int n = 0; n < N; ++n) {
-                for (int c = 0; c < _num_classes; ++c) {
-                    for (int p = 0; p < _num_priors; ++p) {
+                } else {
+                    for (int c = 0; c < _num_classes; ++c) {
                         reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
                     }
                 }
-            }
+            });
+        } else {
+            parallel_for2d(N, _num_classes, [&](int n, int c) {
+                for (int p = 0; p < _num_priors; ++p) {
+                    reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
+                }
+            });
         }
 
         memset(detections_data, 0, N*_num_classes*sizeof(int));
@@ -249,30 +242,29 @@ public:
             }
 
             if (_keep_top_k > -1 && detections_total > _keep_top_k) {
-                std::vector<std::pair<float, std::pair<int, int>>> conf_index_class_map;
+                // detections are addressed by their offsets in the reordered confidences of the image
+                std::vector<int> conf_class_indices;
+                conf_class_indices.reserve(detections_total);
 
                 for (int c = 0; c < _num_classes; ++c) {
                     int detections = detections_data[n*_num_classes + c];
                     int *pindices = indices_data + n*_num_classes*_num_priors + c*_num_priors;
 
-                    float *pconf  = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
-
                     for (int i = 0; i < detections; ++i) {
-                        int idx = pindices[i];
-                        conf_index_class_map.push_back(std::make_pair(pconf[idx], std::make_pair(c, idx)));
+                        conf_class_indices.push_back(c*_num_priors + pindices[i]);
                     }
                 }
 
-                std::sort(conf_index_class_map.begin(), conf_index_class_map.end(),
-                          SortScorePairDescend<std::pair<int, int>>);
-                conf_index_class_map.resize(_keep_top_k);
+                const float *pconf = reordered_conf_data + n*_num_classes*_num_priors;
+                ScoreBucketSorter(pconf, conf_class_indices.data(), conf_class_indices.size()).sortFirst(_keep_top_k);
+                conf_class_indices.resize(_keep_top_k);
 
                 // Store the new indices.
                 memset(detections_data + n*_num_classes, 0, _num_classes * sizeof(int));
 
-                for (size_t j = 0; j < conf_index_class_map.size(); ++j) {
-                    int label = conf_index_class_map[j].second.first;
-                    int idx = conf_index_class_map[j].second.second;
+                for (size_t j = 0; j < conf_class_indices.size(); ++j) {
+                    int label = conf_class_indices[j] / _num_priors;
+                    int idx = conf_class_indices[j] % _num_priors;
                     int *pindices = indices_data + n * _num_classes * _num_priors + label * _num_priors;
                     pindices[detections_data[n*_num_classes + label]] = idx;
                     detections_data[n*_num_classes + label]++;
@@ -407,18 +399,6 @@ private:
     std::vector<int> _num_priors_actual;
 };
 
-struct ConfidenceComparator {
-    explicit ConfidenceComparator(const float* conf_data) : _conf_data(conf_data) {}
-
-    bool operator()(int idx1, int idx2) {
-        if (_conf_data[idx1] > _conf_data[idx2]) return true;
-        if (_conf_data[idx1] < _conf_data[idx2]) return false;
-        return idx1 < idx2;
-    }
-
-    const float* _conf_data;
-};
-
 static inline float JaccardOverlap(const float *decoded_bbox,
                                    const float *bbox_sizes,
                                    const int idx1,
@@ -575,26 +555,29 @@ void DetectionOutputImpl::nms_cf(const float* conf_data,
 
     int num_output_scores = (_top_k == -1 ? count : (std::min)(_top_k, count));
 
-    std::partial_sort_copy(indices, indices + count,
-                           buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
+    // only the top_k best candidates are ordered
+    ScoreBucketSorter(conf_data, indices, count).sortFirst(num_output_scores);
+    std::copy(indices, indices + num_output_scores, buffer);
+
+    // kept boxes are stored coordinate-wise for the vectorized overlap computation
+    std::vector<float> kept_xmin(num_output_scores), kept_ymin(num_output_scores),
+                       kept_xmax(num_output_scores), kept_ymax(num_output_scores), kept_size(num_output_scores);
 
     for (int i = 0; i < num_output_scores; ++i) {
         const int idx = buffer[i];
-
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
-            indices[detections] = idx;
-            detections++;
-        }
+        const float bbox[5] = {bboxes[idx*4 + 0], bboxes[idx*4 + 1], bboxes[idx*4 + 2], bboxes[idx*4 + 3], sizes[idx]};
+
+        if (XARCH::box_overlaps_any(bbox, kept_xmin.data(), kept_ymin.data(), kept_xmax.data(), kept_ymax.data(), kept_size.data(),
+                                    detections, _nms_threshold, false))
+            continue;
+
+        kept_xmin[detections] = bbox[0];
+        kept_ymin[detections] = bbox[1];
+        kept_xmax[detections] = bbox[2];
+        kept_ymax[detections] = bbox[3];
+        kept_size[detections] = bbox[4];
+        indices[detections] = idx;
+        detections++;
     }
 }
 
@@ -624,9 +607,8 @@ void DetectionOutputImpl::nms_mx(const float* conf_data,
 
     int num_output_scores = (_top_k == -1 ? count : (std::min)(_top_k, count));
 
-    std::partial_sort_copy(indices, indices + count,
-                           buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
+    ScoreBucketSorter(conf_data, indices, count).sortFirst(num_output_scores);
+    std::copy(indices, indices + num_output_scores, buffer);
 
     for (int i = 0; i < num_output_scores; ++i) {
         const int idx = buffer[i];
@@ -22,6 +22,7 @@ public:
     void createPrimitive() override;
     void selectOptimalPrimitiveDescriptor() override;
     bool created() const override;
+    bool readsInputOnExecute(size_t port) const override { return true; }
     void execute(mkldnn::stream strm) override;
 
     bool isOptimized() const;
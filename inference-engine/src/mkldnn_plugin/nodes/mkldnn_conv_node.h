@@ -27,6 +27,7 @@ public:
     void initSupportedPrimitiveDescriptors() override;
     void filterSupportedPrimitiveDescriptors() override;
     bool created() const override;
+    bool readsInputOnExecute(size_t port) const override { return true; }
     bool canBeInPlace() const override {
         return false;
     }
@@ -0,0 +1,439 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+
+#include "mkldnn_einsum_node.h"
+#include "ie_parallel.hpp"
+#include "utils/general_utils.h"
+#include <ngraph/opsets/opset7.hpp>
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+// Labels of a view collapsed into one GEMM matrix dimension
+struct MatrixGroup {
+    size_t size = 1;
+    size_t stride = 1;
+    bool collapsible = true;
+};
+
+std::vector<size_t> denseStrides(const std::string& labels, const std::map<char, size_t>& labelDims) {
+    std::vector<size_t> strides(labels.size(), 1);
+    for (size_t i = labels.size(); i-- > 1;)
+        strides[i - 1] = strides[i] * labelDims.at(labels[i]);
+    return strides;
+}
+
+size_t labelsSize(const std::string& labels, const std::map<char, size_t>& labelDims) {
+    size_t size = 1;
+    for (char label : labels)
+        size *= labelDims.at(label);
+    return size;
+}
+
+char flipTranspose(char trans) {
+    return trans == 'N' ? 'T' : 'N';
+}
+
+// Checks that the matrix rows and columns can be addressed by GEMM leading dimension
+bool getMatrixLayout(const MatrixGroup& rows, const MatrixGroup& cols, char& trans, int& ld) {
+    if (!rows.collapsible || !cols.collapsible)
+        return false;
+
+    if ((cols.size == 1 || cols.stride == 1) && (rows.size == 1 || rows.stride >= cols.size)) {
+        trans = 'N';
+        ld = static_cast<int>(rows.size == 1 ? cols.size : rows.stride);
+        return true;
+    }
+    if ((rows.size == 1 || rows.stride == 1) && (cols.size == 1 || cols.stride >= rows.size)) {
+        trans = 'T';
+        ld = static_cast<int>(cols.size == 1 ? rows.size : cols.stride);
+        return true;
+    }
+    return false;
+}
+
+}  // namespace
+
+bool MKLDNNEinsumNode::isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto einsum = std::dynamic_pointer_cast<const ngraph::opset7::Einsum>(op);
+        if (!einsum) {
+            errorMessage = "Only opset7 Einsum operation is supported";
+            return false;
+        }
+
+        std::vector<std::string> inputSubscripts;
+        std::string outputSubscript;
+        ngraph::opset7::Einsum::parse_equation(einsum->get_equation(), inputSubscripts, outputSubscript);
+        inputSubscripts.push_back(outputSubscript);
+        for (const auto& subscript : inputSubscripts) {
+            for (const auto& label : ngraph::opset7::Einsum::extract_labels(subscript)) {
+                if (label.size() != 1) {
+                    errorMessage = "Ellipsis is not supported";
+                    return false;
+                }
+            }
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNEinsumNode::MKLDNNEinsumNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
+        MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "Einsum node with name '" + getName() + "'";
+    const auto einsum = std::dynamic_pointer_cast<const ngraph::opset7::Einsum>(op);
+    ngraph::opset7::Einsum::parse_equation(einsum->get_equation(), inputSubscripts, outputSubscript);
+    if (inputSubscripts.size() != getOriginalInputsNumber())
+        IE_THROW() << errorPrefix << " has incorrect number of input edges";
+
+    for (size_t i = 0; i < inputSubscripts.size(); i++) {
+        const auto dims = inDims[i].ToSizeVector();
+        if (dims.size() != inputSubscripts[i].size())
+            IE_THROW() << errorPrefix << " has input " << i << " with rank that doesn't match the equation";
+        for (size_t d = 0; d < dims.size(); d++) {
+            const auto dim = labelDims.insert({inputSubscripts[i][d], dims[d]});
+            if (dim.first->second != dims[d])
+                IE_THROW() << errorPrefix << " has inconsistent dimensions for label '" << inputSubscripts[i][d] << "'";
+        }
+    }
+}
+
+void MKLDNNEinsumNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    std::vector<DataConfigurator> inDataConfigurators(getOriginalInputsNumber(), {TensorDescCreatorTypes::ncsp, Precision::FP32});
+    addSupportedPrimDesc(inDataConfigurators,
+                         {{TensorDescCreatorTypes::ncsp, Precision::FP32}},
+                         impl_desc_type::gemm_any);
+}
+
+void MKLDNNEinsumNode::createPrimitive() {
+    if (!steps.empty())
+        return;
+
+    planSteps();
+    buffers.resize(bufferSizes.size());
+    for (size_t i = 0; i < bufferSizes.size(); i++)
+        buffers[i].resize(bufferSizes[i]);
+}
+
+MKLDNNEinsumNode::TensorView MKLDNNEinsumNode::makeBuffer(const std::string& labels) {
+    bufferSizes.push_back(labelsSize(labels, labelDims));
+    return {DataKind::Buffer, bufferSizes.size() - 1, labels, denseStrides(labels, labelDims)};
+}
+
+MKLDNNEinsumNode::TensorView MKLDNNEinsumNode::addReduceStep(const TensorView& src, const TensorView& dst) {
+    Step step;
+    step.isGemm = false;
+    auto& reduce = step.reduce;
+    reduce.src = src;
+    reduce.dst = dst;
+    for (size_t i = 0; i < dst.labels.size(); i++) {
+        reduce.dims.push_back(labelDims.at(dst.labels[i]));
+        reduce.srcStrides.push_back(src.strides[src.labels.find(dst.labels[i])]);
+        reduce.dstStrides.push_back(dst.strides[i]);
+    }
+
+    reduce.reduceOffsets = {0};
+    for (size_t i = 0; i < src.labels.size(); i++) {
+        if (dst.labels.find(src.labels[i]) != std::string::npos)
+            continue;
+        std::vector<size_t> offsets;
+        for (size_t offset : reduce.reduceOffsets)
+            for (size_t idx = 0; idx < labelDims.at(src.labels[i]); idx++)
+                offsets.push_back(offset + idx * src.strides[i]);
+        reduce.reduceOffsets = std::move(offsets);
+    }
+
+    steps.push_back(std::move(step));
+    return dst;
+}
+
+MKLDNNEinsumNode::TensorView MKLDNNEinsumNode::addReduceStep(const TensorView& src, const std::string& dstLabels) {
+    return addReduceStep(src, makeBuffer(dstLabels));
+}
+
+MKLDNNEinsumNode::TensorView MKLDNNEinsumNode::addContraction(TensorView a, TensorView b, const std::string& keptLabels, bool toOutput) {
+    auto isKept = [&](char label) {
+        return keptLabels.find(label) != std::string::npos;
+    };
+    auto strideOf = [](const TensorView& view, char label) {
+        return view.strides[view.labels.find(label)];
+    };
+    auto sortByStride = [&](std::string labels, const TensorView& view) {
+        std::stable_sort(labels.begin(), labels.end(), [&](char l, char r) {
+            return strideOf(view, l) > strideOf(view, r);
+        });
+        return labels;
+    };
+    auto collapse = [&](const std::string& labels, const TensorView& view) {
+        MatrixGroup group;
+        size_t outerStride = 0;
+        for (char label : labels) {
+            const size_t dim = labelDims.at(label);
+            if (dim == 1)
+                continue;
+            const size_t stride = strideOf(view, label);
+            if (group.size != 1 && outerStride != stride * dim)
+                group.collapsible = false;
+            outerStride = stride;
+            group.size *= dim;
+            group.stride = stride;
+        }
+        return group;
+    };
+
+    // labels used by a single operand only are summed up before the multiplication
+    auto reduceUnused = [&](const TensorView& view, const TensorView& other) {
+        std::string used;
+        for (char label : view.labels) {
+            if (isKept(label) || other.labels.find(label) != std::string::npos)
+                used += label;
+        }
+        return used.size() == view.labels.size() ? view : addReduceStep(view, used);
+    };
+    a = reduceUnused(a, b);
+    b = reduceUnused(b, a);
+
+    std::string batch, m, n, k;
+    for (char label : a.labels) {
+        if (b.labels.find(label) == std::string::npos)
+            m += label;
+        else if (isKept(label))
+            batch += label;
+        else
+            k += label;
+    }
+    for (char label : b.labels) {
+        if (a.labels.find(label) == std::string::npos)
+            n += label;
+    }
+
+    // the order of M and N labels is defined by the destination, the order of K labels has to match in both operands
+    TensorView result;
+    if (toOutput) {
+        result = {DataKind::Output, 0, outputSubscript, denseStrides(outputSubscript, labelDims)};
+        m = sortByStride(m, result);
+        n = sortByStride(n, result);
+    } else {
+        m = sortByStride(m, a);
+        n = sortByStride(n, b);
+    }
+    k = collapse(sortByStride(k, a), a).collapsible ? sortByStride(k, a) : sortByStride(k, b);
+    if (!toOutput)
+        result = makeBuffer(batch + m + n);
+
+    Step step;
+    step.isGemm = true;
+    auto& gemm = step.gemm;
+
+    // operands which can't be addressed as matrices are transposed explicitly
+    if (!getMatrixLayout(collapse(m, a), collapse(k, a), gemm.transA, gemm.lda)) {
+        a = addReduceStep(a, batch + m + k);
+        getMatrixLayout(collapse(m, a), collapse(k, a), gemm.transA, gemm.lda);
+    }
+    if (!getMatrixLayout(collapse(k, b), collapse(n, b), gemm.transB, gemm.ldb)) {
+        b = addReduceStep(b, batch + k + n);
+        getMatrixLayout(collapse(k, b), collapse(n, b), gemm.transB, gemm.ldb);
+    }
+    TensorView c = result;
+    char transC;
+    if (!getMatrixLayout(collapse(m, c), collapse(n, c), transC, gemm.ldc)) {
+        c = makeBuffer(batch + m + n);
+        getMatrixLayout(collapse(m, c), collapse(n, c), transC, gemm.ldc);
+    }
+
+    gemm.a = a;
+    gemm.b = b;
+    gemm.c = c;
+    gemm.M = static_cast<int>(labelsSize(m, labelDims));
+    gemm.N = static_cast<int>(labelsSize(n, labelDims));
+    gemm.K = static_cast<int>(labelsSize(k, labelDims));
+    for (char label : batch) {
+        gemm.batchDims.push_back(labelDims.at(label));
+        gemm.aBatchStrides.push_back(strideOf(a, label));
+        gemm.bBatchStrides.push_back(strideOf(b, label));
+        gemm.cBatchStrides.push_back(strideOf(c, label));
+    }
+    // column-major destination is computed as C^T = B^T * A^T
+    if (transC == 'T') {
+        std::swap(gemm.a, gemm.b);
+        std::swap(gemm.aBatchStrides, gemm.bBatchStrides);
+        std::swap(gemm.M, gemm.N);
+        std::swap(gemm.lda, gemm.ldb);
+        std::swap(gemm.transA, gemm.transB);
+        gemm.transA = flipTranspose(gemm.transA);
+        gemm.transB = flipTranspose(gemm.transB);
+    }
+    steps.push_back(std::move(step));
+
+    if (c.kind != result.kind || c.index != result.index)
+        addReduceStep(c, result);
+    return result;
+}
+
+void MKLDNNEinsumNode::planSteps() {
+    std::vector<TensorView> operands;
+    for (size_t i = 0; i < inputSubscripts.size(); i++) {
+        // repeated labels address the diagonal, so their strides are summed up
+        const auto& subscript = inputSubscripts[i];
+        const auto strides = denseStrides(subscript, labelDims);
+        TensorView view = {DataKind::Input, i, "", {}};
+        for (size_t d = 0; d < subscript.size(); d++) {
+            const auto pos = view.labels.find(subscript[d]);
+            if (pos == std::string::npos) {
+                view.labels += subscript[d];
+                view.strides.push_back(strides[d]);
+            } else {
+                view.strides[pos] += strides[d];
+            }
+        }
+        operands.push_back(view);
+    }
+
+    auto getKeptLabels = [&](size_t first, size_t second) {
+        std::string kept = outputSubscript;
+        for (size_t i = 0; i < operands.size(); i++) {
+            if (i != first && i != second)
+                kept += operands[i].labels;
+        }
+        return kept;
+    };
+
+    while (operands.size() > 1) {
+        // the pair with the smallest result is contracted first, the number of multiplications breaks ties
+        size_t bestFirst = 0, bestSecond = 1;
+        std::pair<size_t, size_t> bestCost = {std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max()};
+        for (size_t i = 0; i < operands.size(); i++) {
+            for (size_t j = i + 1; j < operands.size(); j++) {
+                const auto kept = getKeptLabels(i, j);
+                std::string allLabels = operands[i].labels, resultLabels;
+                for (char label : operands[j].labels) {
+                    if (allLabels.find(label) == std::string::npos)
+                        allLabels += label;
+                }
+                for (char label : allLabels) {
+                    if (kept.find(label) != std::string::npos)
+                        resultLabels += label;
+                }
+                const std::pair<size_t, size_t> cost = {labelsSize(resultLabels, labelDims), labelsSize(allLabels, labelDims)};
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestFirst = i;
+                    bestSecond = j;
+                }
+            }
+        }
+
+        const auto kept = getKeptLabels(bestFirst, bestSecond);
+        const auto result = addContraction(operands[bestFirst], operands[bestSecond], kept, operands.size() == 2);
+        operands.erase(operands.begin() + bestSecond);
+        operands.erase(operands.begin() + bestFirst);
+        operands.push_back(result);
+    }
+
+    if (operands.front().kind != DataKind::Output)
+        addReduceStep(operands.front(), {DataKind::Output, 0, outputSubscript, denseStrides(outputSubscript, labelDims)});
+}
+
+const float* MKLDNNEinsumNode::getData(const TensorView& view) const {
+    switch (view.kind) {
+        case DataKind::Input:
+            return reinterpret_cast<const float*>(getParentEdgeAt(view.index)->getMemoryPtr()->GetPtr());
+        case DataKind::Output:
+            return reinterpret_cast<const float*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+        default:
+            return buffers[view.index].data();
+    }
+}
+
+float* MKLDNNEinsumNode::getData(const TensorView& view) {
+    if (view.kind == DataKind::Input)
+        IE_THROW() << errorPrefix << " can't write to the input memory";
+    return const_cast<float*>(static_cast<const MKLDNNEinsumNode*>(this)->getData(view));
+}
+
+void MKLDNNEinsumNode::executeReduce(const ReduceStep& step) {
+    const float* src = static_cast<const MKLDNNEinsumNode*>(this)->getData(step.src);
+    float* dst = getData(step.dst);
+
+    const size_t rank = step.dims.size();
+    const size_t work = std::accumulate(step.dims.begin(), step.dims.end(), size_t(1), std::multiplies<size_t>());
+    parallel_for(work, [&](size_t i) {
+        size_t srcOffset = 0, dstOffset = 0;
+        for (size_t d = rank; d-- > 0;) {
+            const size_t idx = i % step.dims[d];
+            i /= step.dims[d];
+            srcOffset += idx * step.srcStrides[d];
+            dstOffset += idx * step.dstStrides[d];
+        }
+
+        float sum = 0.f;
+        for (size_t offset : step.reduceOffsets)
+            sum += src[srcOffset + offset];
+        dst[dstOffset] = sum;
+    });
+}
+
+void MKLDNNEinsumNode::executeGemm(const GemmStep& step) {
+    const float* a = static_cast<const MKLDNNEinsumNode*>(this)->getData(step.a);
+    const float* b = static_cast<const MKLDNNEinsumNode*>(this)->getData(step.b);
+    float* c = getData(step.c);
+
+    const size_t batch = std::accumulate(step.batchDims.begin(), step.batchDims.end(), size_t(1), std::multiplies<size_t>());
+    auto multiply = [&](size_t i) {
+        size_t aOffset = 0, bOffset = 0, cOffset = 0;
+        for (size_t d = step.batchDims.size(); d-- > 0;) {
+            const size_t idx = i % step.batchDims[d];
+            i /= step.batchDims[d];
+            aOffset += idx * step.aBatchStrides[d];
+            bOffset += idx * step.bBatchStrides[d];
+            cOffset += idx * step.cBatchStrides[d];
+        }
+        mkldnn_sgemm(step.transA, step.transB, step.M, step.N, step.K, 1.f, a + aOffset, step.lda,
+                     b + bOffset, step.ldb, 0.f, c + cOffset, step.ldc);
+    };
+
+    // many small matrices (e.g. attention heads) are distributed between threads, big ones are parallelized by GEMM itself
+    if (batch > 1 && batch >= static_cast<size_t>(parallel_get_max_threads())) {
+        parallel_for(batch, multiply);
+    } else {
+        for (size_t i = 0; i < batch; i++)
+            multiply(i);
+    }
+}
+
+void MKLDNNEinsumNode::execute(mkldnn::stream strm) {
+    for (const auto& step : steps) {
+        if (step.isGemm)
+            executeGemm(step.gemm);
+        else
+            executeReduce(step.reduce);
+    }
+}
+
+bool MKLDNNEinsumNode::created() const {
+    return getType() == Einsum;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNEinsumNode, Einsum)
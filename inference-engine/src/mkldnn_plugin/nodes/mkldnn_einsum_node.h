@@ -0,0 +1,101 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Einsum is executed as a sequence of pairwise contractions. Each contraction is mapped onto a batched GEMM
+ * over strided views of the operands, so the transposition of an operand is materialized only if its labels
+ * can't be collapsed into GEMM matrix dimensions. The contraction order is chosen greedily by the size of
+ * intermediate results.
+ */
+class MKLDNNEinsumNode : public MKLDNNNode {
+public:
+    MKLDNNEinsumNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    enum class DataKind {
+        Input,
+        Buffer,
+        Output
+    };
+
+    // Element of the view with label indices {i_l} is located at sum_l(i_l * strides[l]) (labels are single characters)
+    struct TensorView {
+        DataKind kind;
+        size_t index;
+        std::string labels;
+        std::vector<size_t> strides;
+    };
+
+    // dst = src summed over the labels missing in dst, used for transposition and diagonal extraction as well
+    struct ReduceStep {
+        TensorView src;
+        TensorView dst;
+        std::vector<size_t> dims;
+        std::vector<size_t> srcStrides;
+        std::vector<size_t> dstStrides;
+        std::vector<size_t> reduceOffsets;
+    };
+
+    // C = A * B for each combination of batch labels, the other labels are collapsed into M, N and K
+    struct GemmStep {
+        TensorView a;
+        TensorView b;
+        TensorView c;
+        std::vector<size_t> batchDims;
+        std::vector<size_t> aBatchStrides;
+        std::vector<size_t> bBatchStrides;
+        std::vector<size_t> cBatchStrides;
+        char transA;
+        char transB;
+        int M, N, K;
+        int lda, ldb, ldc;
+    };
+
+    struct Step {
+        bool isGemm;
+        ReduceStep reduce;
+        GemmStep gemm;
+    };
+
+    TensorView makeBuffer(const std::string& labels);
+    TensorView addReduceStep(const TensorView& src, const TensorView& dst);
+    TensorView addReduceStep(const TensorView& src, const std::string& dstLabels);
+    TensorView addContraction(TensorView a, TensorView b, const std::string& keptLabels, bool toOutput);
+    void planSteps();
+
+    const float* getData(const TensorView& view) const;
+    float* getData(const TensorView& view);
+    void executeReduce(const ReduceStep& step);
+    void executeGemm(const GemmStep& step);
+
+    std::vector<std::string> inputSubscripts;
+    std::string outputSubscript;
+    std::map<char, size_t> labelDims;
+
+    std::vector<Step> steps;
+    std::vector<size_t> bufferSizes;
+    std::vector<std::vector<float>> buffers;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
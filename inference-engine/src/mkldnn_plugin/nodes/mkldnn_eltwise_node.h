@@ -68,6 +68,7 @@ public:
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
+    bool readsInputOnExecute(size_t port) const override { return true; }
     bool canBeInPlace() const override;
     bool canFuse(const MKLDNNNodePtr& node) const override;
     void appendPostOps(mkldnn::post_ops& ops) override;
@@ -45,22 +45,9 @@ void MKLDNNEmbeddingBagOffsetSumNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
-    std::string logPrefix = std::string("Layer EmbeddingBagSum with name '") + _layerName + "' ";
-    static const std::set<Precision> supportedPrecisions =
-            {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
-
-    auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
-        inDataPrecision = Precision::FP32;
-    if (!supportedPrecisions.empty()) {
-        if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
-            IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
-    } else {
-        static const std::set<Precision> defaultSupportedPrecisions =
-                {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
-        if (defaultSupportedPrecisions.find(inDataPrecision) == defaultSupportedPrecisions.end())
-            IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
-    }
+    Precision inDataPrecision, weightsPrecision, outDataPrecision;
+    getSupportedPrecisions(getOriginalInputPrecisionAtPort(EMB_TABLE_IDX), getOriginalOutputPrecisionAtPort(0),
+                           inDataPrecision, weightsPrecision, outDataPrecision);
 
     std::vector<DataConfigurator> inDataConfigurators({{TensorDescCreatorTypes::ncsp, inDataPrecision},
                                                        {TensorDescCreatorTypes::ncsp, Precision::I32},
@@ -68,9 +55,9 @@ void MKLDNNEmbeddingBagOffsetSumNode::initSupportedPrimitiveDescriptors() {
     if (getOriginalInputsNumber() > DEFAULT_INDEX_IDX)
         inDataConfigurators.push_back({TensorDescCreatorTypes::ncsp, Precision::I32});
     if (getOriginalInputsNumber() > PER_SAMPLE_WEIGHTS_IDX)
-        inDataConfigurators.push_back({TensorDescCreatorTypes::ncsp, inDataPrecision});
+        inDataConfigurators.push_back({TensorDescCreatorTypes::ncsp, weightsPrecision});
 
-    addSupportedPrimDesc(inDataConfigurators, {{TensorDescCreatorTypes::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+    addSupportedPrimDesc(inDataConfigurators, {{TensorDescCreatorTypes::ncsp, outDataPrecision}}, impl_desc_type::ref_any);
 }
 
 void MKLDNNEmbeddingBagOffsetSumNode::initFromInputs() {
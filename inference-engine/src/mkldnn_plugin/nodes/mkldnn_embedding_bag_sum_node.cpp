@@ -2,14 +2,18 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <vector>
+#include <set>
 #include <string>
 #include <mkldnn_types.h>
 #include "ie_parallel.hpp"
 #include "mkldnn_embedding_bag_sum_node.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "common/cpu_convert.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -42,6 +46,109 @@ MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
     }
 }
 
+void MKLDNNEmbeddingBagSumNode::getSupportedPrecisions(Precision origTablePrc, Precision origOutPrc,
+                                                       Precision& tablePrc, Precision& weightsPrc, Precision& outPrc) const {
+    static const std::set<Precision> supportedPrecisions =
+            {Precision::FP32, Precision::BF16, Precision::I8, Precision::U8, Precision::I32};
+    if (supportedPrecisions.find(origTablePrc) == supportedPrecisions.end())
+        IE_THROW() << "Layer EmbeddingBagSum with name '" << _layerName << "' has unsupported precision: " << origTablePrc.name();
+
+    if (!_tableScales.empty()) {
+        tablePrc = Precision::I8;
+        weightsPrc = Precision::FP32;
+        outPrc = origOutPrc == Precision::BF16 ? Precision::BF16 : Precision::FP32;
+    } else if (origTablePrc == Precision::BF16) {
+        tablePrc = Precision::BF16;
+        weightsPrc = Precision::FP32;
+        outPrc = Precision::BF16;
+    } else {
+        tablePrc = weightsPrc = outPrc = origTablePrc;
+    }
+}
+
+void MKLDNNEmbeddingBagSumNode::processFloatData(const uint8_t* srcData, const float* weightsData, uint8_t* dstData,
+                                                 const InferenceEngine::TensorDesc& srcDesc, const InferenceEngine::TensorDesc& dstDesc) {
+    initFromInputs();
+
+    const auto srcPrc = srcDesc.getPrecision();
+    const auto dstPrc = dstDesc.getPrecision();
+    if (!_accumulator)
+        _accumulator = std::make_shared<EmbeddingBagAccumulator>(srcPrc, _embDepth);
+
+    const int64_t tableRows = static_cast<int64_t>(srcDesc.getDims()[0]);
+    const size_t rowSize = _embDepth * srcPrc.size();
+    const size_t outputBagsNum = dstDesc.getDims()[0];
+
+    // bags have different sizes: threads get contiguous ranges of bags with (almost) equal number of accumulated rows
+    std::vector<size_t> bagCosts(outputBagsNum + 1, 0lu);
+    for (size_t obi = 0; obi < outputBagsNum; obi++) {
+        const int* indices = nullptr;
+        size_t indicesSize = 0lu;
+        int weightsIdx = 0;
+        bool withWeights = _withWeights;
+        getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+        bagCosts[obi + 1] = bagCosts[obi] + (indices != nullptr ? indicesSize : 0lu) + 1lu;
+    }
+    const size_t totalCost = bagCosts[outputBagsNum];
+
+    std::atomic<bool> hasInvalidIndex(false);
+    std::atomic<int> invalidIndex(0);
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        auto firstBag = [&](const int thr) {
+            return static_cast<size_t>(std::lower_bound(bagCosts.begin(), bagCosts.end(), totalCost * thr / nthr) - bagCosts.begin());
+        };
+        const size_t start = firstBag(ithr);
+        const size_t end = std::min(firstBag(ithr + 1), outputBagsNum);
+        if (start >= end)
+            return;
+
+        std::vector<float> bagBuffer(dstPrc == Precision::FP32 ? 0lu : _embDepth);
+
+        const int* indices = nullptr;
+        size_t indicesSize = 0lu;
+        int weightsIdx = 0;
+        bool withWeights = _withWeights;
+
+        for (size_t obi = start; obi < end; obi++) {
+            float* acc = dstPrc == Precision::FP32 ? reinterpret_cast<float*>(dstData) + obi * _embDepth : bagBuffer.data();
+            std::fill_n(acc, _embDepth, 0.f);
+
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            if (indices != nullptr) {
+                withWeights = withWeights & _withWeights;
+
+                for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                    if (indices[inIdx] < 0 || indices[inIdx] >= tableRows) {
+                        invalidIndex = indices[inIdx];
+                        hasInvalidIndex = true;
+                        return;
+                    }
+
+                    const uint8_t* row = srcData + indices[inIdx] * rowSize;
+                    const uint8_t* nextRow = nullptr;
+                    if (inIdx + 1 < indicesSize && indices[inIdx + 1] >= 0 && indices[inIdx + 1] < tableRows)
+                        nextRow = srcData + indices[inIdx + 1] * rowSize;
+
+                    float weight = withWeights ? weightsData[weightsIdx++] : 1.f;
+                    if (!_tableScales.empty())
+                        weight *= _tableScales.size() == 1 ? _tableScales[0] : _tableScales[indices[inIdx]];
+
+                    _accumulator->accumulate(acc, row, nextRow, weight);
+                }
+            }
+
+            if (dstPrc != Precision::FP32)
+                cpu_convert(acc, dstData + obi * _embDepth * dstPrc.size(), Precision::FP32, dstPrc, _embDepth);
+        }
+    };
+
+    parallel_nt(0, threadBody);
+
+    if (hasInvalidIndex)
+        IE_THROW() << "Node EmbeddingBagSum with name '" << _layerName << "' has invalid embedding bag index: " << invalidIndex;
+}
+
 template<typename T>
 void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsData, T* dstData,
                                             const InferenceEngine::TensorDesc& srcDesc, const InferenceEngine::TensorDesc& dstDesc) {
@@ -117,11 +224,11 @@ void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsDa
 
 void MKLDNNEmbeddingBagSumNode::execute(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
                                         const InferenceEngine::TensorDesc& srcDesc, const InferenceEngine::TensorDesc& dstDesc) {
-    switch (srcDesc.getPrecision()) {
-        case Precision::FP32: {
-            return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
-                    reinterpret_cast<const float*>(weightsData), reinterpret_cast<float*>(dstData), srcDesc, dstDesc);
-        }
+    const auto srcPrc = srcDesc.getPrecision();
+    if (srcPrc == Precision::FP32 || srcPrc == Precision::BF16 || (srcPrc == Precision::I8 && !_tableScales.empty()))
+        return processFloatData(srcData, reinterpret_cast<const float*>(weightsData), dstData, srcDesc, dstDesc);
+
+    switch (srcPrc) {
         case Precision::I8: {
             return processData<PrecisionTrait<Precision::I8>::value_type>(reinterpret_cast<const int8_t*>(srcData),
                     reinterpret_cast<const int8_t*>(weightsData), reinterpret_cast<int8_t*>(dstData), srcDesc, dstDesc);
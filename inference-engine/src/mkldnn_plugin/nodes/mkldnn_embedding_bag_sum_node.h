@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "common/embedding_bag.h"
 #include <string>
 #include <memory>
 #include <vector>
@@ -26,6 +27,12 @@ public:
 
     ~MKLDNNEmbeddingBagSumNode() = default;
 
+    /**
+     * @brief Fuses dequantization of I8 embedding table: per tensor (single value) or per row scales.
+     */
+    void setTableScales(std::vector<float> scales) { _tableScales = std::move(scales); }
+    const std::vector<float>& getTableScales() const { return _tableScales; }
+
 protected:
     virtual void initFromInputs() = 0;
     virtual void getIndices(
@@ -35,9 +42,16 @@ protected:
             int& weightsIdx,
             bool& withWeights) = 0;
 
+    void getSupportedPrecisions(InferenceEngine::Precision origTablePrc, InferenceEngine::Precision origOutPrc,
+                                InferenceEngine::Precision& tablePrc, InferenceEngine::Precision& weightsPrc,
+                                InferenceEngine::Precision& outPrc) const;
+
     template<typename T>
     void processData(const T* srcData, const T* weightsData, T* dstData,
                      const InferenceEngine::TensorDesc& srcDesc, const InferenceEngine::TensorDesc& dstDesc);
+    // FP32, BF16 and dequantized I8 tables are accumulated in FP32
+    void processFloatData(const uint8_t* srcData, const float* weightsData, uint8_t* dstData,
+                          const InferenceEngine::TensorDesc& srcDesc, const InferenceEngine::TensorDesc& dstDesc);
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -47,6 +61,8 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+    std::vector<float> _tableScales;
+    std::shared_ptr<EmbeddingBagAccumulator> _accumulator;
 };
 
 }  // namespace MKLDNNPlugin
@@ -5,6 +5,7 @@
 #include "mkldnn_fullyconnected_node.h"
 #include "mkldnn_eltwise_node.h"
 #include "mkldnn_fake_quantize_node.h"
+#include "mkldnn_input_node.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <string>
@@ -12,6 +13,10 @@
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
 #include "utils/general_utils.h"
+#include "utils/ngraph_utils.hpp"
+#include "utils/bfloat16.hpp"
+#include <ngraph/type/float16.hpp>
+#include <ie_parallel.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -45,6 +50,10 @@ MKLDNNFullyConnectedNode::MKLDNNFullyConnectedNode(const std::shared_ptr<ngraph:
         errorPrefix = "FullyConnected node with name '" + getName() + "'";
 
         withBiases = op->get_input_size() == 3;
+
+        const auto sparseRate = getRTInfoValue(op->get_rt_info(), "sparseWeightsDecompressionRate");
+        if (!sparseRate.empty())
+            sparseWeightsDecompressionRate = std::stof(sparseRate);
     } else {
         IE_THROW(NotImplemented) << errorMessage;
     }
@@ -66,12 +75,45 @@ std::vector<memory::format_tag> MKLDNNFullyConnectedNode::getAvailableFormatsFor
     return {memory::format_tag::any};
 }
 
+void MKLDNNFullyConnectedNode::init() {
+    if (sparseWeightsDecompressionRate >= 1.f || getOriginalInputPrecisionAtPort(WEIGHTS_ID) != Precision::FP32)
+        return;
+
+    // the weights and biases are packed from the constant data, since the edges are filled after the compilation
+    auto getConstFP32Blob = [this](size_t port) -> Blob::CPtr {
+        auto constNode = dynamic_cast<MKLDNNInputNode*>(getParentEdgeAt(port)->getParent().get());
+        if (!constNode || !constNode->isConstant())
+            return nullptr;
+        auto blob = constNode->getConstBlob();
+        return blob && blob->getTensorDesc().getPrecision() == Precision::FP32 ? blob : nullptr;
+    };
+
+    auto weightsBlob = getConstFP32Blob(WEIGHTS_ID);
+    auto biasBlob = withBiases ? getConstFP32Blob(BIAS_ID) : nullptr;
+    if (!weightsBlob || (withBiases && !biasBlob))
+        return;
+
+    const auto& outDims = getChildEdgeAt(0)->getDims();
+    const size_t N = outDims[outDims.ndims() - 1];
+    const size_t K = weightsBlob->size() / N;
+    const auto zeroBlocksRate = BlockSparseGemm::getZeroBlocksRate(weightsBlob->cbuffer().as<const float*>(), N, K);
+    useSparseWeights = zeroBlocksRate >= sparseWeightsDecompressionRate;
+    if (useSparseWeights) {
+        sparseWeightsBlob = weightsBlob;
+        sparseBiasBlob = biasBlob;
+    }
+}
+
 void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     if (getParentEdges().size() != 2 && getParentEdges().size() != 3)
         IE_THROW() << errorPrefix << " has incorrect number of input edges";
     if (getChildEdges().empty())
         IE_THROW()<< errorPrefix << " has incorrect number of output edges";
 
+    // Compressed and sparse weights are processed by the node's own kernels, see initSupportedPrimitiveDescriptors()
+    if (withWeightsDecompression() || withSparseWeights())
+        return;
+
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(DATA_ID));
     auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalOutputPrecisionAtPort(DATA_ID));
 
@@ -120,8 +162,59 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!withWeightsDecompression() && !withSparseWeights()) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    if (withSparseWeights()) {
+        std::vector<DataConfigurator> inDataConfigurators = {{TensorDescCreatorTypes::ncsp, Precision::FP32},
+                                                             {TensorDescCreatorTypes::ncsp, Precision::FP32}};
+        if (withBiases)
+            inDataConfigurators.push_back({TensorDescCreatorTypes::ncsp, Precision::FP32});
+
+        addSupportedPrimDesc(inDataConfigurators,
+                             {{TensorDescCreatorTypes::ncsp, Precision::FP32}},
+                             BlockSparseGemm::getImplType());
+        return;
+    }
+
+    const auto weightsPrecision = getOriginalInputPrecisionAtPort(WEIGHTS_ID);
+    if (!one_of(weightsPrecision, Precision::U8, Precision::I8, Precision::FP16))
+        IE_THROW() << errorPrefix << " doesn't support decompression of weights with precision " << weightsPrecision;
+
+    const auto inputPrecision = getOriginalInputPrecisionAtPort(DATA_ID) == Precision::BF16 ? Precision::BF16 : Precision::FP32;
+    const auto outputPrecision = getOriginalOutputPrecisionAtPort(0) == Precision::BF16 ? Precision::BF16 : Precision::FP32;
+
+    std::vector<DataConfigurator> inDataConfigurators = {{TensorDescCreatorTypes::ncsp, inputPrecision},
+                                                         {TensorDescCreatorTypes::ncsp, weightsPrecision}};
+    if (withBiases)
+        inDataConfigurators.push_back({TensorDescCreatorTypes::ncsp, Precision::FP32});
+
+    addSupportedPrimDesc(inDataConfigurators,
+                         {{TensorDescCreatorTypes::ncsp, outputPrecision}},
+                         impl_desc_type::ref_any);
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
-    if (prim)
+    if (withSparseWeights()) {
+        if (sparseGemm)
+            return;
+
+        const size_t N = getChildEdgeAt(0)->getDims()[getChildEdgeAt(0)->getDims().ndims() - 1];
+        const size_t K = sparseWeightsBlob->size() / N;
+        const auto bias = sparseBiasBlob ? sparseBiasBlob->cbuffer().as<const float*>() : nullptr;
+        sparseGemm = std::make_shared<BlockSparseGemm>(sparseWeightsBlob->cbuffer().as<const float*>(), bias, N, K);
+        sparseWeightsBlob.reset();
+        sparseBiasBlob.reset();
+        return;
+    }
+
+    if (prim || withWeightsDecompression())
         return;
 
     std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
@@ -140,7 +233,132 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
         primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, getParentEdgeAt(WEIGHTS_ID)->getMemory().GetPrimitive()}, {DNNL_ARG_DST, dst}};
 }
 
+template <typename wei_t>
+void MKLDNNFullyConnectedNode::executeWithWeightsDecompression() {
+    const auto& srcMem = getParentEdgeAt(DATA_ID)->getMemory();
+    const auto& weiMem = getParentEdgeAt(WEIGHTS_ID)->getMemory();
+    const auto& dstMem = getChildEdgeAt(0)->getMemory();
+
+    const auto& dstDims = getChildEdgeAt(0)->getDims();
+    const size_t N = dstDims[dstDims.ndims() - 1];
+    const size_t M = dstMem.GetElementsCount() / N;
+    const size_t K = srcMem.GetElementsCount() / M;
+
+    const auto weights = reinterpret_cast<const wei_t*>(weiMem.GetPtr());
+    const auto bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemory().GetPtr()) : nullptr;
+
+    // BF16 activations are expanded to FP32 since the weights have to be decompressed to FP32 anyway
+    const bool bf16Src = srcMem.GetDataType() == memory::data_type::bf16;
+    const bool bf16Dst = dstMem.GetDataType() == memory::data_type::bf16;
+    std::vector<float> srcBuffer(bf16Src ? M * K : 0);
+    std::vector<float> dstBuffer(bf16Dst ? M * N : 0);
+    if (bf16Src) {
+        const auto bf16Data = reinterpret_cast<const bfloat16_t*>(srcMem.GetPtr());
+        parallel_for(M * K, [&](size_t i) {
+            srcBuffer[i] = static_cast<float>(bf16Data[i]);
+        });
+    }
+    const float* src = bf16Src ? srcBuffer.data() : reinterpret_cast<const float*>(srcMem.GetPtr());
+    float* dst = bf16Dst ? dstBuffer.data() : reinterpret_cast<float*>(dstMem.GetPtr());
+
+    // sum_k(src * (w - zp)) = sum_k(src * w) - zp * sum_k(src)
+    std::vector<float> srcSums;
+    if (!decompressionSubtract.empty()) {
+        srcSums.resize(M);
+        parallel_for(M, [&](size_t m) {
+            const float* x = src + m * K;
+            float sum = 0.f;
+            for (size_t k = 0; k < K; k++)
+                sum += x[k];
+            srcSums[m] = sum;
+        });
+    }
+
+    // Each weights row is decompressed to FP32 once and reused for a block of source rows,
+    // so the compressed weights are read from memory once per block
+    const size_t blockM = 64;
+    const size_t blockN = 8;
+    const size_t accNum = 8;
+    const size_t blocksN = div_up(N, blockN);
+    const int threadsNum = parallel_get_max_threads();
+    decompressedRows.resize(threadsNum * K);
+    for (size_t mStart = 0; mStart < M; mStart += blockM) {
+        const size_t mEnd = std::min(M, mStart + blockM);
+        parallel_nt(threadsNum, [&](const int ithr, const int nthr) {
+            size_t nbStart = 0, nbEnd = 0;
+            splitter(blocksN, nthr, ithr, nbStart, nbEnd);
+            float* w = decompressedRows.data() + ithr * K;
+            for (size_t n = nbStart * blockN; n < std::min(N, nbEnd * blockN); n++) {
+                const wei_t* compressedRow = weights + n * K;
+                for (size_t k = 0; k < K; k++)
+                    w[k] = static_cast<float>(compressedRow[k]);
+                const float scale = decompressionMultiply[n];
+                const float zeroPoint = decompressionSubtract.empty() ? 0.f : decompressionSubtract[n];
+                const float shift = bias ? bias[n] : 0.f;
+                for (size_t m = mStart; m < mEnd; m++) {
+                    const float* x = src + m * K;
+                    float acc[accNum] = {};
+                    size_t k = 0;
+                    for (; k + accNum <= K; k += accNum) {
+                        for (size_t i = 0; i < accNum; i++)
+                            acc[i] += x[k + i] * w[k + i];
+                    }
+                    for (; k < K; k++)
+                        acc[0] += x[k] * w[k];
+
+                    float dot = 0.f;
+                    for (size_t i = 0; i < accNum; i++)
+                        dot += acc[i];
+                    if (zeroPoint != 0.f)
+                        dot -= zeroPoint * srcSums[m];
+
+                    dst[m * N + n] = dot * scale + shift;
+                }
+            }
+        });
+    }
+
+    if (bf16Dst) {
+        auto bf16Data = reinterpret_cast<bfloat16_t*>(dstMem.GetPtr());
+        parallel_for(M * N, [&](size_t i) {
+            bf16Data[i] = bfloat16_t(dstBuffer[i]);
+        });
+    }
+}
+
+void MKLDNNFullyConnectedNode::executeWithSparseWeights() {
+    const auto& srcMem = getParentEdgeAt(DATA_ID)->getMemory();
+    const auto& dstMem = getChildEdgeAt(0)->getMemory();
+
+    const auto& dstDims = getChildEdgeAt(0)->getDims();
+    const size_t M = dstMem.GetElementsCount() / dstDims[dstDims.ndims() - 1];
+
+    sparseGemm->execute(reinterpret_cast<const float*>(srcMem.GetPtr()), reinterpret_cast<float*>(dstMem.GetPtr()), M);
+}
+
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (withSparseWeights()) {
+        executeWithSparseWeights();
+        return;
+    }
+
+    if (withWeightsDecompression()) {
+        switch (getParentEdgeAt(WEIGHTS_ID)->getMemory().GetDataType()) {
+            case memory::data_type::u8:
+                executeWithWeightsDecompression<uint8_t>();
+                break;
+            case memory::data_type::s8:
+                executeWithWeightsDecompression<int8_t>();
+                break;
+            case memory::data_type::f16:
+                executeWithWeightsDecompression<ngraph::float16>();
+                break;
+            default:
+                IE_THROW() << errorPrefix << " has unsupported precision of compressed weights";
+        }
+        return;
+    }
+
     if (prim) {
         auto reshapeMemory = [this](int argType) {
             auto param = primArgs.find(argType);
@@ -164,6 +382,9 @@ void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
 }
 
 bool MKLDNNFullyConnectedNode::canFuse(const MKLDNNNodePtr& node) const {
+    // Post operations are not supported by the weights decompression and block-sparse kernels
+    if (withWeightsDecompression() || withSparseWeights())
+        return false;
     return canFuseSimpleOperation(node);
 }
 
@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "common/block_sparse_gemm.h"
 #include <memory>
 #include <string>
 #include <vector>
@@ -17,10 +18,16 @@ public:
     MKLDNNFullyConnectedNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
 
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const MKLDNNDims &dims) const override;
+    void init() override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
+    bool readsInputOnExecute(size_t port) const override {
+        // the block-sparse kernel packs the constant weights and biases during the compilation
+        return !withSparseWeights() || port == DATA_ID;
+    }
 
     bool canBeInPlace() const override {
         return false;
@@ -43,6 +50,23 @@ public:
 
     static bool isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept;
 
+    bool withWeightsDecompression() const {
+        return !decompressionMultiply.empty();
+    }
+
+    /**
+     * @brief Makes the node keep U8/I8/FP16 weights and compute
+     * dst = (src * (weights - subtract)) * multiply + bias, the parameters are per output channel, empty subtract means zeros
+     */
+    void setWeightsDecompression(std::vector<float> multiply, std::vector<float> subtract) {
+        decompressionMultiply = std::move(multiply);
+        decompressionSubtract = std::move(subtract);
+    }
+
+    bool withSparseWeights() const {
+        return useSparseWeights;
+    }
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
@@ -53,6 +77,26 @@ private:
     std::vector<MKLDNNMemoryPtr> PostOpsIntBlobMemory;
     void setPostOps(mkldnn::primitive_attr &attr, bool initWeights);
 
+    // per output channel parameters of the fused weights decompression
+    std::vector<float> decompressionMultiply;
+    std::vector<float> decompressionSubtract;
+
+    template <typename wei_t>
+    void executeWithWeightsDecompression();
+    // per thread buffers of the weights rows decompressed to FP32, kept between executions
+    std::vector<float> decompressedRows;
+
+    void executeWithSparseWeights();
+
+    // minimal share of zero 1x16 weights blocks starting from which the constant FP32 weights are executed
+    // by the block-sparse kernel, it is passed via "sparseWeightsDecompressionRate" rt_info of the operation
+    float sparseWeightsDecompressionRate = 1.f;
+    bool useSparseWeights = false;
+    std::shared_ptr<BlockSparseGemm> sparseGemm;
+    // constant data packed by createPrimitive(), the node doesn't keep the dense weights after packing
+    InferenceEngine::Blob::CPtr sparseWeightsBlob;
+    InferenceEngine::Blob::CPtr sparseBiasBlob;
+
     bool withBiases = false;
 
     std::string errorPrefix;
@@ -189,6 +189,23 @@ namespace {
     }
 }   // namespace
 
+const void* MKLDNNInputNode::getConstDataOfLayout(const TensorDesc& desc) const {
+    if (!constBlob || isEmptyTensorDesc(desc) || desc.getBlockingDesc().getOffsetPadding() != 0 ||
+        !isCompatibleTensors(constBlob->getTensorDesc(), desc))
+        return nullptr;
+    return constBlob->cbuffer().as<const void*>();
+}
+
+void MKLDNNInputNode::replaceConstBlob(const InferenceEngine::Blob::Ptr& blob) {
+    if (!constBlob)
+        IE_THROW() << "Node " << getName() << " is not a constant";
+    if (!blob || blob->getTensorDesc().getPrecision() != constBlob->getTensorDesc().getPrecision() ||
+        blob->byteSize() != constBlob->byteSize())
+        IE_THROW() << "New data of constant " << getName() << " doesn't match the precision or the size of the current data";
+
+    constBlob = blob;
+}
+
 void MKLDNNInputNode::execute(mkldnn::stream strm) {
     if (!constBlob)
         return;
@@ -202,7 +219,9 @@ void MKLDNNInputNode::execute(mkldnn::stream strm) {
         const int8_t *srcData = constBlob->cbuffer().as<int8_t *>();
         int8_t *dstData = dstBlob->buffer();
 
-        cpu_memcpy_s(dstData, dstBlob->byteSize(), srcData, constBlob->byteSize());
+        // the output memory may refer to the constant data, see getConstDataOfLayout()
+        if (dstData != srcData)
+            cpu_memcpy_s(dstData, dstBlob->byteSize(), srcData, constBlob->byteSize());
     } else if (constBlob->getTensorDesc().getPrecision() == Precision::BIN ||
                dstBlob->getTensorDesc().getPrecision() == Precision::BIN) {
         size_t dstSize = dstBlob->size() / 8;
@@ -26,14 +26,36 @@ public:
         isMeanImage = true;
     }
 
+    /**
+     * @brief Returns the constant data to be consumed during the graph compilation. Since the compiled graph
+     * depends on the data after that, the constant is not allowed to be replaced.
+     */
     const InferenceEngine::Blob::CPtr getConstBlob() const {
+        constBlobConsumed = true;
         return constBlob;
     }
 
+    bool isConstBlobConsumed() const {
+        return constBlobConsumed;
+    }
+
+    /**
+     * @brief Returns the constant data if the memory of the layout @p desc may refer to it instead of the copy,
+     * nullptr otherwise. The memory referring to the constant data must not be written.
+     */
+    const void* getConstDataOfLayout(const InferenceEngine::TensorDesc& desc) const;
+
+    /**
+     * @brief Replaces the constant data, the node must be executed again to propagate the data to the graph
+     * @param blob new data with the same precision and size as the current data
+     */
+    void replaceConstBlob(const InferenceEngine::Blob::Ptr& blob);
+
 private:
     InferenceEngine::Precision precision;
 
     InferenceEngine::Blob::Ptr constBlob = nullptr;
+    mutable bool constBlobConsumed = false;
     bool isMeanImage = false;
 };
 
@@ -21,6 +21,7 @@ public:
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
+    bool readsInputOnExecute(size_t port) const override { return true; }
     int getMaxBatch() override;
 
     InferenceEngine::Precision getRuntimePrecision() const override;
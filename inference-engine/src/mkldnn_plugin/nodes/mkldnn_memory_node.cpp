@@ -6,6 +6,8 @@
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "mkldnn_memory_node.hpp"
+#include "mkldnn_concat_node.h"
+#include "mkldnn_split_node.h"
 #include "common/cpu_memcpy.h"
 #include "utils/general_utils.h"
 
@@ -15,6 +17,41 @@ using namespace InferenceEngine;
 
 std::mutex MKLDNNMemoryNodeVirtualEdge::holderMutex;
 
+namespace {
+
+/**
+ * Memory of the edges may point to external buffer only if consumers don't access the data
+ * through other pointers: in-place and optimized concat/split nodes reference the original memory
+ */
+bool canRedirectEdges(const std::vector<MKLDNNEdgePtr>& edges) {
+    if (edges.empty())
+        return false;
+
+    const void* defaultPtr = edges[0]->getMemory().GetPrimitive().get_data_handle();
+    for (const auto& edge : edges) {
+        auto child = edge->getChild();
+        if (child->isConstant() || child->isInplace())
+            return false;
+
+        auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+        if ((concat && concat->isOptimized()) || dynamic_cast<MKLDNNSplitNode *>(child.get()))
+            return false;
+
+        for (size_t i = 0; i < child->getChildEdges().size(); i++) {
+            if (child->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle() == defaultPtr)
+                return false;
+        }
+    }
+    return true;
+}
+
+void redirectEdges(const std::vector<MKLDNNEdgePtr>& edges, void* ptr) {
+    for (const auto& edge : edges)
+        edge->getMemory().GetPrimitivePtr()->set_data_handle(ptr);
+}
+
+}  // namespace
+
 MKLDNNMemoryNode::MKLDNNMemoryNode(const std::shared_ptr<ngraph::Node>& op) {
     if (auto assignOp = std::dynamic_pointer_cast<ngraph::op::AssignBase>(op)) {
         _id = assignOp->get_variable_id();
@@ -52,6 +89,36 @@ MKLDNNMemoryOutputNode::~MKLDNNMemoryOutputNode() {
     MKLDNNMemoryNodeVirtualEdge::remove(this, holder);
 }
 
+void MKLDNNMemoryOutputNode::setInputNode(MKLDNNNode* node) {
+    inputNode = node;
+
+    auto inputMemoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node);
+    IE_ASSERT(inputMemoryNode != nullptr);
+    inputMemoryNode->setOutputNode(this);
+}
+
+bool MKLDNNMemoryOutputNode::redirectInput(void* ptr) {
+    auto edge = getParentEdgeAt(0);
+    auto parent = edge->getParent();
+    if (!canRedirectInput) {
+        if (parent->isConstant() || parent->isInplace() || parent->getType() == MemoryInput)
+            return false;
+
+        const void* defaultPtr = edge->getMemory().GetPrimitive().get_data_handle();
+        for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
+            if (parent->getParentEdgeAt(i)->getMemory().GetPrimitive().get_data_handle() == defaultPtr)
+                return false;
+        }
+
+        if (!canRedirectEdges(parent->getChildEdgesAtPort(edge->getInputNum())))
+            return false;
+        canRedirectInput = true;
+    }
+
+    redirectEdges(parent->getChildEdgesAtPort(edge->getInputNum()), ptr);
+    return true;
+}
+
 void MKLDNNMemoryOutputNode::getSupportedDescriptors() {}
 
 void MKLDNNMemoryOutputNode::initSupportedPrimitiveDescriptors() {
@@ -110,24 +177,9 @@ void MKLDNNMemoryInputNode::createPrimitive() {
 
     // default memory state is zero filled
     dataStore->FillZero();
-}
-
-/**
- * Copy data from one tensor into other.
- * As is. Assume that data is dense tensor with same layout.
- * @param dst destination memory object
- * @param src source memory object
- */
-inline
-static void simple_copy(MKLDNNMemory& dst, const MKLDNNMemory& src) {
-    auto srcPtr = static_cast<uint8_t*>(src.GetPtr());
-    auto dstPtr = static_cast<uint8_t*>(dst.GetPtr());
-    auto srcSizeInByte = src.GetSize();
-    auto dstSizeInByte = dst.GetSize();
-
-    IE_ASSERT(srcSizeInByte == dstSizeInByte) << "Memory objects are not compatible. Has different sizes.";
 
-    cpu_memcpy(dstPtr, srcPtr, srcSizeInByte);
+    // without bound variable state the data store is read and written on each execution
+    bindState(dataStore->GetPtr(), dataStore->GetPtr());
 }
 
 MKLDNNMemoryInputNode::~MKLDNNMemoryInputNode() {
@@ -138,19 +190,42 @@ MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
     return dataStore;
 }
 
+void MKLDNNMemoryInputNode::bindState(void* readPtr, void* writePtr) {
+    stateReadPtr = readPtr;
+    stateWritePtr = writePtr;
+    stateWritten = false;
+
+    // ReadValue and Assign data are copied if they can't be placed to the separate state buffers
+    isStateBound = false;
+    if (readPtr == writePtr || outputNode == nullptr ||
+            getChildEdgeAt(0)->getDesc() != outputNode->getParentEdgeAt(0)->getDesc())
+        return;
+
+    if (!canRedirectEdges(getChildEdgesAtPort(0)) || !outputNode->redirectInput(writePtr))
+        return;
+
+    redirectEdges(getChildEdgesAtPort(0), readPtr);
+    isStateBound = true;
+}
+
 void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
-    // TODO: Should be next one call:
-    //           dataStore.SetData(new_state, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    stateWritten = true;
+    // the new state is already written to the state buffer by the Assign producer
+    if (isStateBound)
+        return;
+
+    IE_ASSERT(new_state.GetSize() == dataStore->GetSize()) << "Memory objects are not compatible. Has different sizes.";
+    cpu_memcpy(stateWritePtr, new_state.GetPtr(), new_state.GetSize());
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
-    auto dst_mem = getChildEdgeAt(0)->getMemory();
-    // TODO: Should be simple call of:
-    //           dst_mem.SetData(dataStore, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(dst_mem, *dataStore);
+    // consumers read the state buffer directly
+    if (isStateBound)
+        return;
+
+    auto& dst_mem = getChildEdgeAt(0)->getMemory();
+    IE_ASSERT(dst_mem.GetSize() == dataStore->GetSize()) << "Memory objects are not compatible. Has different sizes.";
+    cpu_memcpy(dst_mem.GetPtr(), stateReadPtr, dst_mem.GetSize());
 }
 
 MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
@@ -68,9 +68,13 @@ class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
         return getType() == MemoryOutput;
     }
 
-    void setInputNode(MKLDNNNode* node) override {
-        inputNode = node;
-    }
+    void setInputNode(MKLDNNNode* node) override;
+
+    /**
+     * @brief redirects memory of the producer output consumed by Assign to the given pointer
+     * @return false if the producer output can't be redirected and the data has to be copied on execution
+     */
+    bool redirectInput(void* ptr);
 
  private:
     /**
@@ -78,6 +82,7 @@ class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
      */
     MKLDNNNode* inputNode = nullptr;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
+    bool canRedirectInput = false;
 };
 
 class MKLDNNMemoryInputNode : public MKLDNNInputNode, public MKLDNNMemoryNode {
@@ -94,10 +99,33 @@ public:
     void createPrimitive() override;
 
     void setInputNode(MKLDNNNode* node) override {}
+    void setOutputNode(MKLDNNMemoryOutputNode* node) {
+        outputNode = node;
+    }
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
+
+    /**
+     * @brief binds state buffers for the next execution: ReadValue reads the state from @p readPtr and
+     * Assign writes the new state to @p writePtr. Distinct buffers are bound to the edges directly, so the
+     * state is passed between iterations by swapping buffers without copying.
+     */
+    void bindState(void* readPtr, void* writePtr);
+
+    /**
+     * @brief checks that Assign has written the new state since the last bindState() call
+     */
+    bool isStateWritten() const {
+        return stateWritten;
+    }
+
  private:
     MKLDNNMemoryPtr dataStore;
+    MKLDNNMemoryOutputNode* outputNode = nullptr;
+    void* stateReadPtr = nullptr;
+    void* stateWritePtr = nullptr;
+    bool isStateBound = false;
+    bool stateWritten = false;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
@@ -12,6 +12,8 @@
 
 #include <ngraph/node.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <utility>
 
@@ -102,11 +104,39 @@ const std::map<InferenceEngine::Precision, InferenceEngine::Precision> MKLDNNRNN
     // layer precision,                weights precision
     {InferenceEngine::Precision::FP32, InferenceEngine::Precision::FP32},
     {InferenceEngine::Precision::BF16, InferenceEngine::Precision::BF16},
-    // FP16 and U8 are not supported yet
+    {InferenceEngine::Precision::U8,   InferenceEngine::Precision::I8},
+    // FP16 is not supported yet
     // {InferenceEngine::Precision::FP16, InferenceEngine::Precision::FP16},
-    // {InferenceEngine::Precision::U8,   InferenceEngine::Precision::I8},
 };
 
+// W and R are either constants or I8 constants with per output channel dequantization produced by LPT
+static bool isConstantWeights(const ngraph::Node* node) {
+    if (node->get_type_info() == ngraph::op::v0::Constant::type_info)
+        return true;
+    if (!ngraph::is_type<ngraph::op::v1::Multiply>(node))
+        return false;
+
+    for (size_t constPort = 0; constPort < 2; constPort++) {
+        const auto convert = node->get_input_node_ptr(1 - constPort);
+        if (ngraph::is_type<ngraph::op::v0::Constant>(node->get_input_node_ptr(constPort)) &&
+                ngraph::is_type<ngraph::op::v0::Convert>(convert) &&
+                ngraph::is_type<ngraph::op::v0::Constant>(convert->get_input_node_ptr(0)) &&
+                convert->get_input_element_type(0) == ngraph::element::i8)
+            return true;
+    }
+    return false;
+}
+
+template <typename Prec>
+static Prec scaleWeight(Prec value, float scale) {
+    return static_cast<Prec>(static_cast<float>(value) * scale);
+}
+
+template <>
+int8_t scaleWeight<int8_t>(int8_t value, float scale) {
+    return static_cast<int8_t>(std::max(-128.f, std::min(127.f, std::round(value * scale))));
+}
+
 bool MKLDNNRNN::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (!one_of(op->get_type_info(),
@@ -127,8 +157,8 @@ bool MKLDNNRNN::isSupportedOperation(const std::shared_ptr<const ngraph::Node>&
                 errorMessage = "Node expects 5 inputs. Actual: " + std::to_string(op->get_input_size());
                 return false;
             }
-            if (op->get_input_node_ptr(2)->get_type_info() != ngraph::op::v0::Constant::type_info ||
-                    op->get_input_node_ptr(3)->get_type_info() != ngraph::op::v0::Constant::type_info ||
+            if (!isConstantWeights(op->get_input_node_ptr(2)) ||
+                    !isConstantWeights(op->get_input_node_ptr(3)) ||
                     op->get_input_node_ptr(4)->get_type_info() != ngraph::op::v0::Constant::type_info) {
                 errorMessage = "Node expects constants as W, R, B inputs.";
                 return false;
@@ -142,8 +172,8 @@ bool MKLDNNRNN::isSupportedOperation(const std::shared_ptr<const ngraph::Node>&
                 errorMessage = "Node expects 6 inputs. Actual: " + std::to_string(op->get_input_size());
                 return false;
             }
-            if (op->get_input_node_ptr(3)->get_type_info() != ngraph::op::v0::Constant::type_info ||
-                    op->get_input_node_ptr(4)->get_type_info() != ngraph::op::v0::Constant::type_info ||
+            if (!isConstantWeights(op->get_input_node_ptr(3)) ||
+                    !isConstantWeights(op->get_input_node_ptr(4)) ||
                     op->get_input_node_ptr(5)->get_type_info() != ngraph::op::v0::Constant::type_info) {
                 errorMessage = "Node expects constants as W, R, B inputs.";
                 return false;
@@ -155,8 +185,8 @@ bool MKLDNNRNN::isSupportedOperation(const std::shared_ptr<const ngraph::Node>&
                 errorMessage = "Node expects 7 inputs. Actual: " + std::to_string(op->get_input_size());
                 return false;
             }
-            if (op->get_input_node_ptr(4)->get_type_info() != ngraph::op::v0::Constant::type_info ||
-                    op->get_input_node_ptr(5)->get_type_info() != ngraph::op::v0::Constant::type_info ||
+            if (!isConstantWeights(op->get_input_node_ptr(4)) ||
+                    !isConstantWeights(op->get_input_node_ptr(5)) ||
                     op->get_input_node_ptr(6)->get_type_info() != ngraph::op::v0::Constant::type_info) {
                 errorMessage = "Node expects constants as W, R, B inputs.";
                 return false;
@@ -224,6 +254,21 @@ MKLDNNRNN::MKLDNNRNN(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engi
         initSeq(op);
 }
 
+bool MKLDNNRNN::isInt8Supported() const {
+    return one_of(cell_type, mkldnn::algorithm::vanilla_lstm, mkldnn::algorithm::vanilla_gru, mkldnn::algorithm::lbr_gru) &&
+           wScales == rScales;
+}
+
+void MKLDNNRNN::setWeightsDequantization(std::vector<float> wDequantizationScales, std::vector<float> rDequantizationScales) {
+    wScales = std::move(wDequantizationScales);
+    rScales = std::move(rDequantizationScales);
+}
+
+void MKLDNNRNN::setInputDequantization(float scale, float shift) {
+    inputScale = 1.f / scale;
+    inputShift = shift;
+}
+
 bool MKLDNNRNN::created() const {
     return getType() == (is_cell ? RNNCell : RNNSeq);
 }
@@ -280,6 +325,9 @@ void MKLDNNRNN::initCell(const std::shared_ptr<ngraph::Node>& op) {
 void MKLDNNRNN::fillCellDesc() {
     runtimePrecision = getOriginalInputPrecisionAtPort(0);
     auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(runtimePrecision);
+    // int8 primitive takes U8 layer input only, states and output stay in f32
+    auto stateType = runtimePrecision == Precision::U8 ? memory::data_type::f32 : dataType;
+    auto weightsType = MKLDNNExtensionUtils::IEPrecisionToDataType(weightsByLayerPrec.at(runtimePrecision));
 
     MKLDNNDims S_4D_shape {L, D, N, SC};
 
@@ -289,18 +337,18 @@ void MKLDNNRNN::fillCellDesc() {
 
     // Shapes and Attributes are correct. Can start internal stuff initialization.
     in_data_d[RNNInOutKind::Layer]  = {MKLDNNDims{T, N, DC}, dataType, memory::format_tag::tnc};
-    out_data_d[RNNInOutKind::Layer] = {MKLDNNDims{T, N, SC}, dataType, memory::format_tag::tnc};
+    out_data_d[RNNInOutKind::Layer] = {MKLDNNDims{T, N, SC}, stateType, memory::format_tag::tnc};
 
-    in_data_d[RNNInOutKind::HiddenState]  = {S_4D_shape, dataType, memory::format_tag::ldnc};
-    out_data_d[RNNInOutKind::HiddenState] = {S_4D_shape, dataType, memory::format_tag::ldnc};
+    in_data_d[RNNInOutKind::HiddenState]  = {S_4D_shape, stateType, memory::format_tag::ldnc};
+    out_data_d[RNNInOutKind::HiddenState] = {S_4D_shape, stateType, memory::format_tag::ldnc};
 
     if (haveCellState(cell_type)) {
         in_data_d[RNNInOutKind::CellState] =  {S_4D_shape, memory::data_type::f32, memory::format_tag::ldnc};
         out_data_d[RNNInOutKind::CellState] = {S_4D_shape, memory::data_type::f32, memory::format_tag::ldnc};
     }
 
-    w_data_d   = {{L, D, DC, G, SC}, dataType, memory::format_tag::ldigo};
-    w_state_d  = {{L, D, SC, G, SC}, dataType, memory::format_tag::ldigo};
+    w_data_d   = {{L, D, DC, G, SC}, weightsType, memory::format_tag::ldigo};
+    w_state_d  = {{L, D, SC, G, SC}, weightsType, memory::format_tag::ldigo};
 
     // Add 5th input
     w_bias_d = {{L, D, Gb, SC}, memory::data_type::f32, memory::format_tag::ldgo};
@@ -313,16 +361,16 @@ void MKLDNNRNN::fillCellDesc() {
     in_candidate.reserve(6);
 
     in_candidate.emplace_back(MKLDNNMemoryDesc {D_shape, dataType, memory::format_tag::nc});
-    in_candidate.emplace_back(MKLDNNMemoryDesc {S_shape, dataType, memory::format_tag::nc});
-    out_candidate.emplace_back(MKLDNNMemoryDesc {S_shape, dataType, memory::format_tag::nc});
+    in_candidate.emplace_back(MKLDNNMemoryDesc {S_shape, stateType, memory::format_tag::nc});
+    out_candidate.emplace_back(MKLDNNMemoryDesc {S_shape, stateType, memory::format_tag::nc});
 
     if (haveCellState(cell_type)) {
         in_candidate.emplace_back(MKLDNNMemoryDesc {S_shape, memory::data_type::f32, memory::format_tag::nc});
         out_candidate.emplace_back(MKLDNNMemoryDesc {S_shape, memory::data_type::f32, memory::format_tag::nc});
     }
     if (one_of(cell_type, mkldnn::algorithm::vanilla_rnn, mkldnn::algorithm::vanilla_gru, mkldnn::algorithm::lbr_gru, mkldnn::algorithm::vanilla_lstm)) {
-        in_candidate.emplace_back(MKLDNNMemoryDesc {WShape, memory::data_type::f32, memory::format_tag::nc});
-        in_candidate.emplace_back(MKLDNNMemoryDesc {RShape, memory::data_type::f32, memory::format_tag::nc});
+        in_candidate.emplace_back(MKLDNNMemoryDesc {WShape, inWeightsType(wIdx), memory::format_tag::nc});
+        in_candidate.emplace_back(MKLDNNMemoryDesc {RShape, inWeightsType(rIdx), memory::format_tag::nc});
         in_candidate.emplace_back(MKLDNNMemoryDesc {BShape, memory::data_type::f32, memory::format_tag::x});
     }
 
@@ -380,23 +428,26 @@ void MKLDNNRNN::initSeq(const std::shared_ptr<ngraph::Node>& op) {
 void MKLDNNRNN::fillSeqDesc() {
     runtimePrecision = getOriginalInputPrecisionAtPort(0);
     auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(runtimePrecision);
+    // int8 primitive takes U8 layer input only, states and output stay in f32
+    auto stateType = runtimePrecision == Precision::U8 ? memory::data_type::f32 : dataType;
+    auto weightsType = MKLDNNExtensionUtils::IEPrecisionToDataType(weightsByLayerPrec.at(runtimePrecision));
 
     MKLDNNDims S_4D_shape {L, D, N, SC};
 
     // Try to create descriptor and corresponding configuration
     in_data_d[RNNInOutKind::Layer]  = {MKLDNNDims{in_data_dims},  dataType, memory::format_tag::tnc};
-    out_data_d[RNNInOutKind::Layer] = {MKLDNNDims{out_data_dims}, dataType, memory::format_tag::tnc};
+    out_data_d[RNNInOutKind::Layer] = {MKLDNNDims{out_data_dims}, stateType, memory::format_tag::tnc};
 
-    in_data_d[RNNInOutKind::HiddenState]  = {MKLDNNDims{S_4D_shape}, dataType, memory::format_tag::ldnc};
-    out_data_d[RNNInOutKind::HiddenState] = {MKLDNNDims{S_4D_shape}, dataType, memory::format_tag::ldnc};
+    in_data_d[RNNInOutKind::HiddenState]  = {MKLDNNDims{S_4D_shape}, stateType, memory::format_tag::ldnc};
+    out_data_d[RNNInOutKind::HiddenState] = {MKLDNNDims{S_4D_shape}, stateType, memory::format_tag::ldnc};
 
     if (haveCellState(cell_type)) {
         in_data_d[RNNInOutKind::CellState] = {MKLDNNDims{S_4D_shape}, memory::data_type::f32, memory::format_tag::ldnc};
         out_data_d[RNNInOutKind::CellState] = {MKLDNNDims{S_4D_shape}, memory::data_type::f32, memory::format_tag::ldnc};
     }
 
-    w_data_d  = {{L, D, DC, G, SC}, dataType, memory::format_tag::ldigo};
-    w_state_d = {{L, D, SC, G, SC}, dataType, memory::format_tag::ldigo};
+    w_data_d  = {{L, D, DC, G, SC}, weightsType, memory::format_tag::ldigo};
+    w_state_d = {{L, D, SC, G, SC}, weightsType, memory::format_tag::ldigo};
 
     w_bias_d = {{L, D, Gb, SC}, memory::data_type::f32, memory::format_tag::ldgo};
 
@@ -409,12 +460,12 @@ void MKLDNNRNN::fillSeqDesc() {
     else
         in_candidate.push_back(MKLDNNMemoryDesc{{N, T, DC}, dataType, memory::format_tag::ntc});
 
-    in_candidate.push_back(MKLDNNMemoryDesc{{N, D, SC}, dataType, memory::format_tag::ntc}); // initial hidden state
+    in_candidate.push_back(MKLDNNMemoryDesc{{N, D, SC}, stateType, memory::format_tag::ntc}); // initial hidden state
     if (haveCellState(cell_type))
         in_candidate.push_back(MKLDNNMemoryDesc{{N, D, SC}, memory::data_type::f32, memory::format_tag::ntc}); // initial cell state
     in_candidate.push_back(MKLDNNMemoryDesc{{N}, memory::data_type::s32, memory::format_tag::x}); // sequence lengths
-    in_candidate.push_back(MKLDNNMemoryDesc{{D, G * SC, DC}, memory::data_type::f32, memory::format_tag::ntc}); // W
-    in_candidate.push_back(MKLDNNMemoryDesc{{D, G * SC, SC}, memory::data_type::f32, memory::format_tag::ntc}); // R
+    in_candidate.push_back(MKLDNNMemoryDesc{{D, G * SC, DC}, inWeightsType(wIdx), memory::format_tag::ntc}); // W
+    in_candidate.push_back(MKLDNNMemoryDesc{{D, G * SC, SC}, inWeightsType(rIdx), memory::format_tag::ntc}); // R
     in_candidate.push_back(MKLDNNMemoryDesc{{D, Gb * SC}, memory::data_type::f32, memory::format_tag::nc}); // B
 
     std::vector<TensorDesc> out_candidate;
@@ -423,16 +474,21 @@ void MKLDNNRNN::fillSeqDesc() {
         out_candidate.push_back(out_data_d[RNNInOutKind::Layer]);
     } else {
         // TODO reorder ntc -> ndtc does not work, thus use tnc(plain) + transformation reshape-transpose-reshape for now.
-        out_candidate.push_back(MKLDNNMemoryDesc{{T, N, SC}, dataType, memory::format_tag::tnc});
+        out_candidate.push_back(MKLDNNMemoryDesc{{T, N, SC}, stateType, memory::format_tag::tnc});
     }
 
-    out_candidate.push_back(MKLDNNMemoryDesc{{N, D, SC}, dataType, memory::format_tag::ntc});
+    out_candidate.push_back(MKLDNNMemoryDesc{{N, D, SC}, stateType, memory::format_tag::ntc});
     if (haveCellState(cell_type))
         out_candidate.push_back(MKLDNNMemoryDesc{{N, D, SC}, memory::data_type::f32, memory::format_tag::ntc});
 
     createDescriptor(in_candidate, out_candidate);
 }
 
+memory::data_type MKLDNNRNN::inWeightsType(size_t port) const {
+    // fused I8 weights are kept as is, other weights are read as f32
+    return getOriginalInputPrecisionAtPort(port) == Precision::I8 ? memory::data_type::s8 : memory::data_type::f32;
+}
+
 bool MKLDNNRNN::verifyWeightsPrecision(const Precision &layerPrec, const Precision &weightsPrec) {
     if (!weightsByLayerPrec.count(layerPrec))
         IE_THROW() << "Unsupported layer precision " << layerPrec;
@@ -442,9 +498,15 @@ bool MKLDNNRNN::verifyWeightsPrecision(const Precision &layerPrec, const Precisi
 template <typename Prec>
 void MKLDNNRNN::fillWeights(const int *gate_map, const size_t wIdx, const size_t rIdx) {
     const auto weightPrec = getOriginalInputPrecisionAtPort(wIdx);
-    if (!verifyWeightsPrecision(runtimePrecision, weightPrec) && runtimePrecision != Precision::BF16 && weightPrec != Precision::FP32) {
+    const bool dequantizedWeights = withWeightsDequantization() && weightPrec == Precision::I8;
+    if (!verifyWeightsPrecision(runtimePrecision, weightPrec) && runtimePrecision != Precision::BF16 && weightPrec != Precision::FP32 &&
+            !dequantizedWeights) {
         IE_THROW() << "Doesn't support combination of weights precision: " << weightPrec << " and runtime precision: " << runtimePrecision;
     }
+    if (runtimePrecision == Precision::U8 && (!withWeightsDequantization() || wScales != rScales)) {
+        IE_THROW() << "U8 runtime precision requires I8 weights with the same dequantization scales of W and R";
+    }
+    const auto dstWeightPrec = weightsByLayerPrec.at(runtimePrecision);
     // create weight blobs (data and state part)
     auto w_data_mem = std::make_shared<MKLDNNMemory>(getEngine());
     w_data_mem->Create(w_data_d);
@@ -457,34 +519,52 @@ void MKLDNNRNN::fillWeights(const int *gate_map, const size_t wIdx, const size_t
     const size_t ie_r_vec_size = getParentEdgesAtPort(rIdx)[0]->getDims().size();
 
     auto *wInputNode = dynamic_cast<MKLDNNInputNode *>(getParentEdgesAtPort(wIdx)[0]->getParent().get());
-    auto wConstBlob = wInputNode->getConstBlob();
-
     auto *rInputNode = dynamic_cast<MKLDNNInputNode *>(getParentEdgesAtPort(rIdx)[0]->getParent().get());
+    if (!wInputNode || !rInputNode)
+        IE_THROW() << "Node " << getName() << " expects constant W and R inputs";
+
+    auto wConstBlob = wInputNode->getConstBlob();
     auto rConstBlob = rInputNode->getConstBlob();
 
     std::vector<Prec> ie_w_vec(ie_w_vec_size), ie_r_vec(ie_r_vec_size);
 
     auto ie_w_ptr = ie_w_vec.data();
     auto ie_r_ptr = ie_r_vec.data();
-    cpu_convert(wConstBlob->cbuffer().as<int8_t *>(), ie_w_ptr, weightPrec, runtimePrecision, ie_w_vec_size);
-    cpu_convert(rConstBlob->cbuffer().as<int8_t *>(), ie_r_ptr, weightPrec, runtimePrecision, ie_r_vec_size);
+    cpu_convert(wConstBlob->cbuffer().as<int8_t *>(), ie_w_ptr, weightPrec, dstWeightPrec, ie_w_vec_size);
+    cpu_convert(rConstBlob->cbuffer().as<int8_t *>(), ie_r_ptr, weightPrec, dstWeightPrec, ie_r_vec_size);
 
     auto w_ptr = static_cast<Prec*>(w_data_mem->GetData());
     auto r_ptr = static_cast<Prec*>(w_state_mem->GetData());
     const int step = SC * G;
 
+    /* Fused dequantization of I8 weights:
+     *   int8 primitive - W and R are copied as is, their common scales are passed to the primitive
+     *   other          - W and R are dequantized
+     */
+    std::vector<float> w_scales(step, 1.f), r_scales(step, 1.f);
+    if (runtimePrecision == Precision::U8) {
+        weightsScales.resize(step);
+        for (int oc = 0; oc < step; oc++)
+            weightsScales[gate_map[oc / SC] * SC + oc % SC] = wScales[oc];
+    } else if (withWeightsDequantization()) {
+        w_scales = wScales;
+        r_scales = rScales;
+    }
+
     for (int g = 0; g < G; g++) {
         for (int out_i = 0; out_i < SC; out_i++) {
+            const float w_scale = w_scales[g * SC + out_i];
             Prec *l_w_ptr = w_ptr + gate_map[g] * SC + out_i;
             for (int in_i = 0; in_i < DC; in_i++) {
-                *l_w_ptr = *ie_w_ptr;
+                *l_w_ptr = scaleWeight(*ie_w_ptr, w_scale);
                 ie_w_ptr++;
                 l_w_ptr += step;
             }
 
+            const float r_scale = r_scales[g * SC + out_i];
             Prec *l_r_ptr = r_ptr + gate_map[g] * SC + out_i;
             for (int in_i = 0; in_i < SC; in_i++) {
-                *l_r_ptr = *ie_r_ptr;
+                *l_r_ptr = scaleWeight(*ie_r_ptr, r_scale);
                 ie_r_ptr++;
                 l_r_ptr += step;
             }
@@ -580,10 +660,12 @@ void MKLDNNRNN::copyWeightsData() {
         fillWeights<bfloat16_t>(gate_map, wIdx, rIdx);
     else if (runtimePrecision == Precision::FP32)
         fillWeights<float>(gate_map, wIdx, rIdx);
-    else // TODO FP16 and INT8 support
+    else if (runtimePrecision == Precision::U8)
+        fillWeights<int8_t>(gate_map, wIdx, rIdx);
+    else // TODO FP16 support
         IE_THROW() << "Unsupported data type";
 
-    if (runtimePrecision == Precision::BF16 || runtimePrecision == Precision::FP32)
+    if (one_of(runtimePrecision, Precision::BF16, Precision::FP32, Precision::U8))
         fillBiases<Precision::FP32>(gate_map);
 }
 
@@ -667,7 +749,14 @@ void MKLDNNRNN::createDescriptor(const std::vector<TensorDesc> &inputDesc,
 }
 
 void MKLDNNRNN::createPrimitive() {
-    auto pd = descs[0].createPrimitiveDescriptorIterator(getEngine());
+    mkldnn::primitive_attr attr;
+    if (runtimePrecision == Precision::U8) {
+        attr.set_rnn_data_qparams(inputScale, inputShift);
+        // per output channel scales are applied over gates and hidden size dims of ldigo weights
+        attr.set_rnn_weights_qparams((1 << 3) | (1 << 4), weightsScales);
+    }
+
+    auto pd = descs[0].createPrimitiveDescriptorIterator(getEngine(), attr);
     prim.reset(new mkldnn::primitive(pd));
 }
 
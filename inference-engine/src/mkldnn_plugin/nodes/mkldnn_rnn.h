@@ -24,6 +24,21 @@ public:
 
     void execute(mkldnn::stream strm) override;
 
+    size_t getWeightsIdx() const { return wIdx; }
+    size_t getRecurrenceWeightsIdx() const { return rIdx; }
+
+    bool withWeightsDequantization() const {
+        return !wScales.empty();
+    }
+
+    // oneDNN provides int8 implementation for LSTM and GRU cells only, W and R share the weights scales
+    bool isInt8Supported() const;
+
+    // Fuses I8 W and R dequantization with per output channel (gate * hidden size) scales
+    void setWeightsDequantization(std::vector<float> wDequantizationScales, std::vector<float> rDequantizationScales);
+    // Fuses U8 layer input dequantization: src = (u8 - shift) * scale
+    void setInputDequantization(float scale, float shift);
+
 private:
     void initCell(const std::shared_ptr<ngraph::Node>& op);
     void initSeq(const std::shared_ptr<ngraph::Node>& op);
@@ -31,9 +46,11 @@ private:
     void fillSeqDesc();
     bool verifyWeightsPrecision(const InferenceEngine::Precision& layerPrec,
                                 const InferenceEngine::Precision& weightsPrec);
+    mkldnn::memory::data_type inWeightsType(size_t port) const;
 
     template <typename Prec>
     void fillWeights(const int* gate_map, const size_t wIdx, const size_t rIdx);
+
     template <InferenceEngine::Precision::ePrecision Prec>
     void fillBiases(const int* gate_map);
 
@@ -87,6 +104,17 @@ private:
     size_t rIdx = 0;
     size_t bIdx = 0;
 
+    /** Per output channel scales of the fused I8 W and R dequantization */
+    std::vector<float> wScales;
+    std::vector<float> rScales;
+
+    /** U8 layer input quantization of the int8 primitive: u8 = src * inputScale + inputShift */
+    float inputScale = 1.f;
+    float inputShift = 0.f;
+
+    /** Per output channel scales of I8 W and R in mkldnn gate order */
+    std::vector<float> weightsScales;
+
     static const std::map<InferenceEngine::Precision, InferenceEngine::Precision> weightsByLayerPrec;
 };
 
@@ -15,6 +15,8 @@
 #include <ngraph_ops/nms_ie_internal.hpp>
 #include "utils/general_utils.h"
 #include <ie_ngraph_utils.hpp>
+#include "common/score_bucket_sorter.h"
+#include "box_overlap_imp.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -128,38 +130,37 @@ public:
         }
     }
 
-    float intersectionOverUnion(const float *boxesI, const float *boxesJ) {
-        float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
+    // writes {xmin, ymin, xmax, ymax, area} of the box
+    void getCornerBox(const float *box, float *cornerBox) {
         if (boxEncodingType == boxEncoding::CENTER) {
             //  box format: x_center, y_center, width, height
-            yminI = boxesI[1] - boxesI[3] / 2.f;
-            xminI = boxesI[0] - boxesI[2] / 2.f;
-            ymaxI = boxesI[1] + boxesI[3] / 2.f;
-            xmaxI = boxesI[0] + boxesI[2] / 2.f;
-            yminJ = boxesJ[1] - boxesJ[3] / 2.f;
-            xminJ = boxesJ[0] - boxesJ[2] / 2.f;
-            ymaxJ = boxesJ[1] + boxesJ[3] / 2.f;
-            xmaxJ = boxesJ[0] + boxesJ[2] / 2.f;
+            cornerBox[0] = box[0] - box[2] / 2.f;
+            cornerBox[1] = box[1] - box[3] / 2.f;
+            cornerBox[2] = box[0] + box[2] / 2.f;
+            cornerBox[3] = box[1] + box[3] / 2.f;
         } else {
             //  box format: y1, x1, y2, x2
-            yminI = (std::min)(boxesI[0], boxesI[2]);
-            xminI = (std::min)(boxesI[1], boxesI[3]);
-            ymaxI = (std::max)(boxesI[0], boxesI[2]);
-            xmaxI = (std::max)(boxesI[1], boxesI[3]);
-            yminJ = (std::min)(boxesJ[0], boxesJ[2]);
-            xminJ = (std::min)(boxesJ[1], boxesJ[3]);
-            ymaxJ = (std::max)(boxesJ[0], boxesJ[2]);
-            xmaxJ = (std::max)(boxesJ[1], boxesJ[3]);
+            cornerBox[0] = (std::min)(box[1], box[3]);
+            cornerBox[1] = (std::min)(box[0], box[2]);
+            cornerBox[2] = (std::max)(box[1], box[3]);
+            cornerBox[3] = (std::max)(box[0], box[2]);
         }
+        cornerBox[4] = (cornerBox[3] - cornerBox[1]) * (cornerBox[2] - cornerBox[0]);
+    }
 
-        float areaI = (ymaxI - yminI) * (xmaxI - xminI);
-        float areaJ = (ymaxJ - yminJ) * (xmaxJ - xminJ);
+    float intersectionOverUnion(const float *boxesI, const float *boxesJ) {
+        float cornerI[5], cornerJ[5];
+        getCornerBox(boxesI, cornerI);
+        getCornerBox(boxesJ, cornerJ);
+
+        const float areaI = cornerI[4];
+        const float areaJ = cornerJ[4];
         if (areaI <= 0.f || areaJ <= 0.f)
             return 0.f;
 
         float intersection_area =
-            (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ), 0.f) *
-            (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ), 0.f);
+            (std::max)((std::min)(cornerI[3], cornerJ[3]) - (std::max)(cornerI[1], cornerJ[1]), 0.f) *
+            (std::max)((std::min)(cornerI[2], cornerJ[2]) - (std::max)(cornerI[0], cornerJ[0]), 0.f);
         return intersection_area / (areaI + areaJ - intersection_area);
     }
 
@@ -195,11 +196,13 @@ public:
             const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
             const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-            std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
+            std::vector<boxInfo> candidates;
             for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
                 if (scoresPtr[box_idx] > score_threshold)
-                    sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
+                    candidates.emplace_back(boxInfo({scoresPtr[box_idx], box_idx, 0}));
             }
+            // the heap is built from all the candidates at once in linear time
+            std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less, std::move(candidates));
 
             fb.reserve(sorted_boxes.size());
             if (sorted_boxes.size() > 0) {
@@ -243,40 +246,45 @@ public:
     void nmsWithoutSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides, const SizeVector &scoresStrides,
                              std::vector<filteredBoxes> &filtBoxes) {
         int max_out_box = static_cast<int>(max_output_boxes_per_class);
+
+        // corner coordinates and areas of the boxes are computed once and shared by all the classes
+        std::vector<float> cornerBoxes(num_batches * num_boxes * 5);
+        parallel_for2d(num_batches, num_boxes, [&](int batch_idx, int box_idx) {
+            getCornerBox(boxes + batch_idx * boxesStrides[0] + box_idx * 4, &cornerBoxes[(batch_idx * num_boxes + box_idx) * 5]);
+        });
+
         parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
-            const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
+            const float *cornerBoxesPtr = cornerBoxes.data() + batch_idx * num_boxes * 5;
             const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-            std::vector<std::pair<float, int>> sorted_boxes;
+            std::vector<int> candidates;
             for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
                 if (scoresPtr[box_idx] > score_threshold)
-                    sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
+                    candidates.push_back(box_idx);
             }
+            ScoreBucketSorter sorter(scoresPtr, candidates.data(), candidates.size());
 
+            // selected boxes are stored coordinate-wise for the vectorized IoU computation
+            const size_t selectedMax = (std::min)(max_output_boxes_per_class, candidates.size());
+            std::vector<float> selXmin(selectedMax), selYmin(selectedMax), selXmax(selectedMax), selYmax(selectedMax), selArea(selectedMax);
+
+            int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
             int io_selection_size = 0;
-            if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
-                              [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                                    return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                                });
-                int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
-                filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
+            for (size_t i = 0; (i < candidates.size()) && (io_selection_size < max_out_box); i++) {
+                sorter.sortFirst(i + 1);
+                const int box_idx = candidates[i];
+                const float *box = cornerBoxesPtr + box_idx * 5;
+                if (XARCH::box_overlaps_any(box, selXmin.data(), selYmin.data(), selXmax.data(), selYmax.data(), selArea.data(),
+                                            io_selection_size, iou_threshold, true))
+                    continue;
+
+                filtBoxes[offset + io_selection_size] = filteredBoxes(scoresPtr[box_idx], batch_idx, class_idx, box_idx);
+                selXmin[io_selection_size] = box[0];
+                selYmin[io_selection_size] = box[1];
+                selXmax[io_selection_size] = box[2];
+                selYmax[io_selection_size] = box[3];
+                selArea[io_selection_size] = box[4];
                 io_selection_size++;
-                for (size_t box_idx = 1; (box_idx < sorted_boxes.size()) && (io_selection_size < max_out_box); box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4], &boxesPtr[filtBoxes[offset + idx].box_index * 4]);
-                        if (iou >= iou_threshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
-
-                    if (box_is_selected) {
-                        filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx, sorted_boxes[box_idx].second);
-                        io_selection_size++;
-                    }
-                }
             }
             numFiltBox[batch_idx][class_idx] = io_selection_size;
         });
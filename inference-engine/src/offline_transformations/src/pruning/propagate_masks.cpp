@@ -2,6 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <map>
+#include <set>
+
 #include "pruning.hpp"
 #include "mask_attribute.hpp"
 
@@ -17,8 +21,12 @@ namespace mask_propagation {
 
 class Convolution;
 class GroupConvolution;
+class MatMul;
 class Elementwise;
 class PassThrough;
+class Reshape;
+class Transpose;
+class MVN;
 class StopPropagation;
 
 } // namespace mask_propagation
@@ -169,6 +177,79 @@ public:
     }
 };
 
+class ngraph::pass::mask_propagation::MatMul : public MatcherPass {
+public:
+    MatMul() {
+        auto input = pattern::any_input(pattern::has_static_rank());
+        auto weights = pattern::any_input(pattern::has_static_shape());
+        auto matmul = pattern::wrap_type<opset6::MatMul>({input, weights});
+
+        ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+            const auto & pattern_map = m.get_pattern_value_map();
+            const auto & m_weights = pattern_map.at(weights);
+            const auto & m_output = pattern_map.at(matmul);
+            const auto & m_input = pattern_map.at(input);
+
+            // Only FullyConnected-like MatMul is supported: 2D weights and not transposed data
+            auto matmul_node = std::dynamic_pointer_cast<opset6::MatMul>(m_output.get_node_shared_ptr());
+            if (!matmul_node || matmul_node->get_transpose_a() || m_weights.get_shape().size() != 2) {
+                return false;
+            }
+            const size_t weights_in_dim = matmul_node->get_transpose_b() ? 1 : 0;
+            const size_t weights_out_dim = matmul_node->get_transpose_b() ? 0 : 1;
+            const size_t input_channel_dim = m_input.get_partial_shape().rank().get_length() - 1;
+            const size_t output_rank = m_output.get_partial_shape().rank().get_length();
+
+            InitConstMask({weights_out_dim}).apply(m_weights.get_node_shared_ptr());
+
+            auto weights_mask = getMask(m_weights);
+            if (!weights_mask) return false;
+            auto weights_mask_row = weights_mask.get();
+
+            if (auto input_mask = getMask(m_input)) {
+                auto input_mask_row = input_mask.get();
+                // Weights input channel is connected to the innermost data dimension
+                weights_mask->add_callback([=](Mask::Ptr cur_mask) -> bool {
+                    cur_mask->at(weights_in_dim) = input_mask_row->at(input_channel_dim);
+                    return true;
+                }, input_mask);
+
+                input_mask->add_callback([=](Mask::Ptr cur_mask) -> bool {
+                    cur_mask->at(input_channel_dim) = weights_mask_row->at(weights_in_dim);
+                    return true;
+                }, weights_mask);
+
+                if (!weights_mask->apply_callback(input_mask)) {
+                    return false;
+                }
+            }
+
+            auto matmul_mask = std::make_shared<Mask>(output_rank);
+            auto matmul_mask_row = matmul_mask.get();
+
+            matmul_mask->add_callback([=](Mask::Ptr cur_mask) -> bool {
+                cur_mask->at(output_rank - 1) = weights_mask_row->at(weights_out_dim);
+                return true;
+            }, weights_mask);
+
+            weights_mask->add_callback([=](Mask::Ptr cur_mask) -> bool {
+                cur_mask->at(weights_out_dim) = matmul_mask_row->at(output_rank - 1);
+                return true;
+            }, matmul_mask);
+
+            if (!matmul_mask->apply_callback(weights_mask)) {
+                return false;
+            }
+
+            setMask(m_output, matmul_mask);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, "MatMulMaskPropagation");
+        register_matcher(m, callback);
+    }
+};
+
 class ngraph::pass::mask_propagation::Elementwise : public MatcherPass {
 public:
     Elementwise() {
@@ -186,13 +267,24 @@ public:
             // TODO: implement check that compares input shape ranks
             const auto & input_rank = m_input.get_partial_shape().rank().get_length();
             const auto & weights_rank = m_weights.get_partial_shape().rank().get_length();
-            if (weights_rank < 3 || input_rank < 3) return false;
-
-            // In case if one of the inputs is constant
-            // TODO: need to find channel dimension instead of hardcoded zero
-            const size_t & channel_dim = (input_rank == weights_rank ? 1 : 0);
-            InitConstMask({channel_dim}).apply(m_input.get_node_shared_ptr());
-            InitConstMask({channel_dim}).apply(m_weights.get_node_shared_ptr());
+            if (std::max(weights_rank, input_rank) < 2) return false;
+
+            // In case if one of the inputs is constant: a broadcasted constant (e.g. bias of FullyConnected
+            // or Convolution) has a single non-trivial dimension, otherwise the channel dimension is assumed
+            auto init_const_mask = [&](const Output<Node> & output) {
+                const auto & shape = output.get_partial_shape();
+                const size_t rank = shape.rank().get_length();
+                if (rank == 0 || shape.is_dynamic()) return;
+
+                size_t channel_dim = std::min<size_t>(input_rank == weights_rank ? 1 : 0, rank - 1);
+                const auto & dims = shape.to_shape();
+                if (std::count_if(dims.begin(), dims.end(), [](size_t dim) { return dim != 1; }) == 1) {
+                    channel_dim = std::distance(dims.begin(), std::find_if(dims.begin(), dims.end(), [](size_t dim) { return dim != 1; }));
+                }
+                InitConstMask({channel_dim}).apply(output.get_node_shared_ptr());
+            };
+            init_const_mask(m_input);
+            init_const_mask(m_weights);
 
             auto weights_mask = getMask(m_weights);
             auto input_mask = getMask(m_input);
@@ -285,6 +377,201 @@ public:
     }
 };
 
+class ngraph::pass::mask_propagation::Reshape : public MatcherPass {
+public:
+    Reshape() {
+        auto input = pattern::any_input(pattern::has_static_shape());
+        auto shape = pattern::wrap_type<opset6::Constant>();
+        auto reshape = pattern::wrap_type<opset6::Reshape>({input, shape}, pattern::has_static_shape());
+
+        ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+            const auto & pattern_map = m.get_pattern_value_map();
+            const auto & m_shape = pattern_map.at(shape);
+            const auto & m_output = pattern_map.at(reshape);
+            const auto & m_input = pattern_map.at(input);
+
+            auto input_mask = getMask(m_input);
+            // Target shape is shrunk by ShrinkWeights, so it can't be shared with other Reshapes
+            if (!input_mask || m_shape.get_target_inputs().size() != 1) return false;
+            auto input_mask_row = input_mask.get();
+
+            // Outer and inner dimensions with the same sizes keep their layout, so they keep the mask as well.
+            // Example: [N, S, C] -> [N * S, C] keeps C, [N, C, 1, 1] -> [N, C] keeps N and C
+            const auto & input_shape = m_input.get_shape();
+            const auto & output_shape = m_output.get_shape();
+            std::map<size_t, size_t> dims_map;  // output dimension -> input dimension
+            size_t inner_dims = 0;
+            while (inner_dims < std::min(input_shape.size(), output_shape.size()) &&
+                   input_shape[input_shape.size() - inner_dims - 1] == output_shape[output_shape.size() - inner_dims - 1]) {
+                dims_map[output_shape.size() - inner_dims - 1] = input_shape.size() - inner_dims - 1;
+                inner_dims++;
+            }
+            for (size_t dim = 0; dim + inner_dims < std::min(input_shape.size(), output_shape.size()) &&
+                                 input_shape[dim] == output_shape[dim]; ++dim) {
+                dims_map[dim] = dim;
+            }
+
+            auto output_mask = std::make_shared<Mask>(output_shape.size());
+            auto output_mask_row = output_mask.get();
+
+            output_mask->add_callback([input_mask_row, dims_map](Mask::Ptr cur_mask) -> bool {
+                cur_mask->clean_dim_values();
+                for (const auto & dims : dims_map) {
+                    cur_mask->at(dims.first) = input_mask_row->at(dims.second);
+                }
+                return true;
+            }, input_mask);
+
+            input_mask->add_callback([output_mask_row, dims_map](Mask::Ptr cur_mask) -> bool {
+                // Dimensions which are split or merged can't be pruned
+                cur_mask->clean_dim_values();
+                for (const auto & dims : dims_map) {
+                    cur_mask->at(dims.second) = output_mask_row->at(dims.first);
+                }
+                return true;
+            }, output_mask);
+
+            // Positive target shape values are decreased by the number of pruned values (see ShrinkWeights)
+            const auto shape_values = std::dynamic_pointer_cast<opset6::Constant>(m_shape.get_node_shared_ptr())->cast_vector<int64_t>();
+            auto shape_mask = std::make_shared<Mask>(shape_values.size());
+            shape_mask->set_shape_like(true);
+
+            shape_mask->add_callback([output_mask_row, shape_values](Mask::Ptr cur_mask) -> bool {
+                for (size_t dim = 0; dim < shape_values.size(); ++dim) {
+                    cur_mask->at(dim) = shape_values[dim] > 0 ? output_mask_row->at(dim) : Mask::value_type{};
+                }
+                return true;
+            }, output_mask);
+
+            output_mask->add_callback([](Mask::Ptr cur_mask) -> bool {
+                return true;
+            }, shape_mask);
+
+            if (!output_mask->apply_callback(input_mask)) {
+                return false;
+            }
+
+            setMask(m_shape, shape_mask);
+            setMask(m_output, output_mask);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(reshape, "ReshapeMaskPropagation");
+        register_matcher(m, callback);
+    }
+};
+
+class ngraph::pass::mask_propagation::Transpose : public MatcherPass {
+public:
+    Transpose() {
+        auto input = pattern::any_input(pattern::has_static_rank());
+        auto order = pattern::wrap_type<opset6::Constant>();
+        auto transpose = pattern::wrap_type<opset6::Transpose>({input, order});
+
+        ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+            const auto & pattern_map = m.get_pattern_value_map();
+            const auto & m_order = pattern_map.at(order);
+            const auto & m_output = pattern_map.at(transpose);
+            const auto & m_input = pattern_map.at(input);
+
+            auto input_mask = getMask(m_input);
+            if (!input_mask) return false;
+            auto input_mask_row = input_mask.get();
+
+            const size_t rank = m_input.get_partial_shape().rank().get_length();
+            auto order_values = std::dynamic_pointer_cast<opset6::Constant>(m_order.get_node_shared_ptr())->cast_vector<int64_t>();
+            // Empty order reverses dimensions
+            if (order_values.empty()) {
+                for (size_t dim = rank; dim > 0; --dim) {
+                    order_values.push_back(dim - 1);
+                }
+            }
+            if (order_values.size() != rank) return false;
+
+            auto output_mask = std::make_shared<Mask>(rank);
+            auto output_mask_row = output_mask.get();
+
+            output_mask->add_callback([input_mask_row, order_values](Mask::Ptr cur_mask) -> bool {
+                for (size_t dim = 0; dim < order_values.size(); ++dim) {
+                    cur_mask->at(dim) = input_mask_row->at(order_values[dim]);
+                }
+                return true;
+            }, input_mask);
+
+            input_mask->add_callback([output_mask_row, order_values](Mask::Ptr cur_mask) -> bool {
+                for (size_t dim = 0; dim < order_values.size(); ++dim) {
+                    cur_mask->at(order_values[dim]) = output_mask_row->at(dim);
+                }
+                return true;
+            }, output_mask);
+
+            if (!output_mask->apply_callback(input_mask)) {
+                return false;
+            }
+
+            setMask(m_output, output_mask);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(transpose, "TransposeMaskPropagation");
+        register_matcher(m, callback);
+    }
+};
+
+class ngraph::pass::mask_propagation::MVN : public MatcherPass {
+public:
+    MVN() {
+        auto input = pattern::any_input(pattern::has_static_rank());
+        auto axes = pattern::wrap_type<opset6::Constant>();
+        auto mvn = pattern::wrap_type<opset6::MVN>({input, axes});
+
+        ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+            const auto & pattern_map = m.get_pattern_value_map();
+            const auto & m_axes = pattern_map.at(axes);
+            const auto & m_output = pattern_map.at(mvn);
+            const auto & m_input = pattern_map.at(input);
+
+            auto input_mask = getMask(m_input);
+            if (!input_mask) return false;
+            auto input_mask_row = input_mask.get();
+
+            // Zero channels contribute to the mean and variance, so normalized dimensions can't be pruned
+            const int64_t rank = m_input.get_partial_shape().rank().get_length();
+            std::set<size_t> reduced_dims;
+            for (auto axis : std::dynamic_pointer_cast<opset6::Constant>(m_axes.get_node_shared_ptr())->cast_vector<int64_t>()) {
+                reduced_dims.insert(axis < 0 ? axis + rank : axis);
+            }
+
+            auto output_mask = std::make_shared<Mask>(rank);
+            auto output_mask_row = output_mask.get();
+
+            output_mask->add_callback([input_mask_row, reduced_dims](Mask::Ptr cur_mask) -> bool {
+                for (size_t dim = 0; dim < cur_mask->size(); ++dim) {
+                    cur_mask->at(dim) = reduced_dims.count(dim) ? Mask::value_type{} : input_mask_row->at(dim);
+                }
+                return true;
+            }, input_mask);
+
+            input_mask->add_callback([output_mask_row, reduced_dims](Mask::Ptr cur_mask) -> bool {
+                for (size_t dim = 0; dim < cur_mask->size(); ++dim) {
+                    cur_mask->at(dim) = reduced_dims.count(dim) ? Mask::value_type{} : output_mask_row->at(dim);
+                }
+                return true;
+            }, output_mask);
+
+            if (!output_mask->apply_callback(input_mask)) {
+                return false;
+            }
+
+            setMask(m_output, output_mask);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(mvn, "MVNMaskPropagation");
+        register_matcher(m, callback);
+    }
+};
+
 class ngraph::pass::mask_propagation::StopPropagation : public MatcherPass {
 public:
     StopPropagation() {
@@ -310,7 +597,11 @@ public:
 ngraph::pass::PropagateMasks::PropagateMasks() {
     add_matcher<mask_propagation::Convolution>();
     add_matcher<mask_propagation::GroupConvolution>();
+    add_matcher<mask_propagation::MatMul>();
     add_matcher<mask_propagation::Elementwise>();
     add_matcher<mask_propagation::PassThrough>();
+    add_matcher<mask_propagation::Reshape>();
+    add_matcher<mask_propagation::Transpose>();
+    add_matcher<mask_propagation::MVN>();
     add_matcher<mask_propagation::StopPropagation>();
 }
@@ -116,6 +116,11 @@ public:
         IE_THROW(NotImplemented);
     }
 
+    void UpdateWeights(const CNNNetwork& network) override {
+        (void)network;
+        IE_THROW(NotImplemented);
+    }
+
     /**
      * @brief      Creates an inference request public implementation.
      * @return     The request public implementation
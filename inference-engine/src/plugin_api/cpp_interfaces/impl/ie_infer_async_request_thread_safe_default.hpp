@@ -252,6 +252,16 @@ public:
         return _syncRequest->QueryState();
     }
 
+    void SetStateSessions(const std::vector<std::string>& sessionIds) override {
+        CheckState();
+        _syncRequest->SetStateSessions(sessionIds);
+    }
+
+    void ReleaseStateSession(const std::string& sessionId) override {
+        CheckState();
+        _syncRequest->ReleaseStateSession(sessionId);
+    }
+
     void ThrowIfCanceled() const {
         std::lock_guard<std::mutex> lock{_mutex};
         if (_state == InferState::Canceled) {
@@ -110,6 +110,12 @@ public:
      * @return A reference to a context
      */
     virtual RemoteContext::Ptr GetContext() const = 0;
+
+    /**
+     * @brief Replaces the weights of the executable network with the weights of the network with the same topology
+     * @param network A network to take the constant data from
+     */
+    virtual void UpdateWeights(const CNNNetwork& network) = 0;
 };
 
 /**
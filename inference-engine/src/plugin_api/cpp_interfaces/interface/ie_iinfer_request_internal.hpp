@@ -113,6 +113,19 @@ public:
      */
     virtual std::vector<std::shared_ptr<IVariableStateInternal>> QueryState();
 
+    /**
+     * @brief Switches memory states of the request to the states of the given sessions.
+     * @param sessionIds - names of the sessions, states of the i-th session are used for the i-th batch item.
+     *                     Empty vector switches the request back to its own states.
+     */
+    virtual void SetStateSessions(const std::vector<std::string>& sessionIds);
+
+    /**
+     * @brief Releases memory states of the session, so they can be reused by other sessions.
+     * @param sessionId - name of the session
+     */
+    virtual void ReleaseStateSession(const std::string& sessionId);
+
     /**
      * @brief Start inference of specified input(s) in asynchronous mode
      * @note The method returns immediately. Inference starts also immediately.
@@ -147,5 +147,15 @@ inline Precision convertPrecision(const ::ngraph::element::Type& precision) {
  */
 INFERENCE_ENGINE_API_CPP(CNNNetwork) cloneNetwork(const CNNNetwork& network);
 
+/**
+ * @brief Returns the size of the constants data of the network loaded to the physical memory of the process,
+ * counted with the page granularity
+ * @note The weights of a network read from the IR files are mapped from the weights file by default and loaded on the
+ * first access only, so the size taken after and before LoadNetwork gives the amount of the weights touched by it.
+ * @param network A network to check
+ * @return The size in bytes
+ */
+INFERENCE_ENGINE_API_CPP(size_t) getResidentConstantsSize(const CNNNetwork& network);
+
 }  // namespace details
 }  // namespace InferenceEngine
@@ -177,6 +177,18 @@ std::vector<std::vector<cv::gapi::own::Mat>> bind_to_blob(const I420Blob::Ptr& i
     return batched_input_plane_mats;
 }
 
+// items of a BatchedBlob are single images, so each of them is bound separately
+template<typename BlobTypePtr>
+std::vector<std::vector<cv::gapi::own::Mat>> bind_to_blob(const std::vector<BlobTypePtr>& inBlobs,
+                                                          int batch_size) {
+    std::vector<std::vector<cv::gapi::own::Mat>> batched_input_plane_mats(batch_size);
+    for (int i = 0; i < batch_size; ++i) {
+        batched_input_plane_mats[i] = std::move(bind_to_blob(inBlobs[i], 1)[0]);
+    }
+
+    return batched_input_plane_mats;
+}
+
 template<typename... Ts, int... IIs>
 std::vector<cv::GMat> to_vec_impl(std::tuple<Ts...> &&gmats, cv::detail::Seq<IIs...>) {
     return { std::get<IIs>(gmats)... };
@@ -357,6 +369,13 @@ void validateBlob(const I420Blob::Ptr &inBlob) {
     validateTensorDesc(v_blob->getTensorDesc());
 }
 
+template<typename BlobTypePtr>
+void validateBlob(const std::vector<BlobTypePtr> &inBlobs) {
+    for (const auto& blob : inBlobs) {
+        validateBlob(blob);
+    }
+}
+
 const std::pair<const TensorDesc&, Layout> getTensorDescAndLayout(const MemoryBlob::Ptr &blob) {
     const auto& desc =  blob->getTensorDesc();
     return {desc, desc.getLayout()};
@@ -373,6 +392,22 @@ const std::pair<const TensorDesc&, Layout> getTensorDescAndLayout(const I420Blob
     return {blob->y()->getTensorDesc(), Layout::NCHW};
 }
 
+// BatchedBlob guarantees that all its items have the same tensor descriptor
+template<typename BlobTypePtr>
+const std::pair<const TensorDesc&, Layout> getTensorDescAndLayout(const std::vector<BlobTypePtr> &blobs) {
+    return getTensorDescAndLayout(blobs.front());
+}
+
+template<typename BlobTypePtr>
+int getBatchSize(G::Desc in_desc, const BlobTypePtr &) {
+    return in_desc.d.N;
+}
+
+template<typename BlobTypePtr>
+int getBatchSize(G::Desc, const std::vector<BlobTypePtr> &blobs) {
+    return static_cast<int>(blobs.size());
+}
+
 G::Desc getGDesc(G::Desc in_desc_y, const NV12Blob::Ptr &) {
     auto nv12_desc = G::Desc{};
     nv12_desc.d = in_desc_y.d;
@@ -395,6 +430,26 @@ G::Desc getGDesc(G::Desc in_desc_y, const MemoryBlob::Ptr &) {
     return in_desc_y;
 }
 
+template<typename BlobTypePtr>
+G::Desc getGDesc(G::Desc in_desc_y, const std::vector<BlobTypePtr> &blobs) {
+    return getGDesc(in_desc_y, blobs.front());
+}
+
+template<typename BlobType>
+std::vector<typename BlobType::Ptr> getBatchedBlobItems(const BatchedBlob::Ptr &inBlob, ColorFormat fmt) {
+    std::vector<typename BlobType::Ptr> items;
+    items.reserve(inBlob->size());
+    for (size_t i = 0; i < inBlob->size(); i++) {
+        auto item = as<BlobType>(inBlob->getBlob(i));
+        if (!item) {
+            IE_THROW()  << "Unsupported input blob for color format " << fmt
+                                << ": unexpected type of BatchedBlob item " << i;
+        }
+        items.push_back(std::move(item));
+    }
+    return items;
+}
+
 class PlanarColorConversions {
     using GMats = std::vector<cv::GMat>;
     using CvtFunction = std::function<GMats(const GMats&, Layout, Layout, ResizeAlgorithm)>;
@@ -762,10 +817,12 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
 void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst) {
     // Note: src blob is the ROI blob, dst blob is the network's input blob
 
-    // src is either a memory blob, an NV12, or an I420 blob
-    const bool yuv420_blob = src->is<NV12Blob>() || src->is<I420Blob>();
-    if (!src->is<MemoryBlob>() && !yuv420_blob) {
-        IE_THROW()  << "Unsupported input blob type: expected MemoryBlob, NV12Blob or I420Blob";
+    // src is either a memory blob, an NV12, or an I420 blob, or a batch of such blobs
+    const auto batched_blob = src->as<BatchedBlob>();
+    const Blob::Ptr item = batched_blob ? batched_blob->getBlob(0) : src;
+    const bool yuv420_blob = item && (item->is<NV12Blob>() || item->is<I420Blob>());
+    if (!item || (!item->is<MemoryBlob>() && !yuv420_blob)) {
+        IE_THROW()  << "Unsupported input blob type: expected MemoryBlob, NV12Blob, I420Blob or BatchedBlob of them";
     }
 
     // dst is always a memory blob
@@ -800,16 +857,17 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
         IE_THROW() << "Input pre-processing is called with invalid batch size " << batch;
     }
 
-    if (blob->is<CompoundBlob>()) {
-        // batch size must always be 1 in compound blob case
-        if (batch > 1) {
-            IE_THROW()  << "Provided input blob batch size " << batch
-                                << " is not supported in compound blob pre-processing";
-        }
-        batch = 1;
-    } else if (batch < 0) {
+    if (batch < 0) {
         // if batch size is unspecified, process the whole input blob
-        batch = static_cast<int>(blob->getTensorDesc().getDims()[0]);
+        if (auto batched_blob = blob->as<BatchedBlob>()) {
+            batch = static_cast<int>(batched_blob->size());
+        } else if (auto nv12_blob = blob->as<NV12Blob>()) {
+            batch = static_cast<int>(nv12_blob->y()->getTensorDesc().getDims()[0]);
+        } else if (auto i420_blob = blob->as<I420Blob>()) {
+            batch = static_cast<int>(i420_blob->y()->getTensorDesc().getDims()[0]);
+        } else {
+            batch = static_cast<int>(blob->getTensorDesc().getDims()[0]);
+        }
     }
 
     return batch;
@@ -922,9 +980,10 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
 
     // according to the IE's current design, input blob batch size _must_ match networks's expected
     // batch size, even if the actual processing batch size (set on infer request) is different.
-    if (in_desc.d.N != out_desc.d.N) {
+    const int in_batch = getBatchSize(in_desc, inBlob);
+    if (in_batch != out_desc.d.N) {
         IE_THROW()  << "Input blob batch size is invalid: (input blob) "
-                            << in_desc.d.N << " != " << out_desc.d.N << " (expected by network)";
+                            << in_batch << " != " << out_desc.d.N << " (expected by network)";
     }
 
     // sanity check batch size
@@ -989,6 +1048,21 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
 
     // FIXME: refactor the code below. there must be a better way to handle the difference
 
+    // a batch of images is processed by the same compiled graph as a single image of the batch
+    if (auto inBatchedBlob = as<BatchedBlob>(inBlob)) {
+        switch (in_fmt) {
+        case ColorFormat::NV12:
+            return preprocessBlob(getBatchedBlobItems<NV12Blob>(inBatchedBlob, in_fmt), outMemoryBlob, algorithm,
+                in_fmt, out_fmt, omp_serial, batch_size);
+        case ColorFormat::I420:
+            return preprocessBlob(getBatchedBlobItems<I420Blob>(inBatchedBlob, in_fmt), outMemoryBlob, algorithm,
+                in_fmt, out_fmt, omp_serial, batch_size);
+        default:
+            return preprocessBlob(getBatchedBlobItems<MemoryBlob>(inBatchedBlob, in_fmt), outMemoryBlob, algorithm,
+                in_fmt, out_fmt, omp_serial, batch_size);
+        }
+    }
+
     // if input color format is not NV12, a MemoryBlob is expected. otherwise, NV12Blob is expected
     switch (in_fmt) {
     case ColorFormat::NV12: {
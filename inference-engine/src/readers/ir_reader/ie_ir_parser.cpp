@@ -6,7 +6,12 @@
 #include "ie_ir_itt.hpp"
 
 #include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
 #include <deque>
+#include <exception>
+#include <locale>
 #include <map>
 #include <memory>
 #include <ngraph/ngraph.hpp>
@@ -29,6 +34,7 @@
 
 #include <cpp/ie_cnn_network.h>
 #include <ie_ngraph_utils.hpp>
+#include <ie_parallel.hpp>
 #include "blob_factory.hpp"
 #include "caseless.hpp"
 #include "precision_utils.h"
@@ -64,20 +70,72 @@ bool getStrAttribute(const pugi::xml_node& node, const std::string& name, std::s
     return true;
 }
 
+// Integer attribute values are parsed with strto* instead of std::stringstream: IRs with hundreds of thousands
+// of layers spend most of the attributes visiting time in stream construction otherwise.
+// The conversions keep the stream semantics: leading spaces are skipped, parsing stops on the first
+// character that does not belong to the value, and 0 is returned if there is no value.
+inline void parseValue(const char* str, size_t, int32_t& value) {
+    value = static_cast<int32_t>(std::strtol(str, nullptr, 10));
+}
+
+inline void parseValue(const char* str, size_t, int64_t& value) {
+    value = static_cast<int64_t>(std::strtoll(str, nullptr, 10));
+}
+
+inline void parseValue(const char* str, size_t, size_t& value) {
+    value = static_cast<size_t>(std::strtoull(str, nullptr, 10));
+}
+
+// strtof/strtod depend on the C locale of the application, e.g. on its decimal separator, so floating point
+// values are read by a stream with the classic locale, which is created once per thread
+template <class T>
+inline void parseClassicLocaleValue(const char* str, size_t len, T& value) {
+    struct ClassicStream {
+        ClassicStream() {
+            stream.imbue(std::locale::classic());
+        }
+        std::istringstream stream;
+    };
+    static thread_local ClassicStream classic;
+    classic.stream.clear();
+    classic.stream.str(std::string(str, len));
+    value = 0;
+    classic.stream >> value;
+}
+
+inline void parseValue(const char* str, size_t len, float& value) {
+    parseClassicLocaleValue(str, len, value);
+}
+
+inline void parseValue(const char* str, size_t len, double& value) {
+    parseClassicLocaleValue(str, len, value);
+}
+
+inline void parseValue(const char* str, size_t len, std::string& value) {
+    const char* end = str + len;
+    while (str != end && std::isspace(static_cast<unsigned char>(*str))) str++;
+    const char* tokenEnd = str;
+    while (tokenEnd != end && !std::isspace(static_cast<unsigned char>(*tokenEnd))) tokenEnd++;
+    value.assign(str, tokenEnd);
+}
+
 template <class T>
 bool getParameters(const pugi::xml_node& node, const std::string& name, std::vector<T>& value) {
-    std::string param;
-    if (!getStrAttribute(node, name, param)) return false;
-    std::stringstream ss(param);
-    std::string field;
-    while (getline(ss, field, ',')) {
-        if (field.empty())
+    if (!node) return false;
+    auto attr = node.attribute(name.c_str());
+    if (attr.empty()) return false;
+    const char* param = attr.value();
+    for (const char* field = param; *field != '\0';) {
+        const char* fieldEnd = std::strchr(field, ',');
+        size_t len = fieldEnd ? static_cast<size_t>(fieldEnd - field) : std::strlen(field);
+        if (len == 0)
             IE_THROW() << "Cannot get vector of parameters! \"" << param
                                << "\" is incorrect";
-        std::stringstream fs(field);
-        T val;
-        fs >> val;
+        T val{};
+        parseValue(field, len, val);
         value.emplace_back(val);
+        if (!fieldEnd) break;
+        field = fieldEnd + 1;
     }
     return true;
 }
@@ -85,13 +143,33 @@ bool getParameters(const pugi::xml_node& node, const std::string& name, std::vec
 template <class T>
 T stringToType(const std::string& valStr) {
     T ret{0};
-    std::istringstream ss(valStr);
-    if (!ss.eof()) {
-        ss >> ret;
-    }
+    parseValue(valStr.c_str(), valStr.size(), ret);
     return ret;
 }
 
+// exceptions are collected per layer, so that the reported error does not depend on the threading
+template <typename F>
+std::vector<std::exception_ptr> parallelForEachLayerCollectErrors(size_t count, const F& func) {
+    std::vector<std::exception_ptr> errors(count);
+    parallel_for(count, [&](size_t i) {
+        try {
+            func(i);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    return errors;
+}
+
+// re-throws the first error in the layers order
+template <typename F>
+void parallelForEachLayer(size_t count, const F& func) {
+    for (auto& error : parallelForEachLayerCollectErrors(count, func)) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+
 class XmlDeserializer : public ngraph::AttributeVisitor {
 public:
     /// TODO: move whole class to src file
@@ -100,24 +178,22 @@ public:
         const Blob::CPtr& weights,
         const std::unordered_map<std::string, ngraph::OpSet>& opsets,
         std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>>& variables)
-        : node(node), weights(weights), opsets(opsets), variables(variables) {}
+        : node(node), data(node.child("data")), weights(weights), opsets(opsets), variables(variables) {}
 
     void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& value) override {
         std::string val;
-        if (!getStrAttribute(node.child("data"), name, val)) return;
+        if (!getStrAttribute(data, name, val)) return;
         value.set(val);
     }
     void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& value) override {
         std::string val;
-        if (!getStrAttribute(node.child("data"), name, val)) return;
+        if (!getStrAttribute(data, name, val)) return;
         std::transform(val.begin(), val.end(), val.begin(), [](char ch) {
             return std::tolower(static_cast<unsigned char>(ch));
         });
-        std::set<std::string> true_names{"true", "1"};
-        std::set<std::string> false_names{"false", "0"};
 
-        bool is_true = true_names.find(val) != true_names.end();
-        bool is_false = false_names.find(val) != false_names.end();
+        bool is_true = val == "true" || val == "1";
+        bool is_false = val == "false" || val == "0";
 
         if (!is_true && !is_false) return;
         value.set(is_true);
@@ -126,12 +202,12 @@ public:
 
     void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
         std::string val;
-        if (!getStrAttribute(node.child("data"), name, val)) return;
+        if (!getStrAttribute(data, name, val)) return;
         adapter.set(stringToType<double>(val));
     }
     void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
         std::string val;
-        if (!getStrAttribute(node.child("data"), name, val)) return;
+        if (!getStrAttribute(data, name, val)) return;
         adapter.set(stringToType<int64_t>(val));
     }
 
@@ -142,21 +218,21 @@ public:
     void on_adapter(
         const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
         std::vector<int32_t> value;
-        if (!getParameters<int32_t>(node.child("data"), name, value)) return;
+        if (!getParameters<int32_t>(data, name, value)) return;
         adapter.set(value);
     }
 
     void on_adapter(
         const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
         std::vector<int64_t> value;
-        if (!getParameters<int64_t>(node.child("data"), name, value)) return;
+        if (!getParameters<int64_t>(data, name, value)) return;
         adapter.set(value);
     }
 
     void on_adapter(
         const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
         std::vector<float> value;
-        if (!getParameters<float>(node.child("data"), name, value)) return;
+        if (!getParameters<float>(data, name, value)) return;
         adapter.set(value);
     }
 
@@ -164,7 +240,7 @@ public:
         const std::string& name,
         ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
         std::vector<std::string> value;
-        if (!getParameters<std::string>(node.child("data"), name, value)) return;
+        if (!getParameters<std::string>(data, name, value)) return;
         adapter.set(value);
     }
 
@@ -205,14 +281,32 @@ private:
 
     V10Parser::GenericLayerParams parseGenericParams(const pugi::xml_node& node);
 
+    /// \brief Operation created from an opset with the attributes read, but not connected to inputs yet
+    struct PreparedNode {
+        std::shared_ptr<ngraph::Node> node;
+        bool visited = false;
+    };
+
+    /// \brief Returns true if the operation does not touch the state shared between layers
+    /// (variables, io map of the sub-graph bodies), so it can be prepared on any thread.
+    bool canPrepareInParallel(const pugi::xml_node& node, const V10Parser::GenericLayerParams& params) const;
+
+    PreparedNode prepareNode(
+        const pugi::xml_node& node,
+        const Blob::CPtr& weights,
+        const V10Parser::GenericLayerParams& params);
+
     std::shared_ptr<ngraph::Node> createNode(
         const ngraph::OutputVector& inputs,
         const pugi::xml_node& node,
         const Blob::CPtr& weights,
-        const V10Parser::GenericLayerParams& params);
+        const V10Parser::GenericLayerParams& params,
+        PreparedNode prepared);
 
     // -- DATA --
     const pugi::xml_node node;
+    // <data> child of the node, looked up once as every attribute is read from it
+    const pugi::xml_node data;
     const Blob::CPtr& weights;
     const std::unordered_map<std::string, ngraph::OpSet>& opsets;
     std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>>& variables;
@@ -431,56 +525,56 @@ void XmlDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<
         }
     }
 
-    if (skip_names.count(name) && !getStrAttribute(node.child("data"), name, val)) return;
+    if (skip_names.count(name) && !getStrAttribute(data, name, val)) return;
     if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::element::Type>>(&adapter)) {
         static_cast<ngraph::element::Type&>(*a) = details::convertPrecision(val);
     } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::PartialShape>>(&adapter)) {
         std::vector<int64_t> shape;
         std::vector<ngraph::Dimension> dims;
-        if (!getParameters<int64_t>(node.child("data"), name, shape)) return;
+        if (!getParameters<int64_t>(data, name, shape)) return;
         for (const auto& dim : shape) dims.emplace_back(dim);
         static_cast<ngraph::PartialShape&>(*a) = ngraph::PartialShape(dims);
     } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::Shape>>(&adapter)) {
         std::vector<size_t> shape;
-        if (!getParameters<size_t>(node.child("data"), name, shape)) return;
+        if (!getParameters<size_t>(data, name, shape)) return;
         static_cast<ngraph::Shape&>(*a) = ngraph::Shape(shape);
     } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::Strides>>(&adapter)) {
         std::vector<size_t> shape;
-        if (!getParameters<size_t>(node.child("data"), name, shape)) return;
+        if (!getParameters<size_t>(data, name, shape)) return;
         static_cast<ngraph::Strides&>(*a) = ngraph::Strides(shape);
 #ifdef __APPLE__
     } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::vector<size_t>>>(&adapter)) {
         std::vector<size_t> result;
-        if (!getParameters<size_t>(node.child("data"), name, result)) return;
+        if (!getParameters<size_t>(data, name, result)) return;
         static_cast<std::vector<size_t>&>(*a) = result;
 #else
     } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::vector<size_t>>>(&adapter)) {
         std::vector<size_t> result;
-        if (!getParameters<size_t>(node.child("data"), name, result)) return;
+        if (!getParameters<size_t>(data, name, result)) return;
         a->set(result);
 #endif
     } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::AxisSet>>(&adapter)) {
         std::vector<size_t> axes;
-        if (!getParameters<size_t>(node.child("data"), name, axes)) return;
+        if (!getParameters<size_t>(data, name, axes)) return;
         static_cast<ngraph::AxisSet&>(*a) = ngraph::AxisSet(axes);
     } else if (
         auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::TopKSortType>>(&adapter)) {
-        if (!getStrAttribute(node.child("data"), name, val)) return;
+        if (!getStrAttribute(data, name, val)) return;
         static_cast<ngraph::op::TopKSortType&>(*a) = ngraph::as_enum<ngraph::op::TopKSortType>(val);
     } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::TopKMode>>(&adapter)) {
-        if (!getStrAttribute(node.child("data"), name, val)) return;
+        if (!getStrAttribute(data, name, val)) return;
         static_cast<ngraph::op::TopKMode&>(*a) = ngraph::as_enum<ngraph::op::TopKMode>(val);
     } else if (
         auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::CoordinateDiff>>(&adapter)) {
         std::vector<size_t> shape;
-        if (!getParameters<size_t>(node.child("data"), name, shape)) return;
+        if (!getParameters<size_t>(data, name, shape)) return;
         std::vector<std::ptrdiff_t> coord_diff(shape.begin(), shape.end());
         static_cast<ngraph::CoordinateDiff&>(*a) = ngraph::CoordinateDiff(coord_diff);
     } else if (
         auto a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(
             &adapter)) {
         std::string variable_id;
-        if (!getStrAttribute(node.child("data"), name, variable_id)) return;
+        if (!getStrAttribute(data, name, variable_id)) return;
         if (!variables.count(variable_id)) {
             variables[variable_id] = std::make_shared<ngraph::Variable>(ngraph::VariableInfo{
                 ngraph::PartialShape::dynamic(), ngraph::element::dynamic, variable_id});
@@ -490,7 +584,7 @@ void XmlDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<
         auto a = ngraph::as_type<
             ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
         std::string value;
-        pugi::xml_node dn = node.child("data");
+        pugi::xml_node dn = data;
         auto type = XMLParseUtils::GetStrAttr(node, "type");
 
         if (dn.empty()) IE_THROW() << "No attrtibutes defined for " << type << " op!";
@@ -534,7 +628,7 @@ void XmlDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<
         node_attrs.set_opset_name(version);
         node_attrs.set_type_name(type);
 
-        pugi::xml_node dn = node.child("data");
+        pugi::xml_node dn = data;
 
         if (!dn.empty()) {
             for (const auto & data_attr : dn.attributes()) {
@@ -590,16 +684,25 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::vector<size_t/*layer-id*/> outputs;
     std::unordered_set<std::string> opName;
 
-    // Read all layers and store their parameters in params map
+    // Read all layers and store their parameters in params map.
+    // Layers are independent here, so their generic parameters are read in parallel
+    std::vector<pugi::xml_node> layers;
     FOREACH_CHILD(node, root.child("layers"), "layer") {
-        auto node_param = parseGenericParams(node);
+        layers.push_back(node);
+    }
+    std::vector<V10Parser::GenericLayerParams> layers_params(layers.size());
+    parallelForEachLayer(layers.size(), [&](size_t i) {
+        layers_params[i] = parseGenericParams(layers[i]);
+    });
+    for (size_t i = 0; i < layers.size(); i++) {
+        auto& node_param = layers_params[i];
         if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
             IE_THROW() << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
+        params[node_param.layerId] = {layers[i], std::move(node_param)};
     }
 
     std::map<size_t/*to-layer-id*/, std::vector<edge>> edges;
@@ -627,6 +730,19 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     };
     std::for_each(outputs.begin(), outputs.end(), dfs);
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "PrepareNgraphNodes");
+
+    // Operations are created and their attributes (including constant blobs) are read in parallel,
+    // as this does not depend on the inputs. Only connecting the nodes follows the topological order.
+    // Errors of the preparation are re-thrown when the layer is reached in that order, as in sequential parsing.
+    std::vector<PreparedNode> prepared(order.size());
+    auto prepareErrors = parallelForEachLayerCollectErrors(order.size(), [&](size_t i) {
+        // the map must not be modified concurrently, missing layers are reported below
+        auto p = params.find(order[i]);
+        if (p != params.end() && canPrepareInParallel(p->second.xml, p->second.params))
+            prepared[i] = prepareNode(p->second.xml, weights, p->second.params);
+    });
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConstructNgraphNodes");
 
     FunctionNodes func_nodes;
@@ -634,7 +750,8 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
 
     //  Following topological order create nGraph operations
-    for (auto& layer_id : order) {
+    for (size_t order_id = 0; order_id < order.size(); order_id++) {
+        auto layer_id = order[order_id];
         auto& p = params[layer_id];
         ngraph::OutputVector inputs(edges[layer_id].size());
         for (auto& e : edges[layer_id]) {
@@ -652,7 +769,9 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
                 input_node->output(p_output.getRealOutputPortId(e.fromPortId));
         }
 
-        auto node = createNode(inputs, p.xml, weights, p.params);
+        if (prepareErrors[order_id])
+            std::rethrow_exception(prepareErrors[order_id]);
+        auto node = createNode(inputs, p.xml, weights, p.params, prepared[order_id]);
         id_to_node[layer_id] = node;
 
         // Check that output shape after nGraph node validation the same as in IR
@@ -772,24 +891,18 @@ V10Parser::V10Parser::GenericLayerParams XmlDeserializer::parseGenericParams(
     return params;
 }
 
-std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
-    const std::vector<ngraph::Output<ngraph::Node>>& inputs,
+bool XmlDeserializer::canPrepareInParallel(const pugi::xml_node& node, const V10Parser::GenericLayerParams& params) const {
+    // only the operations of the default opsets are known to be safe to create concurrently
+    if (params.version.compare(0, 5, "opset") != 0 || !opsets.count(params.version))
+        return false;
+    return params.type != "ReadValue" && params.type != "Assign" && node.child("body").empty();
+}
+
+XmlDeserializer::PreparedNode XmlDeserializer::prepareNode(
     const pugi::xml_node& node,
     const Blob::CPtr& weights,
     const V10Parser::GenericLayerParams& params) {
-    // Check that inputs are correctly defined
-    for (size_t i = 0; i < inputs.size(); i++) {
-        if (!inputs[i].get_node())
-            IE_THROW() << params.type << " layer " << params.name
-                               << " with id: " << params.layerId
-                               << " has incorrect input with index " << i << "!";
-        if (ngraph::element::Type_t::undefined == inputs[i].get_element_type())
-            IE_THROW() << params.type << " layer " << params.name
-                               << " with id: " << params.layerId
-                               << " has undefined element type for input with index " << i << "!";
-    }
-
-    std::shared_ptr<ngraph::Node> ngraphNode;
+    PreparedNode prepared;
 
     // Find registered opset
     auto opsetIt = opsets.find(params.version);
@@ -810,7 +923,7 @@ std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
         opsetIt = opsets.find("opset6");
     }
 
-    if (!ngraphNode && opsetIt != opsets.end()) {
+    if (opsetIt != opsets.end()) {
         auto const& type = params.type == "Const" ? "Constant" : params.type;
 
         if (params.version == "opset1") {
@@ -827,18 +940,46 @@ std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
 
         auto const& opset = opsetIt->second;
 
-        ngraphNode = std::shared_ptr<ngraph::Node>(opset.create_insensitive(type));
-        if (!ngraphNode) {
+        prepared.node = std::shared_ptr<ngraph::Node>(opset.create_insensitive(type));
+        if (!prepared.node) {
             IE_THROW() << "Opset " << params.version
                                << " doesn't contain the operation with type: " << type;
         }
         // Share Weights form constant blob
-        if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(ngraphNode)) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(prepared.node)) {
             constant->alloc_buffer_on_visit_attributes(false);
         }
-        ngraphNode->set_arguments(inputs);
         XmlDeserializer visitor(node, weights, opsets, variables);
-        if (ngraphNode->visit_attributes(visitor)) {
+        prepared.visited = prepared.node->visit_attributes(visitor);
+    }
+    return prepared;
+}
+
+std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
+    const std::vector<ngraph::Output<ngraph::Node>>& inputs,
+    const pugi::xml_node& node,
+    const Blob::CPtr& weights,
+    const V10Parser::GenericLayerParams& params,
+    PreparedNode prepared) {
+    // Check that inputs are correctly defined
+    for (size_t i = 0; i < inputs.size(); i++) {
+        if (!inputs[i].get_node())
+            IE_THROW() << params.type << " layer " << params.name
+                               << " with id: " << params.layerId
+                               << " has incorrect input with index " << i << "!";
+        if (ngraph::element::Type_t::undefined == inputs[i].get_element_type())
+            IE_THROW() << params.type << " layer " << params.name
+                               << " with id: " << params.layerId
+                               << " has undefined element type for input with index " << i << "!";
+    }
+
+    if (!prepared.node)
+        prepared = prepareNode(node, weights, params);
+    std::shared_ptr<ngraph::Node> ngraphNode = prepared.node;
+
+    if (ngraphNode) {
+        ngraphNode->set_arguments(inputs);
+        if (prepared.visited) {
             ngraphNode->constructor_validate_and_infer_types();
         }
 
@@ -68,6 +68,11 @@ class NGRAPH_API ConvertPrecision;
  *     GreaterEqual
  *     Less
  *     LessEqual
+ *
+ * With keep_decompressed_constants option floating point Constants consumed only by Convert operations keep
+ * their precision, only the destination type of the Converts is changed. So a plugin can store such Constants
+ * compressed and expand them at runtime. The Converts have to be excluded from constant folding, otherwise
+ * they are folded later and the option has no effect.
  */
 
 using type_to_fuse_map = std::unordered_map<ngraph::NodeTypeInfo, std::function<bool(const std::shared_ptr<ngraph::Node>&, ngraph::element::Type, size_t idx)>>;
@@ -81,13 +86,16 @@ public:
         m_precisions(precisions_array {{ from, to }}),
         m_additional_type_to_fuse_map(additional_type_to_fuse_map) {}
 
-    ConvertPrecision(const precisions_array& precisions, const type_to_fuse_map & additional_type_to_fuse_map = {})
+    ConvertPrecision(const precisions_array& precisions, const type_to_fuse_map & additional_type_to_fuse_map = {},
+                     bool keep_decompressed_constants = false)
         : FunctionPass(),
         m_precisions(precisions),
-        m_additional_type_to_fuse_map(additional_type_to_fuse_map) {}
+        m_additional_type_to_fuse_map(additional_type_to_fuse_map),
+        m_keep_decompressed_constants(keep_decompressed_constants) {}
 
     bool run_on_function(std::shared_ptr<Function> f) override;
 private:
     precisions_array m_precisions;
     type_to_fuse_map m_additional_type_to_fuse_map;
+    bool m_keep_decompressed_constants = false;
 };
@@ -26,6 +26,8 @@ class TRANSFORMATIONS_API Serialize;
  * - order of generated layers in xml file is ngraph specific (given by
  * get_ordered_ops()); MO generates file with different order, but they are
  * logically equivalent
+ * - layers are written to the xml output as soon as they are serialized, so
+ * the output may be partial if the serialization throws
  */
 class ngraph::pass::Serialize : public ngraph::pass::FunctionPass {
 public:
@@ -33,14 +35,30 @@ public:
     NGRAPH_RTTI_DECLARATION;
     bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
+    /**
+     * @brief Writes IR to the streams. If the serialization throws, the streams may keep
+     * a part of the xml and bin data written before the failure, it is up to the caller
+     * to discard them
+     */
     Serialize(std::ostream & xmlFile, std::ostream & binFile,
               Version version = Version::IR_V10,
               std::map<std::string, ngraph::OpSet> custom_opsets = {});
 
+    /**
+     * @brief Writes IR to the files, the files are removed if the serialization throws
+     */
     Serialize(const std::string& xmlPath, const std::string& binPath,
               Version version = Version::IR_V10,
               std::map<std::string, ngraph::OpSet> custom_opsets = {});
 
+    /**
+     * @brief Returns the number of bytes not written to the bin file by the last run,
+     * since the same constant data was already written
+     */
+    size_t get_deduplicated_bytes() const {
+        return m_deduplicated_bytes;
+    }
+
 private:
     std::ostream * m_xmlFile;
     std::ostream * m_binFile;
@@ -48,4 +66,5 @@ private:
     const std::string m_binPath;
     const Version m_version;
     const std::map<std::string, ngraph::OpSet> m_custom_opsets;
+    size_t m_deduplicated_bytes = 0;
 };
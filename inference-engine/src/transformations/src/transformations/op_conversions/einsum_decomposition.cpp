@@ -632,7 +632,7 @@ ngraph::pass::EinsumDecomposition::EinsumDecomposition() {
     auto einsum = ngraph::pattern::wrap_type<opset7::Einsum>();
     ngraph::matcher_pass_callback callback = [this](ngraph::pattern::Matcher& m) {
         auto einsum_node = std::dynamic_pointer_cast<ngraph::opset7::Einsum>(m.get_match_root());
-        if (!einsum_node) {
+        if (!einsum_node || transformation_callback(einsum_node)) {
             return false;
         }
 
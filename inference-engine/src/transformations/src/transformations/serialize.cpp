@@ -80,45 +80,61 @@ class ConstantWriter {
 public:
     using FilePosition = int64_t;
     using HashValue = size_t;
-    using ConstWritePositions = std::unordered_map<HashValue, FilePosition>;
 
     ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
         : m_binary_output(bin_data)
+        , m_offset(bin_data.tellp())
         , m_enable_compression(enable_compression) {
     }
 
     FilePosition write(const char* ptr, size_t size) {
-        const auto offset = m_binary_output.tellp();
+        const auto offset = m_offset;
         if (!m_enable_compression) {
             m_binary_output.write(ptr, size);
+            m_offset += size;
             return offset;
         }
-        // The biggest supported models have at maximum 1-2 thousand constant nodes,
-        // with 64 bit hash that gives a probability around 1 in 10 trillion that a
-        // hash collision will appear. Because of this, a choice has been made to
-        // not perform collision detection and keep the hashing quick and seamless.
+        // The constants data stays alive during the serialization, so the buffers with
+        // the same hash are compared by content and a hash collision can't merge
+        // different constants.
         const HashValue hash = hash_combine(ptr, size);
-        const auto found = m_hash_to_file_positions.find(hash);
-        if (found != end(m_hash_to_file_positions)) {
-            return found->second;
+        auto& candidates = m_hash_to_constants[hash];
+        for (const auto& written : candidates) {
+            if (written.size == size && std::memcmp(written.ptr, ptr, size) == 0) {
+                m_deduplicated_bytes += size;
+                return written.offset;
+            }
         }
 
         m_binary_output.write(ptr, size);
-        m_hash_to_file_positions.insert({hash, offset});
+        m_offset += size;
+        candidates.push_back({ptr, size, offset});
 
         return offset;
     }
 
+    size_t get_deduplicated_bytes() const {
+        return m_deduplicated_bytes;
+    }
+
 private:
-    ConstWritePositions m_hash_to_file_positions;
+    struct WrittenConstant {
+        const char* ptr;
+        size_t size;
+        FilePosition offset;
+    };
+    std::unordered_map<HashValue, std::vector<WrittenConstant>> m_hash_to_constants;
     std::ostream& m_binary_output;
+    FilePosition m_offset;
+    size_t m_deduplicated_bytes = 0;
     bool m_enable_compression;
 };
 
 void ngfunction_2_irv10(pugi::xml_node& node,
                         const ngraph::Function& f,
                         const std::map<std::string, ngraph::OpSet>& custom_opsets,
-                        ConstantWriter& constant_write_handler);
+                        ConstantWriter& constant_write_handler,
+                        std::ostream* xml_stream = nullptr);
 
 // Some of the operators were added to wrong opsets. This is a mapping
 // that allows such operators to be serialized with proper opsets.
@@ -667,13 +683,42 @@ bool resolve_dynamic_shapes(const ngraph::Function& f) {
     return true;
 }
 
+// escapes the attribute value the same way as pugixml does
+std::string escape_xml_attribute(const std::string& value) {
+    std::string escaped;
+    for (const char c : value) {
+        switch (c) {
+        case '&': escaped += "&amp;"; break;
+        case '<': escaped += "&lt;"; break;
+        case '>': escaped += "&gt;"; break;
+        case '"': escaped += "&quot;"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 32 && c != '\t') {
+                escaped += "&#" + std::to_string(c / 10) + std::to_string(c % 10) + ";";
+            } else {
+                escaped += c;
+            }
+        }
+    }
+    return escaped;
+}
+
+// If xml_stream is provided, the layers are written to it one by one as soon as they are
+// serialized, so the document never holds the whole network. The output is the same as
+// printing the whole document.
 void ngfunction_2_irv10(pugi::xml_node& netXml,
                         const ngraph::Function& f,
                         const std::map<std::string, ngraph::OpSet>& custom_opsets,
-                        ConstantWriter& constant_node_write_handler) {
+                        ConstantWriter& constant_node_write_handler,
+                        std::ostream* xml_stream) {
     netXml.append_attribute("name").set_value(f.get_friendly_name().c_str());
     netXml.append_attribute("version").set_value("10");
     pugi::xml_node layers = netXml.append_child("layers");
+    if (xml_stream) {
+        *xml_stream << "<?xml version=\"1.0\"?>\n<" << netXml.name()
+                    << " name=\"" << escape_xml_attribute(f.get_friendly_name())
+                    << "\" version=\"10\">\n\t<layers>\n";
+    }
 
     const std::unordered_map<ngraph::Node*, int> layer_ids =
         create_layer_ids(f);
@@ -779,10 +824,16 @@ void ngfunction_2_irv10(pugi::xml_node& netXml,
                 layer.insert_move_after(output, layer.first_child());
             }
         }
+
+        if (xml_stream) {
+            layer.print(*xml_stream, "\t", pugi::format_indent, pugi::encoding_auto, 2);
+            layers.remove_child(layer);
+        }
     }
     // <edges>
     const std::vector<Edge> edge_mapping = create_edge_mapping(layer_ids, f);
     pugi::xml_node edges = netXml.append_child("edges");
+    bool has_edges = false;
     for (auto e : edge_mapping) {
         // WA for LSTMCellv0, peephole input shall not be serialized
         if (e.to_port == 6) {
@@ -791,12 +842,22 @@ void ngfunction_2_irv10(pugi::xml_node& netXml,
                 continue;
             }
         }
+        if (xml_stream) {
+            *xml_stream << (has_edges ? "" : "\t</layers>\n\t<edges>\n")
+                        << "\t\t<edge from-layer=\"" << e.from_layer << "\" from-port=\"" << e.from_port
+                        << "\" to-layer=\"" << e.to_layer << "\" to-port=\"" << e.to_port << "\" />\n";
+            has_edges = true;
+            continue;
+        }
         pugi::xml_node edge = edges.append_child("edge");
         edge.append_attribute("from-layer").set_value(e.from_layer);
         edge.append_attribute("from-port").set_value(e.from_port);
         edge.append_attribute("to-layer").set_value(e.to_layer);
         edge.append_attribute("to-port").set_value(e.to_port);
     }
+    if (xml_stream) {
+        *xml_stream << (has_edges ? "\t</edges>\n" : "\t</layers>\n\t<edges />\n") << "</" << netXml.name() << ">\n";
+    }
     // move back dynamic shapes
     if (has_dynamic_shapes) {
         f.validate_nodes_and_infer_types();
@@ -817,12 +878,11 @@ bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
                 pugi::xml_document xml_doc;
                 pugi::xml_node net_node = xml_doc.append_child(name.c_str());
                 ConstantWriter constant_write_handler(bin_file);
-                XmlSerializer visitor(net_node, name, m_custom_opsets, constant_write_handler);
-                visitor.on_attribute(name, f);
+                ngfunction_2_irv10(net_node, *f, m_custom_opsets, constant_write_handler, &xml_file);
 
-                xml_doc.save(xml_file);
                 xml_file.flush();
                 bin_file.flush();
+                m_deduplicated_bytes = constant_write_handler.get_deduplicated_bytes();
             }
             break;
         default:
@@ -834,19 +894,29 @@ bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
     if (m_xmlFile && m_binFile) {
         serializeFunc(*m_xmlFile, *m_binFile);
     } else {
-        std::ofstream bin_file(m_binPath, std::ios::out | std::ios::binary);
+        // the layers and the small constants are written by many small chunks
+        constexpr size_t file_buffer_size = 4 * 1024 * 1024;
+        std::vector<char> bin_buffer(file_buffer_size);
+        std::vector<char> xml_buffer(file_buffer_size);
+
+        std::ofstream bin_file;
+        bin_file.rdbuf()->pubsetbuf(bin_buffer.data(), bin_buffer.size());
+        bin_file.open(m_binPath, std::ios::out | std::ios::binary);
         NGRAPH_CHECK(bin_file, "Can't open bin file: \"" + m_binPath + "\"");
 
         // create xml file
-        std::ofstream xml_file(m_xmlPath, std::ios::out);
+        std::ofstream xml_file;
+        xml_file.rdbuf()->pubsetbuf(xml_buffer.data(), xml_buffer.size());
+        xml_file.open(m_xmlPath, std::ios::out);
         NGRAPH_CHECK(xml_file, "Can't open xml file: \"" + m_xmlPath + "\"");
 
         try {
             serializeFunc(xml_file, bin_file);
-        } catch (const ngraph::CheckFailure& e) {
+        } catch (...) {
             // optimization decission was made to create .bin file upfront and
             // write to it directly instead of buffering its content in memory,
-            // hence we need to delete it here in case of failure
+            // the layers are streamed to .xml file as well, hence we need to
+            // delete both here in case of failure
             xml_file.close();
             bin_file.close();
             std::remove(m_xmlPath.c_str());
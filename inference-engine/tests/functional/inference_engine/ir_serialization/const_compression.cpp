@@ -229,3 +229,27 @@ TEST_F(SerializatioConstantCompressionTest, IdenticalConstantsDifferentTypesI32I
 
     ASSERT_TRUE(file_size(bin_1) == unique_const_count * ngraph::shape_size(shape) * sizeof(int32_t));
 }
+
+TEST_F(SerializatioConstantCompressionTest, DeduplicatedBytesReported) {
+    const ngraph::Shape shape{2, 2, 2};
+
+    auto A = ngraph::op::Constant::create(ngraph::element::i32, shape,
+        {1, 2, 3, 4, 5, 6, 7, 8});
+    auto B = ngraph::op::Constant::create(ngraph::element::i32, shape,
+        {0, 3, 1, 2, 5, 6, 25, 3});
+    auto C = ngraph::op::Constant::create(ngraph::element::i32, shape,
+        {1, 2, 3, 4, 5, 6, 7, 8});
+    auto D = ngraph::op::Constant::create(ngraph::element::i32, shape,
+        {1, 2, 3, 4, 5, 6, 7, 8});
+
+    auto ngraph_a = std::make_shared<ngraph::Function>(ngraph::NodeVector{A, B, C, D},
+        ngraph::ParameterVector{});
+
+    ngraph::pass::Serialize serialize(m_out_xml_path_1, m_out_bin_path_1);
+    serialize.run_on_function(ngraph_a);
+
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    ASSERT_EQ(file_size(bin_1), 2 * ngraph::shape_size(shape) * sizeof(int32_t));
+    ASSERT_EQ(serialize.get_deduplicated_bytes(), 2 * ngraph::shape_size(shape) * sizeof(int32_t));
+}
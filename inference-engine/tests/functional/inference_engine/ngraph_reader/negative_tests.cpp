@@ -77,3 +77,36 @@ TEST_F(NGraphReaderTests, DISABLED_ReadIncorrectNetwork) {
     Core reader;
     ASSERT_THROW(reader.ReadNetwork(model, blob), InferenceEngine::Exception);
 }
+
+TEST_F(NGraphReaderTests, ReadIncorrectVectorAttribute) {
+    std::string model = R"V0G0N(
+<net name="Network" version="10">
+    <layers>
+        <layer name="in1" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1,,3"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="1" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    Blob::CPtr blob;
+    Core reader;
+    ASSERT_THROW(reader.ReadNetwork(model, blob), InferenceEngine::Exception);
+}
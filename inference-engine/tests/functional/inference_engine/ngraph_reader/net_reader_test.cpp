@@ -9,6 +9,9 @@
 #include <gtest/gtest.h>
 
 #include <legacy/details/ie_cnn_network_tools.h>
+#include <ie_ngraph_utils.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <transformations/serialize.hpp>
 
 #include "common_test_utils/test_common.hpp"
 #include "common_test_utils/unicode_utils.hpp"
@@ -225,6 +228,69 @@ TEST(NetReaderTest, IRSupportModelDetection) {
     }
 }
 
+namespace {
+// the constants are larger than the fault-around of the mapped file pages
+const ngraph::Shape lazyWeightsShape{1, 1024, 1024};
+const size_t lazyWeightsConstantSize = ngraph::shape_size(lazyWeightsShape) * sizeof(float);
+
+void serializeLazyWeightsModel(const std::string& modelPath, const std::string& weightsPath) {
+    const auto& shape = lazyWeightsShape;
+    const size_t size = ngraph::shape_size(shape);
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+    auto add = std::make_shared<ngraph::opset1::Add>(param,
+        ngraph::opset1::Constant::create(ngraph::element::f32, shape, std::vector<float>(size, 1.f)));
+    auto multiply = std::make_shared<ngraph::opset1::Multiply>(add,
+        ngraph::opset1::Constant::create(ngraph::element::f32, shape, std::vector<float>(size, 2.f)));
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{multiply}, ngraph::ParameterVector{param});
+    ngraph::pass::Serialize(modelPath, weightsPath).run_on_function(function);
+}
+}  // namespace
+
+TEST(NetReaderTest, WeightsAreLoadedOnFirstAccess) {
+    const std::string modelPath = "NetReader_lazy_weights_test.xml";
+    const std::string weightsPath = "NetReader_lazy_weights_test.bin";
+    serializeLazyWeightsModel(modelPath, weightsPath);
+
+    // the network maps the weights file, so the file is removed after the network is destroyed
+    {
+        InferenceEngine::Core ie;
+        auto network = ie.ReadNetwork(modelPath, weightsPath);
+        EXPECT_LT(InferenceEngine::details::getResidentConstantsSize(network), lazyWeightsConstantSize);
+
+        auto add = network.getFunction()->get_result()->get_input_node_shared_ptr(0)->get_input_node_shared_ptr(0);
+        auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(add->get_input_node_shared_ptr(1));
+        ASSERT_NE(nullptr, constant);
+        const auto values = constant->cast_vector<float>();
+        EXPECT_EQ(1.f, values.back());
+
+        const size_t residentSize = InferenceEngine::details::getResidentConstantsSize(network);
+        EXPECT_GE(residentSize, lazyWeightsConstantSize);
+        EXPECT_LT(residentSize, 2 * lazyWeightsConstantSize);
+    }
+
+    CommonTestUtils::removeIRFiles(modelPath, weightsPath);
+}
+
+TEST(NetReaderTest, WeightsAreReadWhenMappingIsDisabled) {
+    const std::string modelPath = "NetReader_read_weights_test.xml";
+    const std::string weightsPath = "NetReader_read_weights_test.bin";
+    serializeLazyWeightsModel(modelPath, weightsPath);
+
+    InferenceEngine::Core ie;
+    ie.SetConfig({{CONFIG_KEY(ENABLE_MMAP), CONFIG_VALUE(NO)}});
+    auto network = ie.ReadNetwork(modelPath, weightsPath);
+    EXPECT_GE(InferenceEngine::details::getResidentConstantsSize(network), 2 * lazyWeightsConstantSize);
+
+    // the network doesn't depend on the weights file anymore
+    CommonTestUtils::removeIRFiles(modelPath, weightsPath);
+    auto add = network.getFunction()->get_result()->get_input_node_shared_ptr(0)->get_input_node_shared_ptr(0);
+    auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(add->get_input_node_shared_ptr(1));
+    ASSERT_NE(nullptr, constant);
+    EXPECT_EQ(1.f, constant->cast_vector<float>().back());
+
+    EXPECT_THROW(ie.SetConfig({{CONFIG_KEY(ENABLE_MMAP), "MAYBE"}}), InferenceEngine::Exception);
+}
+
 std::string getTestCaseName(testing::TestParamInfo<NetReaderTestParams> testParams) {
     InferenceEngine::SizeVector dims;
     InferenceEngine::Precision prc;
@@ -614,6 +614,26 @@ TEST(TransformationTests, ConvertPrecision_TypeRelaxed) {
     }
 }
 
+TEST(TransformationTests, ConvertPrecision_KeepDecompressedConstants) {
+    for (bool keep : {true, false}) {
+        auto input = std::make_shared<opset4::Parameter>(element::f16, Shape{1, 3});
+        auto weights = std::make_shared<opset4::Constant>(element::f16, Shape{1, 3}, 1);
+        auto convert = std::make_shared<opset4::Convert>(weights, element::f32);
+        auto add = std::make_shared<opset4::Add>(std::make_shared<opset4::Convert>(input, element::f32), convert);
+
+        auto f = std::make_shared<Function>(NodeVector{add}, ParameterVector{input});
+
+        pass::Manager manager;
+        manager.register_pass<ngraph::pass::ConvertPrecision>(precisions_array {{ ngraph::element::f16, ngraph::element::f32 }},
+                                                               type_to_fuse_map{}, keep);
+        manager.run_passes(f);
+
+        // the folded Constant is replaced, so check the one consumed by the decompression Convert
+        ASSERT_EQ(keep ? element::f16 : element::f32, convert->get_input_element_type(0));
+        ASSERT_EQ(keep, has_type<ngraph::element::Type_t::f16>(f));
+    }
+}
+
 TEST(TransformationTests, ConvertPrecision_Variables) {
     std::shared_ptr<ngraph::Function> f(nullptr);
     {
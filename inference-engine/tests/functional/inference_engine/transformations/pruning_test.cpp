@@ -10,6 +10,7 @@
 
 #include <ngraph/function.hpp>
 #include <ngraph/opsets/opset5.hpp>
+#include <ngraph/opsets/opset6.hpp>
 #include <pruning.hpp>
 #include <mask_attribute.hpp>
 #include <transformations/init_node_info.hpp>
@@ -280,4 +281,82 @@ TEST(TransformationTests, PropagateMasksHardDependencies) {
 //    compare_masks(*getMask(relu),     Mask({{}, {0, 1, 2, 3, 4, 5}, {}, {}}));
 //    compare_masks(*getMask(weights2), Mask({{}, {0, 1, 2, 3, 4, 5}, {}, {}}));
 //    compare_masks(*getMask(conv2),    Mask({{}, {}, {}, {}}));
-}
\ No newline at end of file
+}
+
+TEST(TransformationTests, PropagateMasksMatMul) {
+    auto input = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 8, 16});
+    auto weights1 = create_constant_with_zeros(Shape{16, 32}, {{}, {1, 2, 3}});
+    auto matmul1 = std::make_shared<opset5::MatMul>(input, weights1);
+
+    auto bias = create_constant_with_zeros(Shape{32}, {{1, 2}});
+    auto add = std::make_shared<opset5::Add>(matmul1, bias);
+    auto relu = std::make_shared<opset5::Relu>(add);
+
+    auto weights2 = opset5::Constant::create(element::f32, Shape{16, 32}, {1.});
+    auto matmul2 = std::make_shared<opset5::MatMul>(relu, weights2, false, true);
+    auto f = std::make_shared<Function>(NodeVector{matmul2}, ParameterVector{input});
+
+    pass::Manager m;
+    m.register_pass<pass::PropagateMasks>();
+    m.run_passes(f);
+
+    compare_masks(*getMask(weights1),             Mask({{}, {1, 2}}));
+    compare_masks(*getMask(matmul1->output(0)),   Mask({{}, {}, {1, 2}}));
+    compare_masks(*getMask(bias),                 Mask({{1, 2}}));
+    compare_masks(*getMask(relu->output(0)),      Mask({{}, {}, {1, 2}}));
+    compare_masks(*getMask(weights2->output(0)),  Mask({{}, {1, 2}}));
+    compare_masks(*getMask(matmul2->output(0)),   Mask({{}, {}, {}}));
+}
+
+TEST(TransformationTests, PruningMatMulReshapeTranspose) {
+    auto input = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 4, 16});
+    auto weights1 = create_constant_with_zeros(Shape{16, 8}, {{}, {2, 5}});
+    auto matmul1 = std::make_shared<opset5::MatMul>(input, weights1);
+
+    auto reshape = std::make_shared<opset5::Reshape>(matmul1, opset5::Constant::create(element::i64, Shape{2}, {4, 8}), false);
+    auto transpose1 = std::make_shared<opset5::Transpose>(reshape, opset5::Constant::create(element::i64, Shape{2}, {1, 0}));
+    auto transpose2 = std::make_shared<opset5::Transpose>(transpose1, opset5::Constant::create(element::i64, Shape{2}, {1, 0}));
+
+    auto weights2 = opset5::Constant::create(element::f32, Shape{8, 3}, {1.});
+    auto matmul2 = std::make_shared<opset5::MatMul>(transpose2, weights2);
+    auto f = std::make_shared<Function>(NodeVector{matmul2}, ParameterVector{input});
+
+    pass::Manager m;
+    m.register_pass<pass::Pruning>();
+    m.run_passes(f);
+
+    ASSERT_EQ(matmul1->get_output_shape(0), Shape({1, 4, 6}));
+    ASSERT_EQ(reshape->get_output_shape(0), Shape({4, 6}));
+    ASSERT_EQ(transpose1->get_output_shape(0), Shape({6, 4}));
+    ASSERT_EQ(matmul2->get_input_shape(1), Shape({6, 3}));
+    ASSERT_EQ(matmul2->get_output_shape(0), Shape({4, 3}));
+}
+
+TEST(TransformationTests, PropagateMasksMVN) {
+    // Normalization across sequence keeps zero channels, normalization across channels depends on them
+    for (const int64_t axis : {1, -1}) {
+        auto input = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 4, 16});
+        auto weights1 = create_constant_with_zeros(Shape{16, 8}, {{}, {2, 5}});
+        auto matmul1 = std::make_shared<opset5::MatMul>(input, weights1);
+
+        auto mvn = std::make_shared<opset6::MVN>(matmul1, opset5::Constant::create(element::i64, Shape{1}, {axis}),
+                                                 true, 1e-9, op::MVNEpsMode::INSIDE_SQRT);
+        auto weights2 = opset5::Constant::create(element::f32, Shape{8, 3}, {1.});
+        auto matmul2 = std::make_shared<opset5::MatMul>(mvn, weights2);
+        auto f = std::make_shared<Function>(NodeVector{matmul2}, ParameterVector{input});
+
+        pass::Manager m;
+        m.register_pass<pass::PropagateMasks>();
+        m.run_passes(f);
+
+        if (axis == 1) {
+            compare_masks(*getMask(weights1),             Mask({{}, {2, 5}}));
+            compare_masks(*getMask(mvn->output(0)),       Mask({{}, {}, {2, 5}}));
+            compare_masks(*getMask(weights2->output(0)),  Mask({{2, 5}, {}}));
+        } else {
+            compare_masks(*getMask(weights1),             Mask({{}, {}}));
+            compare_masks(*getMask(mvn->output(0)),       Mask({{}, {}, {}}));
+            compare_masks(*getMask(weights2->output(0)),  Mask({{}, {}}));
+        }
+    }
+}
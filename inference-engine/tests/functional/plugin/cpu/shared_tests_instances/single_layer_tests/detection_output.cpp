@@ -82,4 +82,35 @@ const auto params5Inputs = ::testing::Combine(
 
 INSTANTIATE_TEST_CASE_P(smoke_DetectionOutput5In, DetectionOutputLayerTest, params5Inputs, DetectionOutputLayerTest::getTestCaseName);
 
+/* =============== large candidate sets =============== */
+
+const auto largeSetAttributes = ::testing::Combine(
+        ::testing::Values(numClasses),
+        ::testing::Values(backgroundLabelId),
+        ::testing::Values(400),
+        ::testing::Values(std::vector<int>{200}),
+        ::testing::ValuesIn(codeType),
+        ::testing::Values(nmsThreshold),
+        ::testing::Values(confidenceThreshold),
+        ::testing::Values(false),
+        ::testing::Values(false),
+        ::testing::ValuesIn(decreaseLabelId)
+);
+
+// 8732 priors as in SSD300
+const std::vector<ParamsWhichSizeDepends> specificParamsLargeSet = {
+    ParamsWhichSizeDepends{false, true, true, 1, 1, {1, 34928}, {1, 96052}, {1, 2, 34928}, {}, {}},
+    ParamsWhichSizeDepends{false, false, true, 1, 1, {1, 384208}, {1, 96052}, {1, 2, 34928}, {}, {}}
+};
+
+const auto paramsLargeSet = ::testing::Combine(
+        largeSetAttributes,
+        ::testing::ValuesIn(specificParamsLargeSet),
+        ::testing::ValuesIn(numberBatch),
+        ::testing::Values(0.0f),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_DetectionOutputLargeSet, DetectionOutputLayerTest, paramsLargeSet, DetectionOutputLayerTest::getTestCaseName);
+
 }  // namespace
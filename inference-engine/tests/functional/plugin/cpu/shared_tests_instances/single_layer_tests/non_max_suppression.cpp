@@ -40,3 +40,24 @@ const auto nmsParams = ::testing::Combine(::testing::ValuesIn(inShapeParams),
 );
 
 INSTANTIATE_TEST_CASE_P(smoke_NmsLayerTest, NmsLayerTest, nmsParams, NmsLayerTest::getTestCaseName);
+
+const std::vector<InputShapeParams> largeSetShapeParams = {
+    InputShapeParams{1, 10000, 5},
+    InputShapeParams{2, 4000, 20}
+};
+
+const auto nmsLargeSetParams = ::testing::Combine(::testing::ValuesIn(largeSetShapeParams),
+                                                  ::testing::Combine(::testing::Values(Precision::FP32),
+                                                                     ::testing::Values(Precision::I32),
+                                                                     ::testing::Values(Precision::FP32)),
+                                                  ::testing::Values(200),
+                                                  ::testing::ValuesIn(threshold),
+                                                  ::testing::Values(0.3f),
+                                                  ::testing::ValuesIn(sigmaThreshold),
+                                                  ::testing::ValuesIn(encodType),
+                                                  ::testing::Values(true),
+                                                  ::testing::Values(element::i32),
+                                                  ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_NmsLayerTest_LargeSet, NmsLayerTest, nmsLargeSetParams, NmsLayerTest::getTestCaseName);
@@ -0,0 +1,87 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <ngraph/pass/manager.hpp>
+#include <transformations/op_conversions/einsum_decomposition.hpp>
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+using einsumParamsTuple = std::tuple<
+        std::string,                    // Equation
+        std::vector<SizeVector>>;       // Input shapes
+
+class EinsumCPULayerTest : public testing::WithParamInterface<einsumParamsTuple>,
+                           virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<einsumParamsTuple> obj) {
+        std::string equation;
+        std::vector<SizeVector> inputShapes;
+        std::tie(equation, inputShapes) = obj.param;
+
+        std::ostringstream result;
+        result << "Equation=" << equation << "_";
+        result << "IS=" << CommonTestUtils::vec2str(inputShapes);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::string equation;
+        std::vector<SizeVector> inputShapes;
+        std::tie(equation, inputShapes) = this->GetParam();
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, inputShapes);
+        auto paramOuts = ngraph::helpers::convert2OutputVector(ngraph::helpers::castOps2Nodes<ngraph::op::Parameter>(params));
+        auto einsum = std::make_shared<ngraph::opset7::Einsum>(paramOuts, equation);
+
+        function = std::make_shared<ngraph::Function>(einsum, params, "Einsum");
+    }
+
+    std::vector<std::pair<ngraph::element::Type, std::vector<std::uint8_t>>> CalculateRefs() override {
+        // the interpreter doesn't support Einsum, so the reference is computed on its decomposition
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::EinsumDecomposition>();
+        manager.run_passes(function);
+        return LayerTestsCommon::CalculateRefs();
+    }
+};
+
+TEST_P(EinsumCPULayerTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Einsum", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Transpose", 0);
+}
+
+namespace {
+
+const std::vector<einsumParamsTuple> einsumCases = {
+    {"ij,jk->ik", {{2, 3}, {3, 4}}},
+    {"ab,cb->ac", {{7, 16}, {5, 16}}},
+    {"ij->ji", {{5, 3}}},
+    {"ijk->i", {{2, 3, 4}}},
+    {"abc,bd->acd", {{2, 3, 4}, {3, 5}}},
+    {"i,j->ij", {{4}, {6}}},
+    {"ab,ab->a", {{3, 8}, {3, 8}}},
+    {"bhqd,bhkd->bhqk", {{2, 4, 8, 16}, {2, 4, 10, 16}}},
+    {"bqhd,bkhd->bhqk", {{2, 8, 4, 16}, {2, 10, 4, 16}}},
+    {"bhqk,bkhd->bqhd", {{2, 4, 8, 10}, {2, 10, 4, 16}}},
+    {"ab,bc,cd->ad", {{2, 3}, {3, 40}, {40, 5}}},
+    {"abc,cd,de->ae", {{2, 3, 4}, {4, 5}, {5, 6}}},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_Einsum, EinsumCPULayerTest,
+                        ::testing::ValuesIn(einsumCases),
+                        EinsumCPULayerTest::getTestCaseName);
+
+} // namespace
+
+} // namespace CPULayerTestsDefinitions
@@ -0,0 +1,108 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using ConvPreprocessingTestParams = std::tuple<std::vector<ptrdiff_t>,   // pads
+                                               size_t>;                  // expected number of Eltwise nodes
+
+/*  Param (mean values and scales in the pre-processing info)
+ *    |
+ *  Convolution
+ *    |
+ *   Relu
+ */
+class ConvPreprocessingTest : public testing::WithParamInterface<ConvPreprocessingTestParams>, public CPUTestsBase,
+                              virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ConvPreprocessingTestParams> obj) {
+        std::vector<ptrdiff_t> pads;
+        size_t expectedEltwiseCount;
+        std::tie(pads, expectedEltwiseCount) = obj.param;
+
+        std::ostringstream result;
+        result << "pads=" << CommonTestUtils::vec2str(pads);
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::vector<ptrdiff_t> pads;
+        std::tie(pads, expectedEltwiseCount) = this->GetParam();
+
+        function = makeFunction(pads, false);
+        refFunction = makeFunction(pads, true);
+    }
+
+    // the reference function applies the pre-processing explicitly
+    std::shared_ptr<Function> makeFunction(const std::vector<ptrdiff_t>& pads, bool withPreprocessing) const {
+        auto inputParams = builder::makeParams(element::f32, {{1, channels, 20, 20}});
+        inputParams[0]->set_friendly_name("input");
+        std::shared_ptr<Node> input = inputParams[0];
+        if (withPreprocessing) {
+            input = std::make_shared<opset1::Subtract>(input, builder::makeConstant(element::f32, {1, channels, 1, 1}, meanValues));
+            input = std::make_shared<opset1::Multiply>(input, builder::makeConstant(element::f32, {1, channels, 1, 1}, scales));
+        }
+
+        auto conv = builder::makeConvolution(input, element::f32, {3, 3}, {1, 1}, pads, pads, {1, 1}, op::PadType::EXPLICIT, 8);
+        auto relu = std::make_shared<opset1::Relu>(conv);
+
+        return std::make_shared<Function>(relu, inputParams, "ConvPreprocessing");
+    }
+
+    void ConfigureNetwork() override {
+        LayerTestsCommon::ConfigureNetwork();
+
+        auto& preProcess = cnnNetwork.getInputsInfo().begin()->second->getPreProcess();
+        preProcess.init(channels);
+        for (size_t c = 0; c < channels; c++) {
+            preProcess[c]->meanValue = meanValues[c];
+            preProcess[c]->stdScale = scales[c];
+        }
+        preProcess.setVariant(MEAN_VALUE);
+    }
+
+    std::vector<std::pair<element::Type, std::vector<std::uint8_t>>> CalculateRefs() override {
+        std::swap(function, refFunction);
+        auto refs = LayerTestsCommon::CalculateRefs();
+        std::swap(function, refFunction);
+        return refs;
+    }
+
+    const size_t channels = 3;
+    const std::vector<float> meanValues = {5.f, -3.f, 1.5f};
+    const std::vector<float> scales = {0.5f, 2.f, 0.25f};
+    std::shared_ptr<Function> refFunction;
+    size_t expectedEltwiseCount = 0;
+};
+
+TEST_P(ConvPreprocessingTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Convolution", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Eltwise", expectedEltwiseCount);
+}
+
+namespace {
+
+// without padding both the mean and the scale are folded into the convolution,
+// otherwise the mean stays in the graph as a per channel shift of the input
+INSTANTIATE_TEST_CASE_P(smoke_ConvPreprocessing, ConvPreprocessingTest,
+                        ::testing::Values(ConvPreprocessingTestParams{{0, 0}, 0},
+                                          ConvPreprocessingTestParams{{1, 1}, 1}),
+                        ConvPreprocessingTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
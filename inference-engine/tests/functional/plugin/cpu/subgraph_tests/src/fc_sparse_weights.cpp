@@ -0,0 +1,122 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <cpu/cpu_config.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using FCSparseWeightsTestParams = std::tuple<std::pair<SizeVector, SizeVector>, // IS data, IS weights
+                                             std::string,                       // sparse weights decompression rate
+                                             bool>;                             // sparse kernel is expected
+
+/*  Param  Const(f32, only every 4th row is nonzero)
+ *      \      /
+ *       MatMul
+ *         |
+ *        Add <- bias
+ */
+class FCSparseWeightsTest : public testing::WithParamInterface<FCSparseWeightsTestParams>, public CPUTestsBase,
+                            virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCSparseWeightsTestParams> obj) {
+        std::pair<SizeVector, SizeVector> inputShapes;
+        std::string rate;
+        bool expectSparse;
+        std::tie(inputShapes, rate, expectSparse) = obj.param;
+
+        std::ostringstream result;
+        result << "IS_data=" << CommonTestUtils::vec2str(inputShapes.first) << "_";
+        result << "IS_wei=" << CommonTestUtils::vec2str(inputShapes.second) << "_";
+        result << "rate=" << rate;
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::pair<SizeVector, SizeVector> inputShapes;
+        std::string rate;
+        std::tie(inputShapes, rate, expectSparse) = this->GetParam();
+        configuration.insert({CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE, rate});
+
+        const auto& isB = inputShapes.second;
+        std::vector<float> weightsData(shape_size(isB));
+        for (size_t k = 0; k < isB[0]; k++) {
+            for (size_t n = 0; n < isB[1]; n++)
+                weightsData[k * isB[1] + n] = k % 4 == 0 ? static_cast<float>((k + n) % 7) - 3.f : 0.f;
+        }
+
+        auto inputParams = builder::makeParams(element::f32, {inputShapes.first});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+        auto weights = builder::makeConstant(element::f32, isB, weightsData);
+        auto matMul = builder::makeMatMul(paramOuts[0], weights, false, false);
+        auto bias = builder::makeConstant<float>(element::f32, {1, isB[1]}, {}, true);
+        auto add = std::make_shared<opset1::Add>(matMul, bias);
+
+        function = std::make_shared<Function>(add, inputParams, "FCSparseWeights");
+    }
+
+    void CheckSparseImplementation() {
+        auto execGraph = executableNetwork.GetExecGraphInfo().getFunction();
+        ASSERT_NE(nullptr, execGraph);
+        bool isNodeFound = false;
+        for (const auto &node : execGraph->get_ops()) {
+            const auto & rtInfo = node->get_rt_info();
+            auto getExecValue = [&rtInfo](const std::string & paramName) -> std::string {
+                auto it = rtInfo.find(paramName);
+                IE_ASSERT(rtInfo.end() != it);
+                auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+                IE_ASSERT(nullptr != value);
+                return value->get();
+            };
+
+            if (getExecValue(ExecGraphInfoSerialization::LAYER_TYPE) == "FullyConnected") {
+                isNodeFound = true;
+                const auto implType = getExecValue(ExecGraphInfoSerialization::IMPL_TYPE);
+                ASSERT_EQ(expectSparse, implType.find("sparse") != std::string::npos) << "Unexpected implementation " << implType;
+            }
+        }
+        ASSERT_TRUE(isNodeFound) << "Node type name: \"FullyConnected\" has not been found.";
+    }
+
+    bool expectSparse = false;
+};
+
+TEST_P(FCSparseWeightsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckSparseImplementation();
+}
+
+namespace {
+
+const std::vector<std::pair<SizeVector, SizeVector>> inputShapes = {
+    {{1, 128}, {128, 64}},
+    {{13, 96}, {96, 37}},
+    {{2, 5, 64}, {64, 48}},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_FCSparseWeights, FCSparseWeightsTest,
+                        ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                           ::testing::Values("0.5"),
+                                           ::testing::Values(true)),
+                        FCSparseWeightsTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_FCDenseWeights, FCSparseWeightsTest,
+                        ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                           ::testing::Values("0.8", "1"),
+                                           ::testing::Values(false)),
+                        FCSparseWeightsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,202 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <cpu/cpu_config.hpp>
+#include <numeric>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using FCWeightsDecompressionTestParams = std::tuple<std::pair<SizeVector, SizeVector>, // IS data, IS weights
+                                                    element::Type,                     // weights precision
+                                                    bool,                              // transpose B
+                                                    bool,                              // with zero point
+                                                    size_t>;                           // decompression max rows
+
+/*  Const(u8/i8)
+ *       |
+ *    Convert
+ *       |
+ *   [Subtract] <- zero point
+ *       |
+ *   Multiply <- scale
+ *       |
+ *     MatMul
+ *       |
+ *     Relu
+ */
+class FCWeightsDecompressionTest : public testing::WithParamInterface<FCWeightsDecompressionTestParams>, public CPUTestsBase,
+                                   virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCWeightsDecompressionTestParams> obj) {
+        std::pair<SizeVector, SizeVector> inputShapes;
+        element::Type weiPrc;
+        bool transpB, withZP;
+        size_t maxRows;
+        std::tie(inputShapes, weiPrc, transpB, withZP, maxRows) = obj.param;
+
+        std::ostringstream result;
+        result << "IS_data=" << CommonTestUtils::vec2str(inputShapes.first) << "_";
+        result << "IS_wei=" << CommonTestUtils::vec2str(inputShapes.second) << "_";
+        result << "WeiPrc=" << weiPrc << "_";
+        result << "Transp_B=" << transpB << "_";
+        result << "ZP=" << withZP << "_";
+        result << "MaxRows=" << maxRows;
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::pair<SizeVector, SizeVector> inputShapes;
+        element::Type weiPrc;
+        bool transpB, withZP;
+        size_t maxRows;
+        std::tie(inputShapes, weiPrc, transpB, withZP, maxRows) = this->GetParam();
+        configuration.insert({CPUConfigParams::KEY_CPU_INT8_WEIGHTS_DECOMPRESSION_MAX_ROWS, std::to_string(maxRows)});
+
+        // the weights are decompressed in the kernel only for a few source rows
+        const size_t rows = std::accumulate(inputShapes.first.begin(), inputShapes.first.end() - 1, size_t(1), std::multiplies<size_t>());
+        withDecompression = rows <= maxRows;
+
+        SizeVector isB = inputShapes.second;
+        const size_t OC = isB.back();
+        if (transpB) {
+            std::swap(*(isB.end() - 1), *(isB.end() - 2));
+        }
+        const Shape perChannelShape = transpB ? Shape{OC, 1} : Shape{1, OC};
+
+        auto inputParams = builder::makeParams(element::f32, {inputShapes.first});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto weights = builder::makeConstant<int8_t>(weiPrc, isB, {}, true, 7, weiPrc == element::u8 ? 0 : -7);
+        std::shared_ptr<Node> decompressed = std::make_shared<opset1::Convert>(weights, element::f32);
+        if (withZP) {
+            auto zp = builder::makeConstant<float>(element::f32, perChannelShape, {}, true, 3, 1);
+            decompressed = std::make_shared<opset1::Subtract>(decompressed, zp);
+        }
+        auto scale = builder::makeConstant<float>(element::f32, perChannelShape, {}, true, 1, 0.01f);
+        decompressed = std::make_shared<opset1::Multiply>(decompressed, scale);
+
+        auto matMul = builder::makeMatMul(paramOuts[0], decompressed, false, transpB);
+        auto relu = std::make_shared<opset1::Relu>(matMul);
+
+        function = std::make_shared<Function>(relu, inputParams, "FCWeightsDecompression");
+    }
+
+    bool withDecompression = false;
+};
+
+TEST_P(FCWeightsDecompressionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+    // the weights decompression is fused instead of Relu, oneDNN FullyConnected with FP32 weights fuses Relu
+    CheckNodeOfTypeCount(executableNetwork, "Eltwise", withDecompression ? 1 : 0);
+}
+
+using FCWeightsFP16TestParams = std::tuple<std::pair<SizeVector, SizeVector>, // IS data, IS weights
+                                           bool,                              // transpose B
+                                           size_t>;                           // decompression max rows
+
+/*  Param(f16)  Const(f16)
+ *       \      /
+ *        MatMul
+ *          |
+ *        Relu
+ */
+class FCWeightsFP16Test : public testing::WithParamInterface<FCWeightsFP16TestParams>, public CPUTestsBase,
+                          virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCWeightsFP16TestParams> obj) {
+        std::pair<SizeVector, SizeVector> inputShapes;
+        bool transpB;
+        size_t maxRows;
+        std::tie(inputShapes, transpB, maxRows) = obj.param;
+
+        std::ostringstream result;
+        result << "IS_data=" << CommonTestUtils::vec2str(inputShapes.first) << "_";
+        result << "IS_wei=" << CommonTestUtils::vec2str(inputShapes.second) << "_";
+        result << "Transp_B=" << transpB << "_";
+        result << "MaxRows=" << maxRows;
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::pair<SizeVector, SizeVector> inputShapes;
+        bool transpB;
+        size_t maxRows;
+        std::tie(inputShapes, transpB, maxRows) = this->GetParam();
+        configuration.insert({CPUConfigParams::KEY_CPU_FP16_WEIGHTS_DECOMPRESSION_MAX_ROWS, std::to_string(maxRows)});
+
+        // the weights are decompressed in the kernel only for a few source rows
+        const size_t rows = std::accumulate(inputShapes.first.begin(), inputShapes.first.end() - 1, size_t(1), std::multiplies<size_t>());
+        withDecompression = rows <= maxRows;
+
+        SizeVector isB = inputShapes.second;
+        if (transpB) {
+            std::swap(*(isB.end() - 1), *(isB.end() - 2));
+        }
+
+        auto inputParams = builder::makeParams(element::f16, {inputShapes.first});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+        auto weights = builder::makeConstant<float>(element::f16, isB, {}, true, 1.f, -1.f);
+        auto matMul = builder::makeMatMul(paramOuts[0], weights, false, transpB);
+        auto relu = std::make_shared<opset1::Relu>(matMul);
+
+        function = std::make_shared<Function>(relu, inputParams, "FCWeightsFP16");
+    }
+
+    bool withDecompression = false;
+};
+
+TEST_P(FCWeightsFP16Test, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+    // oneDNN FullyConnected with FP32 weights keeps fusing of post operations
+    CheckNodeOfTypeCount(executableNetwork, "Eltwise", withDecompression ? 1 : 0);
+}
+
+namespace {
+
+const std::vector<std::pair<SizeVector, SizeVector>> inputShapes = {
+    {{1, 128}, {128, 64}},
+    {{71, 96}, {96, 35}},
+};
+
+const std::vector<element::Type> weightsPrecisions = {
+    element::u8, element::i8
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_FCWeightsDecompression, FCWeightsDecompressionTest,
+                        ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                           ::testing::ValuesIn(weightsPrecisions),
+                                           ::testing::Values(true, false),
+                                           ::testing::Values(true, false),
+                                           ::testing::Values(0, 16, 128)),
+                        FCWeightsDecompressionTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_FCWeightsFP16, FCWeightsFP16Test,
+                        ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                           ::testing::Values(true, false),
+                                           ::testing::Values(0, 16, 128)),
+                        FCWeightsFP16Test::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,172 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+// The CPU graph binds its input memory to the user blobs instead of copying them, when it is safe
+class InputBindingTest : public CPUTestsBase, virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        // all the infer requests share the graph of a single stream
+        configuration[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = "1";
+    }
+
+    /*    Param
+     *      |
+     *  Convolution
+     *      |
+     *    Relu
+     */
+    void makeConvolutionFunction() {
+        auto params = builder::makeParams(element::f32, {{1, 3, 8, 8}});
+        auto conv = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, op::PadType::EXPLICIT, 8);
+        auto relu = std::make_shared<opset1::Relu>(conv);
+        function = std::make_shared<Function>(relu, params, "InputBinding");
+    }
+
+    Blob::Ptr makeInput(int seed) const {
+        return FuncTestUtils::createAndFillBlob(executableNetwork.GetInputsInfo().begin()->second->getTensorDesc(), 10, -5, 1, seed);
+    }
+
+    // the input blobs are passed in the network layout, as the reference implementation reads them as is
+    void checkOutputs(InferRequest& request, const std::vector<Blob::Ptr>& networkLayoutInputs) {
+        inputs = networkLayoutInputs;
+        std::vector<Blob::Ptr> outputs;
+        for (const auto& output : executableNetwork.GetOutputsInfo())
+            outputs.push_back(request.GetBlob(output.first));
+        Compare(CalculateRefs(), outputs);
+    }
+
+    static void checkUnchanged(const Blob::Ptr& actual, const Blob::Ptr& expected) {
+        ASSERT_EQ(expected->byteSize(), actual->byteSize());
+        ASSERT_EQ(0, std::memcmp(actual->cbuffer().as<const void*>(), expected->cbuffer().as<const void*>(), expected->byteSize()));
+    }
+};
+
+TEST_F(InputBindingTest, smoke_CopyFallbackRestoresOwnInputMemory) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    makeConvolutionFunction();
+    LoadNetwork();
+    const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    auto request = executableNetwork.CreateInferRequest();
+
+    // the blob matches the input memory descriptor, so the input is bound to it
+    const auto boundInput = makeInput(1);
+    const auto boundInputCopy = makeInput(1);
+    request.SetBlob(inputName, boundInput);
+    request.Infer();
+    checkOutputs(request, {boundInput});
+
+    // the different layout forces a copy, which must not go to the formerly bound blob
+    const auto otherInput = makeInput(2);
+    request.SetBlob(inputName, FuncTestUtils::convertBlobLayout(otherInput, Layout::NHWC));
+    request.Infer();
+    checkOutputs(request, {otherInput});
+    checkUnchanged(boundInput, boundInputCopy);
+
+    request.SetBlob(inputName, boundInput);
+    request.Infer();
+    checkOutputs(request, {boundInput});
+}
+
+TEST_F(InputBindingTest, smoke_InputsWithInPlaceConsumersAreNotBound) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    /*    Param               Param  Param
+     *      |                    \    /
+     *   Reshape                 Concat
+     *      |                      |
+     *    Relu                   Relu
+     *
+     * Relu may be executed in-place with the Reshape and Concat outputs, which share the input memory,
+     * so a bound input would be overwritten by the Relu results.
+     */
+    std::vector<std::shared_ptr<Function>> functions;
+    {
+        auto params = builder::makeParams(element::f32, {{1, 3, 8, 8}});
+        auto reshape = std::make_shared<opset1::Reshape>(params[0], opset1::Constant::create(element::i64, {2}, {1, 192}), false);
+        auto relu = std::make_shared<opset1::Relu>(reshape);
+        functions.push_back(std::make_shared<Function>(relu, params, "InputBindingReshape"));
+    }
+    {
+        auto params = builder::makeParams(element::f32, {{1, 8, 8, 8}, {1, 8, 8, 8}});
+        auto concat = std::make_shared<opset1::Concat>(OutputVector{params[0], params[1]}, 1);
+        auto relu = std::make_shared<opset1::Relu>(concat);
+        functions.push_back(std::make_shared<Function>(relu, params, "InputBindingConcat"));
+    }
+
+    for (const auto& f : functions) {
+        function = f;
+        LoadNetwork();
+        auto request = executableNetwork.CreateInferRequest();
+
+        std::vector<Blob::Ptr> userInputs, userInputsCopy;
+        // the inputs are kept in the order of the function parameters, as the reference implementation expects
+        const auto& inputsInfo = executableNetwork.GetInputsInfo();
+        int seed = 1;
+        for (const auto& param : function->get_parameters()) {
+            const auto& info = inputsInfo.at(param->get_friendly_name());
+            userInputs.push_back(FuncTestUtils::createAndFillBlob(info->getTensorDesc(), 10, -5, 1, seed));
+            userInputsCopy.push_back(FuncTestUtils::createAndFillBlob(info->getTensorDesc(), 10, -5, 1, seed));
+            request.SetBlob(info->name(), userInputs.back());
+            seed++;
+        }
+
+        request.Infer();
+        checkOutputs(request, userInputs);
+        for (size_t i = 0; i < userInputs.size(); i++)
+            checkUnchanged(userInputs[i], userInputsCopy[i]);
+    }
+}
+
+TEST_F(InputBindingTest, smoke_RequestsSharingStreamGraphReadOwnInputs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    makeConvolutionFunction();
+    LoadNetwork();
+    const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    auto request = executableNetwork.CreateInferRequest();
+    auto otherRequest = executableNetwork.CreateInferRequest();
+
+    const auto input = makeInput(1);
+    const auto otherInput = makeInput(2);
+    request.SetBlob(inputName, input);
+    otherRequest.SetBlob(inputName, otherInput);
+
+    // each inference points the shared graph input at the blob of its own request
+    request.Infer();
+    checkOutputs(request, {input});
+    otherRequest.Infer();
+    checkOutputs(otherRequest, {otherInput});
+    request.Infer();
+    checkOutputs(request, {input});
+
+    request.StartAsync();
+    otherRequest.StartAsync();
+    request.Wait(InferRequest::WaitMode::RESULT_READY);
+    otherRequest.Wait(InferRequest::WaitMode::RESULT_READY);
+    checkOutputs(request, {input});
+    checkOutputs(otherRequest, {otherInput});
+
+    // the copied input of one request and the bound input of the other one alternate
+    otherRequest.SetBlob(inputName, FuncTestUtils::convertBlobLayout(otherInput, Layout::NHWC));
+    otherRequest.Infer();
+    checkOutputs(otherRequest, {otherInput});
+    request.Infer();
+    checkOutputs(request, {input});
+    otherRequest.Infer();
+    checkOutputs(otherRequest, {otherInput});
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,263 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <blob_factory.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using MemoryStateAccumulationTestParams = std::tuple<bool,     // ReadValue is the first Add input
+                                                      size_t>;  // batch
+
+/*    Param  ReadValue
+ *       \    /
+ *        Add
+ *       /   \
+ *   Result  Assign
+ */
+class MemoryStateAccumulationTest : public testing::WithParamInterface<MemoryStateAccumulationTestParams>, public CPUTestsBase,
+                                    virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MemoryStateAccumulationTestParams> obj) {
+        bool readValueFirst;
+        size_t batch;
+        std::tie(readValueFirst, batch) = obj.param;
+
+        std::ostringstream result;
+        result << "ReadValueFirst=" << readValueFirst << "_";
+        result << "Batch=" << batch;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        bool readValueFirst;
+        size_t batch;
+        std::tie(readValueFirst, batch) = this->GetParam();
+
+        auto params = builder::makeParams(element::f32, {{batch, 64}});
+        auto init = builder::makeConstant<float>(element::f32, {batch, 64}, std::vector<float>(batch * 64, 0.f));
+        auto readValue = std::make_shared<opset3::ReadValue>(init, "accumulator");
+        // Add can be executed in-place with ReadValue output, so the state is copied in this case
+        auto add = readValueFirst ? std::make_shared<opset1::Add>(readValue, params[0])
+                                  : std::make_shared<opset1::Add>(params[0], readValue);
+        auto assign = std::make_shared<opset3::Assign>(add, "accumulator");
+
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(add)},
+                                              SinkVector{assign}, params, "MemoryStateAccumulation");
+    }
+
+    static void checkValues(const Blob::CPtr& blob, float expected) {
+        auto data = blob->cbuffer().as<const float*>();
+        for (size_t i = 0; i < blob->size(); i++)
+            ASSERT_EQ(data[i], expected) << "at index " << i;
+    }
+
+    // checks accumulated values of each batch item
+    static void checkRows(const Blob::CPtr& blob, const std::vector<float>& expected) {
+        auto data = blob->cbuffer().as<const float*>();
+        const size_t rowSize = blob->size() / expected.size();
+        for (size_t i = 0; i < blob->size(); i++)
+            ASSERT_EQ(data[i], expected[i / rowSize]) << "at index " << i;
+    }
+};
+
+TEST_P(MemoryStateAccumulationTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+
+    const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+    auto request = executableNetwork.CreateInferRequest();
+    auto otherRequest = executableNetwork.CreateInferRequest();
+    for (auto req : {&request, &otherRequest}) {
+        auto input = req->GetBlob(inputName);
+        std::fill_n(input->buffer().as<float*>(), input->size(), 1.f);
+    }
+
+    for (int iteration = 1; iteration <= 4; iteration++) {
+        request.Infer();
+        checkValues(request.GetBlob(outputName), iteration);
+        checkValues(request.QueryState().front().GetState(), iteration);
+    }
+
+    // states of different requests are independent
+    otherRequest.Infer();
+    checkValues(otherRequest.GetBlob(outputName), 1.f);
+
+    for (auto&& state : request.QueryState())
+        state.Reset();
+    request.Infer();
+    checkValues(request.GetBlob(outputName), 1.f);
+
+    auto newState = make_blob_with_precision(request.QueryState().front().GetState()->getTensorDesc());
+    newState->allocate();
+    std::fill_n(newState->buffer().as<float*>(), newState->size(), 10.f);
+    request.QueryState().front().SetState(newState);
+    request.Infer();
+    checkValues(request.GetBlob(outputName), 11.f);
+    request.Infer();
+    checkValues(request.GetBlob(outputName), 12.f);
+}
+
+TEST_P(MemoryStateAccumulationTest, StateSessions) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const size_t batch = std::get<1>(this->GetParam());
+    LoadNetwork();
+
+    const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+    auto request = executableNetwork.CreateInferRequest();
+    auto input = request.GetBlob(inputName);
+    std::fill_n(input->buffer().as<float*>(), input->size(), 1.f);
+
+    // sessions 0..batch-1 and batch..2*batch-1 are processed alternately
+    auto sessionIds = [&](size_t first) {
+        std::vector<std::string> ids;
+        for (size_t i = first; i < first + batch; i++)
+            ids.push_back("session" + std::to_string(i));
+        return ids;
+    };
+
+    request.SetStateSessions(sessionIds(0));
+    request.Infer();
+    request.Infer();
+    request.SetStateSessions(sessionIds(batch));
+    request.Infer();
+    checkValues(request.GetBlob(outputName), 1.f);
+    request.SetStateSessions(sessionIds(0));
+    request.Infer();
+    checkValues(request.GetBlob(outputName), 3.f);
+
+    // sessions are mixed in one batch
+    if (batch > 1) {
+        request.SetStateSessions(sessionIds(1));
+        request.Infer();
+        std::vector<float> expected(batch, 4.f);
+        expected.back() = 2.f;
+        checkRows(request.GetBlob(outputName), expected);
+    }
+
+    // sessions are locked by the request
+    auto otherRequest = executableNetwork.CreateInferRequest();
+    ASSERT_THROW(otherRequest.SetStateSessions(sessionIds(0)), Exception);
+    ASSERT_THROW(request.ReleaseStateSession("session0"), Exception);
+
+    // released session starts from the default state
+    request.SetStateSessions({});
+    request.ReleaseStateSession("session0");
+    auto otherInput = otherRequest.GetBlob(inputName);
+    std::fill_n(otherInput->buffer().as<float*>(), otherInput->size(), 1.f);
+    otherRequest.SetStateSessions(sessionIds(0));
+    otherRequest.Infer();
+    std::vector<float> expected(batch, 5.f);
+    expected.front() = 1.f;
+    checkRows(otherRequest.GetBlob(outputName), expected);
+}
+
+TEST_P(MemoryStateAccumulationTest, SessionReusedAcrossRequests) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const size_t batch = std::get<1>(this->GetParam());
+    LoadNetwork();
+
+    const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+    auto request = executableNetwork.CreateInferRequest();
+    auto otherRequest = executableNetwork.CreateInferRequest();
+    for (auto req : {&request, &otherRequest}) {
+        auto input = req->GetBlob(inputName);
+        std::fill_n(input->buffer().as<float*>(), input->size(), 1.f);
+    }
+
+    std::vector<std::string> sessionIds, nextSessionIds, otherSessionIds;
+    for (size_t i = 0; i < batch; i++) {
+        sessionIds.push_back("session" + std::to_string(i));
+        nextSessionIds.push_back("session" + std::to_string(i + 1));
+        otherSessionIds.push_back("other" + std::to_string(i));
+    }
+
+    // the own state of the request isn't changed by the sessions
+    request.Infer();
+    request.SetStateSessions(sessionIds);
+    request.Infer();
+    request.Infer();
+    request.SetStateSessions({});
+    checkValues(request.QueryState().front().GetState(), 1.f);
+
+    // the session continues in the other request
+    otherRequest.SetStateSessions(sessionIds);
+    otherRequest.Infer();
+    checkValues(otherRequest.GetBlob(outputName), 3.f);
+
+    // the common sessions stay locked while the overlapping sessions are switched
+    otherRequest.SetStateSessions(nextSessionIds);
+    otherRequest.Infer();
+    std::vector<float> expected(batch, 4.f);
+    expected.back() = 1.f;
+    checkRows(otherRequest.GetBlob(outputName), expected);
+
+    // the failed switch keeps the current sessions of the request
+    request.SetStateSessions(otherSessionIds);
+    ASSERT_THROW(request.SetStateSessions(nextSessionIds), Exception);
+    ASSERT_THROW(otherRequest.SetStateSessions(otherSessionIds), Exception);
+    request.Infer();
+    request.Infer();
+    checkValues(request.GetBlob(outputName), 2.f);
+}
+
+TEST_P(MemoryStateAccumulationTest, StateWithoutAssignIsKept) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    /*    Param  ReadValue
+     *       \    /
+     *        Add
+     *         |
+     *       Result
+     */
+    const size_t batch = std::get<1>(this->GetParam());
+    auto params = builder::makeParams(element::f32, {{batch, 64}});
+    auto init = builder::makeConstant<float>(element::f32, {batch, 64}, std::vector<float>(batch * 64, 0.f));
+    auto readValue = std::make_shared<opset3::ReadValue>(init, "accumulator");
+    auto add = std::make_shared<opset1::Add>(params[0], readValue);
+    function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(add)}, params, "StateWithoutAssign");
+    LoadNetwork();
+
+    const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+    auto request = executableNetwork.CreateInferRequest();
+    auto input = request.GetBlob(inputName);
+    std::fill_n(input->buffer().as<float*>(), input->size(), 1.f);
+
+    auto newState = make_blob_with_precision(request.QueryState().front().GetState()->getTensorDesc());
+    newState->allocate();
+    std::fill_n(newState->buffer().as<float*>(), newState->size(), 10.f);
+    request.QueryState().front().SetState(newState);
+
+    // nothing writes the state, so every inference reads the same value
+    for (int iteration = 0; iteration < 3; iteration++) {
+        request.Infer();
+        checkValues(request.GetBlob(outputName), 11.f);
+        checkValues(request.QueryState().front().GetState(), 10.f);
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_MemoryStateAccumulation, MemoryStateAccumulationTest,
+                        ::testing::Combine(::testing::Values(true, false),
+                                           ::testing::Values(1, 2)),
+                        MemoryStateAccumulationTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,144 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include <exception>
+#include <thread>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using ParallelWeightsPrepareTestParams = std::string;  // number of streams
+
+/*                  Param
+ *       /       /        \          \
+ *   Conv 3x3  Conv 3x3  Conv 1x1  Deconvolution
+ *       \       /        /             |
+ *          Concat                    Relu
+ *            |
+ *          Relu
+ *
+ * The weights of all the layers are reordered to the blocked layouts, so they are prepared by the
+ * parallel load stages, which are shared by the stream graphs through the weights cache.
+ */
+class ParallelWeightsPrepareTest : public testing::WithParamInterface<ParallelWeightsPrepareTestParams>, public CPUTestsBase,
+                                   virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ParallelWeightsPrepareTestParams> obj) {
+        std::ostringstream result;
+        result << "streams=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = this->GetParam();
+
+        auto params = builder::makeParams(element::f32, {{1, 16, 14, 14}});
+        auto conv1 = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                              op::PadType::EXPLICIT, 32, true);
+        auto conv2 = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                              op::PadType::EXPLICIT, 16, true);
+        auto conv3 = builder::makeConvolution(params[0], element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                              op::PadType::EXPLICIT, 48);
+        auto concat = std::make_shared<opset1::Concat>(OutputVector{conv1, conv2, conv3}, 1);
+        auto concatRelu = std::make_shared<opset1::Relu>(concat);
+
+        auto deconv = builder::makeConvolutionBackpropData(params[0], element::f32, {2, 2}, {2, 2}, {0, 0}, {0, 0}, {1, 1},
+                                                           op::PadType::EXPLICIT, 32);
+        auto deconvRelu = std::make_shared<opset1::Relu>(deconv);
+
+        function = std::make_shared<Function>(NodeVector{concatRelu, deconvRelu}, params, "ParallelWeightsPrepare");
+    }
+
+    // infers all the streams at once, so that every stream graph is checked
+    std::vector<BlobMap> inferAll(ExecutableNetwork& network, const Blob::Ptr& input) {
+        std::vector<InferRequest> requests;
+        for (int i = 0; i < std::stoi(this->GetParam()); i++) {
+            requests.push_back(network.CreateInferRequest());
+            requests.back().SetBlob(network.GetInputsInfo().begin()->first, input);
+            requests.back().StartAsync();
+        }
+
+        std::vector<BlobMap> outputs;
+        for (auto& request : requests) {
+            request.Wait(InferRequest::WaitMode::RESULT_READY);
+            outputs.emplace_back();
+            for (const auto& output : network.GetOutputsInfo())
+                outputs.back()[output.first] = request.GetBlob(output.first);
+        }
+        return outputs;
+    }
+
+    static void compareExactly(const std::vector<BlobMap>& actual, const BlobMap& expected) {
+        for (const auto& blobs : actual) {
+            for (const auto& blob : expected) {
+                const auto& actualBlob = blobs.at(blob.first);
+                ASSERT_EQ(actualBlob->byteSize(), blob.second->byteSize());
+                ASSERT_EQ(0, std::memcmp(actualBlob->cbuffer().as<const void*>(), blob.second->cbuffer().as<const void*>(),
+                                         blob.second->byteSize())) << blob.first;
+            }
+        }
+    }
+};
+
+TEST_P(ParallelWeightsPrepareTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    // every stream graph reads the same prepared weights
+    const auto input = FuncTestUtils::createAndFillBlob(executableNetwork.GetInputsInfo().begin()->second->getTensorDesc());
+    const auto outputs = inferAll(executableNetwork, input);
+    compareExactly(outputs, outputs.front());
+}
+
+TEST_P(ParallelWeightsPrepareTest, NetworksLoadedConcurrently) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    const auto input = FuncTestUtils::createAndFillBlob(executableNetwork.GetInputsInfo().begin()->second->getTensorDesc());
+    const auto expected = inferAll(executableNetwork, input).front();
+
+    // the networks with the same layer names share the weights cache, so the graphs of the different
+    // networks wait for the weights being prepared by each other
+    const size_t networksNum = 4;
+    std::vector<ExecutableNetwork> networks(networksNum);
+    std::vector<std::exception_ptr> errors(networksNum);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < networksNum; i++) {
+        threads.emplace_back([&, i]() {
+            try {
+                networks[i] = core->LoadNetwork(cnnNetwork, targetDevice, configuration);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    for (auto& network : networks)
+        compareExactly(inferAll(network, input), expected);
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_ParallelWeightsPrepare, ParallelWeightsPrepareTest,
+                        ::testing::Values("1", "4"),
+                        ParallelWeightsPrepareTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
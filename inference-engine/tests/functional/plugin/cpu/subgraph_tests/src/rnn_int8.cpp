@@ -0,0 +1,154 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using RNNInt8TestParams = std::tuple<std::string, // cell type: LSTM or GRU
+                                     size_t,      // batch
+                                     size_t,      // sequence length
+                                     size_t,      // input size
+                                     size_t,      // hidden size
+                                     bool>;       // signed quantization interval of X and H
+
+/*   Param        Param         Const      Const
+ *     |            |             |          |
+ *  FakeQuantize  FakeQuantize  FakeQuantize FakeQuantize  <- per output channel intervals
+ *     |    (X)     |    (H)      |  (W)     |  (R)
+ *      \           |            /         /
+ *               LSTMSequence / GRUSequence
+ *
+ * X and H are quantized with the same parameters. The cell requantizes the hidden state on each step with them,
+ * so it is executed in int8 only if the interval covers the [-1, 1] hidden state values.
+ */
+class RNNInt8Test : public testing::WithParamInterface<RNNInt8TestParams>, public CPUTestsBase,
+                    virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<RNNInt8TestParams> obj) {
+        std::string cellType;
+        size_t batch, seqLength, inputSize, hiddenSize;
+        bool signedInterval;
+        std::tie(cellType, batch, seqLength, inputSize, hiddenSize, signedInterval) = obj.param;
+
+        std::ostringstream result;
+        result << "Cell=" << cellType << "_";
+        result << "N=" << batch << "_";
+        result << "T=" << seqLength << "_";
+        result << "I=" << inputSize << "_";
+        result << "H=" << hiddenSize << "_";
+        result << "SignedInterval=" << signedInterval;
+
+        return result.str();
+    }
+
+protected:
+    std::shared_ptr<Node> makeQuantizedWeights(const Shape& shape) {
+        const size_t OC = shape[1];
+        auto weights = builder::makeConstant<float>(element::f32, shape, {}, true, 1.f, -1.f);
+
+        std::vector<float> lowValues(OC), highValues(OC);
+        for (size_t oc = 0; oc < OC; oc++) {
+            const float range = 1.f - 0.5f * oc / OC;
+            lowValues[oc] = -range * 128.f / 127.f;
+            highValues[oc] = range;
+        }
+        return builder::makeFakeQuantize(weights, element::f32, 256, {1, OC, 1}, lowValues, highValues, lowValues, highValues);
+    }
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::string cellType;
+        size_t batch, seqLength, inputSize, hiddenSize;
+        bool signedInterval;
+        std::tie(cellType, batch, seqLength, inputSize, hiddenSize, signedInterval) = this->GetParam();
+
+        const bool isLSTM = cellType == "LSTM";
+        const size_t gates = isLSTM ? 4 : 3;
+        const auto direction = op::RecurrentSequenceDirection::FORWARD;
+
+        std::vector<SizeVector> inputShapes = {{batch, seqLength, inputSize}, {batch, 1, hiddenSize}};
+        if (isLSTM)
+            inputShapes.push_back({batch, 1, hiddenSize});
+        auto params = builder::makeParams(element::f32, inputShapes);
+
+        const std::vector<float> low = {signedInterval ? -1.28f : 0.f};
+        const std::vector<float> high = {signedInterval ? 1.27f : 2.55f};
+        auto X = builder::makeFakeQuantize(params[0], element::f32, 256, {}, low, high, low, high);
+        auto H = builder::makeFakeQuantize(params[1], element::f32, 256, {}, low, high, low, high);
+        auto seqLengths = builder::makeConstant<int64_t>(element::i64, {batch}, std::vector<int64_t>(batch, seqLength));
+        auto W = makeQuantizedWeights({1, gates * hiddenSize, inputSize});
+        auto R = makeQuantizedWeights({1, gates * hiddenSize, hiddenSize});
+
+        std::shared_ptr<Node> sequence;
+        if (isLSTM) {
+            auto B = builder::makeConstant<float>(element::f32, {1, gates * hiddenSize}, {}, true, 0.1f, -0.1f);
+            sequence = std::make_shared<opset5::LSTMSequence>(X, H, params[2], seqLengths, W, R, B, hiddenSize, direction);
+        } else {
+            // linear_before_reset GRU has an additional bias for the recurrent part of the new gate
+            auto B = builder::makeConstant<float>(element::f32, {1, (gates + 1) * hiddenSize}, {}, true, 0.1f, -0.1f);
+            sequence = std::make_shared<opset5::GRUSequence>(X, H, seqLengths, W, R, B, hiddenSize, direction,
+                                                             std::vector<std::string>{"sigmoid", "tanh"},
+                                                             std::vector<float>{}, std::vector<float>{}, 0.f, true);
+        }
+
+        ResultVector results;
+        for (size_t i = 0; i < sequence->get_output_size(); i++)
+            results.push_back(std::make_shared<opset1::Result>(sequence->output(i)));
+
+        function = std::make_shared<Function>(results, params, "RNNInt8");
+        // the hidden state rounding to the input quantization step is accumulated through the sequence
+        threshold = 0.02f;
+    }
+
+    void checkInt8Execution() {
+        const bool signedInterval = std::get<5>(this->GetParam());
+        CheckNodeOfTypeCount(executableNetwork, "RNNSeq", 1);
+        if (!signedInterval)
+            return;
+
+        // dequantization of X, W and R is fused into the cell
+        CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+        CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+        for (const auto& node : executableNetwork.GetExecGraphInfo().getFunction()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            auto getExecValue = [&rtInfo](const std::string& paramName) -> std::string {
+                auto it = rtInfo.find(paramName);
+                IE_ASSERT(rtInfo.end() != it);
+                auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+                IE_ASSERT(nullptr != value);
+                return value->get();
+            };
+            if (getExecValue(ExecGraphInfoSerialization::LAYER_TYPE) == "RNNSeq")
+                ASSERT_EQ("U8", getExecValue(ExecGraphInfoSerialization::RUNTIME_PRECISION));
+        }
+    }
+};
+
+TEST_P(RNNInt8Test, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    checkInt8Execution();
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_RNNInt8, RNNInt8Test,
+                        ::testing::Combine(::testing::Values("LSTM", "GRU"),
+                                           ::testing::Values(1, 5),
+                                           ::testing::Values(2, 10),
+                                           ::testing::Values(16),
+                                           ::testing::Values(32),
+                                           ::testing::Values(true, false)),
+                        RNNInt8Test::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,261 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include <blob_factory.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using UpdateWeightsTestParams = std::string;  // number of streams
+
+/*    Param
+ *      |
+ *  Convolution (with bias)
+ *      |
+ *    Relu
+ *      |
+ *   Reshape
+ *      |
+ *   MatMul
+ */
+class UpdateWeightsTest : public testing::WithParamInterface<UpdateWeightsTestParams>, public CPUTestsBase,
+                          virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<UpdateWeightsTestParams> obj) {
+        std::ostringstream result;
+        result << "streams=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = this->GetParam();
+        function = makeFunction(1);
+    }
+
+    static std::vector<float> generateWeights(std::mt19937& gen, size_t size) {
+        std::uniform_real_distribution<float> dist(-1.f, 1.f);
+        std::vector<float> values(size);
+        for (auto& value : values)
+            value = dist(gen);
+        return values;
+    }
+
+    static std::shared_ptr<Node> makeBody(const Output<Node>& input, unsigned seed) {
+        std::mt19937 gen(seed);
+        auto conv = builder::makeConvolution(input, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, op::PadType::EXPLICIT,
+                                             16, true, generateWeights(gen, 16 * 8 * 3 * 3), generateWeights(gen, 16));
+        auto relu = std::make_shared<opset1::Relu>(conv);
+        auto reshape = std::make_shared<opset1::Reshape>(relu, opset1::Constant::create(element::i64, {2}, {1, 1600}), false);
+        return std::make_shared<opset1::MatMul>(reshape, opset1::Constant::create(element::f32, {1600, 10},
+                                                                                  generateWeights(gen, 1600 * 10)));
+    }
+
+    // the functions created with different seeds differ only in the weights values
+    static std::shared_ptr<Function> makeFunction(unsigned seed) {
+        auto params = builder::makeParams(element::f32, {{1, 8, 10, 10}});
+        return std::make_shared<Function>(makeBody(params[0], seed), params, "UpdateWeights");
+    }
+
+    /*    Param  ReadValue
+     *      |       |
+     *   (body)     |
+     *       \     /
+     *         Add
+     *       /    \
+     *   Result  Assign
+     */
+    static std::shared_ptr<Function> makeStatefulFunction(unsigned seed) {
+        auto params = builder::makeParams(element::f32, {{1, 8, 10, 10}});
+        auto init = builder::makeConstant<float>(element::f32, {1, 10}, std::vector<float>(10, 0.f));
+        auto readValue = std::make_shared<opset3::ReadValue>(init, "accumulator");
+        auto add = std::make_shared<opset1::Add>(makeBody(params[0], seed), readValue);
+        auto assign = std::make_shared<opset3::Assign>(add, "accumulator");
+        return std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(add)}, SinkVector{assign}, params,
+                                          "UpdateWeights");
+    }
+
+    // the deconvolution weights are consumed during the graph compilation, so they can't be updated
+    static std::shared_ptr<Function> makeFunctionWithDeconvolution(unsigned seed, unsigned deconvSeed) {
+        std::mt19937 gen(deconvSeed);
+        auto params = builder::makeParams(element::f32, {{1, 8, 10, 10}});
+        auto deconv = builder::makeConvolutionBackpropData(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                           op::PadType::EXPLICIT, 8, false, generateWeights(gen, 8 * 8 * 3 * 3));
+        return std::make_shared<Function>(makeBody(deconv, seed), params, "UpdateWeights");
+    }
+
+    std::vector<InferRequest> createRequests(ExecutableNetwork& network, const Blob::Ptr& input) {
+        std::vector<InferRequest> requests;
+        for (int i = 0; i < std::stoi(this->GetParam()); i++) {
+            requests.push_back(network.CreateInferRequest());
+            requests.back().SetBlob(network.GetInputsInfo().begin()->first, input);
+        }
+        return requests;
+    }
+
+    // infers all the streams at once, so that every stream graph is checked
+    static std::vector<Blob::Ptr> inferAll(std::vector<InferRequest>& requests, const std::string& outputName) {
+        for (auto& request : requests)
+            request.StartAsync();
+
+        std::vector<Blob::Ptr> outputs;
+        for (auto& request : requests) {
+            request.Wait(InferRequest::WaitMode::RESULT_READY);
+            outputs.push_back(request.GetBlob(outputName));
+        }
+        return outputs;
+    }
+
+    std::vector<Blob::Ptr> inferAll(ExecutableNetwork& network, const Blob::Ptr& input) {
+        auto requests = createRequests(network, input);
+        return inferAll(requests, network.GetOutputsInfo().begin()->first);
+    }
+
+    static Blob::Ptr copyBlob(const Blob::Ptr& blob) {
+        auto copy = make_blob_with_precision(blob->getTensorDesc());
+        copy->allocate();
+        std::memcpy(copy->buffer().as<void*>(), blob->cbuffer().as<const void*>(), blob->byteSize());
+        return copy;
+    }
+
+    static void compareExactly(const std::vector<Blob::Ptr>& actual, const Blob::Ptr& expected) {
+        for (const auto& blob : actual) {
+            ASSERT_EQ(blob->byteSize(), expected->byteSize());
+            ASSERT_EQ(0, std::memcmp(blob->cbuffer().as<const void*>(), expected->cbuffer().as<const void*>(), expected->byteSize()));
+        }
+    }
+};
+
+TEST_P(UpdateWeightsTest, CompareWithLoadedNetwork) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    const auto input = FuncTestUtils::createAndFillBlob(executableNetwork.GetInputsInfo().begin()->second->getTensorDesc());
+    const auto initialOutput = inferAll(executableNetwork, input).front();
+
+    auto newFunction = makeFunction(2);
+    auto newNetwork = core->LoadNetwork(CNNNetwork(newFunction), targetDevice, configuration);
+    const auto expectedOutput = inferAll(newNetwork, input).front();
+
+    executableNetwork.UpdateWeights(CNNNetwork(newFunction));
+    compareExactly(inferAll(executableNetwork, input), expectedOutput);
+
+    // the weights may be switched back
+    executableNetwork.UpdateWeights(CNNNetwork(makeFunction(1)));
+    compareExactly(inferAll(executableNetwork, input), initialOutput);
+}
+
+TEST_P(UpdateWeightsTest, OtherNetworksKeepWeights) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    // the network with the same layer names shares the weights cache of the plugin
+    auto otherNetwork = core->LoadNetwork(cnnNetwork, targetDevice, configuration);
+    const auto input = FuncTestUtils::createAndFillBlob(executableNetwork.GetInputsInfo().begin()->second->getTensorDesc());
+    const auto initialOutput = inferAll(otherNetwork, input).front();
+
+    executableNetwork.UpdateWeights(CNNNetwork(makeFunction(2)));
+    compareExactly(inferAll(otherNetwork, input), initialOutput);
+
+    // the network loaded after the update still gets the initial weights
+    auto newNetwork = core->LoadNetwork(cnnNetwork, targetDevice, configuration);
+    compareExactly(inferAll(newNetwork, input), initialOutput);
+}
+
+TEST_P(UpdateWeightsTest, RejectsDifferentTopology) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+
+    auto params = builder::makeParams(element::f32, {{1, 8, 10, 10}});
+    auto relu = std::make_shared<opset1::Relu>(params[0]);
+    auto otherFunction = std::make_shared<Function>(relu, params, "UpdateWeights");
+    ASSERT_THROW(executableNetwork.UpdateWeights(CNNNetwork(otherFunction)), InferenceEngine::Exception);
+}
+
+TEST_P(UpdateWeightsTest, RequestCreatedBeforeUpdate) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    const auto input = FuncTestUtils::createAndFillBlob(executableNetwork.GetInputsInfo().begin()->second->getTensorDesc());
+    const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+    auto requests = createRequests(executableNetwork, input);
+    inferAll(requests, outputName);
+
+    auto newFunction = makeFunction(2);
+    auto newNetwork = core->LoadNetwork(CNNNetwork(newFunction), targetDevice, configuration);
+    const auto expectedOutput = inferAll(newNetwork, input).front();
+
+    executableNetwork.UpdateWeights(CNNNetwork(newFunction));
+    compareExactly(inferAll(requests, outputName), expectedOutput);
+}
+
+TEST_P(UpdateWeightsTest, StateIsKept) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    function = makeStatefulFunction(1);
+    LoadNetwork();
+    const auto input = FuncTestUtils::createAndFillBlob(executableNetwork.GetInputsInfo().begin()->second->getTensorDesc());
+    std::vector<Blob::Ptr> expectedOutputs;
+    for (unsigned seed : {1, 2}) {
+        auto network = core->LoadNetwork(CNNNetwork(makeFunction(seed)), targetDevice, configuration);
+        expectedOutputs.push_back(copyBlob(inferAll(network, input).front()));
+    }
+
+    auto request = executableNetwork.CreateInferRequest();
+    request.SetBlob(executableNetwork.GetInputsInfo().begin()->first, input);
+    request.Infer();
+
+    // the state written with the initial weights is accumulated with the output of the new ones
+    executableNetwork.UpdateWeights(CNNNetwork(makeStatefulFunction(2)));
+    request.Infer();
+
+    auto output = request.GetBlob(executableNetwork.GetOutputsInfo().begin()->first)->cbuffer().as<const float*>();
+    auto first = expectedOutputs[0]->cbuffer().as<const float*>();
+    auto second = expectedOutputs[1]->cbuffer().as<const float*>();
+    for (size_t i = 0; i < expectedOutputs[0]->size(); i++) {
+        const float expected = first[i] + second[i];
+        ASSERT_NEAR(output[i], expected, 1e-4f * std::max(1.f, std::abs(expected))) << "at index " << i;
+    }
+}
+
+TEST_P(UpdateWeightsTest, FailedUpdateKeepsOutputs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    function = makeFunctionWithDeconvolution(1, 1);
+    LoadNetwork();
+    const auto input = FuncTestUtils::createAndFillBlob(executableNetwork.GetInputsInfo().begin()->second->getTensorDesc());
+    const auto initialOutput = copyBlob(inferAll(executableNetwork, input).front());
+
+    // the convolution weights may be updated, but the deconvolution ones can't, so none of them is replaced
+    ASSERT_THROW(executableNetwork.UpdateWeights(CNNNetwork(makeFunctionWithDeconvolution(2, 2))), InferenceEngine::Exception);
+    compareExactly(inferAll(executableNetwork, input), initialOutput);
+
+    // the network is still updated by the supported constants
+    auto newFunction = makeFunctionWithDeconvolution(2, 1);
+    auto newNetwork = core->LoadNetwork(CNNNetwork(newFunction), targetDevice, configuration);
+    const auto expectedOutput = inferAll(newNetwork, input).front();
+    executableNetwork.UpdateWeights(CNNNetwork(newFunction));
+    compareExactly(inferAll(executableNetwork, input), expectedOutput);
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_UpdateWeights, UpdateWeightsTest,
+                        ::testing::Values("1", "2"),
+                        UpdateWeightsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,174 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+#include <memory>
+#include <tuple>
+#include <string>
+#include <map>
+
+#include <ie_core.hpp>
+
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+typedef std::tuple<
+    InferenceEngine::Precision,         // Network Precision
+    std::string,                        // Target Device
+    std::map<std::string, std::string>, // Configuration
+    size_t                              // Input size
+> compactModeMemoryReuseParams;
+
+namespace LayerTestsDefinitions {
+
+/*
+ *          Param
+ *         /     \
+ *      FC         FC
+ *       |          |
+ *     Relu      Sigmoid      ReadValue
+ *         \     /               |
+ *          Concat               |
+ *            |                  |
+ *           FC                  |
+ *             \                /
+ *                    Add
+ *                  /     \
+ *               FC        Assign
+ *                |
+ *              Result
+ *
+ * The intermediate buffers of the layers executed one after another share memory in the compact mode,
+ * while the concat buffer, the state and the inputs and outputs are kept apart.
+ */
+class CompactModeMemoryReuseTest : public testing::WithParamInterface<compactModeMemoryReuseParams>,
+    public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<compactModeMemoryReuseParams> obj) {
+        InferenceEngine::Precision netPrecision;
+        std::string targetDevice;
+        std::map<std::string, std::string> configuration;
+        size_t inputSize;
+        std::tie(netPrecision, targetDevice, configuration, inputSize) = obj.param;
+
+        std::ostringstream result;
+        result << "netPRC=" << netPrecision.name() << "_";
+        result << "targetDevice=" << targetDevice << "_";
+        for (auto const& configItem : configuration) {
+            result << "_configItem=" << configItem.first << "_" << configItem.second;
+        }
+        result << "_IS=" << inputSize;
+        return result.str();
+    }
+
+    InferenceEngine::Blob::Ptr GenerateInput(const InferenceEngine::InputInfo& info) const override {
+        return FuncTestUtils::createAndFillBlob(info.getTensorDesc(), 2, -1, 100);
+    }
+
+    void Run() override {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+        function = makeFunction(true);
+        LoadNetwork();
+
+        auto stateDesc = InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, {1, inputSize},
+                                                     InferenceEngine::Layout::NC);
+        IE_SUPPRESS_DEPRECATED_START
+        auto states = executableNetwork.QueryState();
+        states[0].SetState(FuncTestUtils::createAndFillBlobWithFloatArray(stateDesc, memoryInit.data(), memoryInit.size()));
+        IE_SUPPRESS_DEPRECATED_END
+
+        GenerateInputs();
+        Infer();
+
+        // the state is read before it is written, so the reference reads the initial state as a constant
+        function = makeFunction(false);
+        Validate();
+    }
+
+protected:
+    void SetUp() override {
+        InferenceEngine::Precision netPrecision;
+        std::tie(netPrecision, targetDevice, configuration, inputSize) = this->GetParam();
+        ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+        threshold = 0.05f;
+
+        memoryInit = CommonTestUtils::generate_float_numbers(inputSize, -0.5f, 0.5f);
+        for (int seed = 1; seed <= 4; seed++) {
+            const size_t rows = seed == 3 ? 2 * inputSize : inputSize;
+            weights.push_back(CommonTestUtils::generate_float_numbers(rows * inputSize, -0.05f, 0.05f, seed));
+        }
+    }
+
+    std::shared_ptr<ngraph::Function> makeFunction(bool withMemory) const {
+        auto params = ngraph::builder::makeParams(ngPrc, {{1, inputSize}});
+
+        auto fc1 = ngraph::builder::makeMatMul(params[0], ngraph::builder::makeConstant(ngPrc, {inputSize, inputSize}, weights[0]));
+        auto relu = std::make_shared<ngraph::opset1::Relu>(fc1);
+        auto fc2 = ngraph::builder::makeMatMul(params[0], ngraph::builder::makeConstant(ngPrc, {inputSize, inputSize}, weights[1]));
+        auto sigmoid = std::make_shared<ngraph::opset1::Sigmoid>(fc2);
+        auto concat = ngraph::builder::makeConcat({relu, sigmoid}, 1);
+        auto fc3 = ngraph::builder::makeMatMul(concat, ngraph::builder::makeConstant(ngPrc, {2 * inputSize, inputSize}, weights[2]));
+
+        auto memoryConstant = ngraph::builder::makeConstant(ngPrc, {1, inputSize}, memoryInit);
+        std::shared_ptr<ngraph::Node> memoryRead = memoryConstant;
+        if (withMemory)
+            memoryRead = std::make_shared<ngraph::opset3::ReadValue>(memoryConstant, "memory");
+        auto add = std::make_shared<ngraph::opset1::Add>(fc3, memoryRead);
+        auto fc4 = ngraph::builder::makeMatMul(add, ngraph::builder::makeConstant(ngPrc, {inputSize, inputSize}, weights[3]));
+
+        if (withMemory) {
+            auto memoryWrite = std::make_shared<ngraph::opset3::Assign>(add, "memory");
+            memoryWrite->add_control_dependency(memoryRead);
+            fc4->add_control_dependency(memoryWrite);
+        }
+
+        return std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(fc4)},
+                                                  params, "CompactModeMemoryReuse");
+    }
+
+    ngraph::element::Type ngPrc;
+    size_t inputSize = 0;
+    std::vector<float> memoryInit;
+    std::vector<std::vector<float>> weights;
+};
+
+TEST_P(CompactModeMemoryReuseTest, CompareWithRefImpl) {
+    Run();
+};
+
+const std::vector<InferenceEngine::Precision> netPrecisions = {
+    InferenceEngine::Precision::FP32
+};
+
+const std::vector<std::map<std::string, std::string>> configs = {
+    {
+        {"GNA_DEVICE_MODE", "GNA_SW_EXACT"},
+        {"GNA_SCALE_FACTOR_0", "1024"},
+        {"GNA_COMPACT_MODE", "YES"}
+    },
+    {
+        {"GNA_DEVICE_MODE", "GNA_SW_EXACT"},
+        {"GNA_SCALE_FACTOR_0", "1024"},
+        {"GNA_COMPACT_MODE", "NO"}
+    }
+};
+
+const std::vector<size_t> inputSizes = {
+    32,
+    64
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_compact_mode_memory_reuse, CompactModeMemoryReuseTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(netPrecisions),
+        ::testing::Values(CommonTestUtils::DEVICE_GNA),
+        ::testing::ValuesIn(configs),
+        ::testing::ValuesIn(inputSizes)),
+    CompactModeMemoryReuseTest::getTestCaseName);
+} // namespace LayerTestsDefinitions
@@ -0,0 +1,111 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include <gtest/gtest.h>
+#include <ie_common.h>
+#include <ngraph/type/float16.hpp>
+
+#include "nodes/common/cpu_convert.h"
+#include "utils/bfloat16.hpp"
+
+using namespace InferenceEngine;
+using MKLDNNPlugin::bfloat16_t;
+
+namespace {
+
+using CpuConvertParams = std::tuple<Precision, Precision, size_t, bool>;  // src precision, dst precision, size, scalar implementation
+
+// round to nearest even as the conversion does
+bfloat16_t toBf16(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    bits += 0x7fff + ((bits >> 16) & 1);
+    return bfloat16_t::from_bits(static_cast<uint16_t>(bits >> 16));
+}
+
+void writeValue(uint8_t* data, Precision prc, size_t i, double value) {
+    switch (prc) {
+        case Precision::U8: reinterpret_cast<uint8_t*>(data)[i] = static_cast<uint8_t>(value); break;
+        case Precision::I8: reinterpret_cast<int8_t*>(data)[i] = static_cast<int8_t>(value); break;
+        case Precision::I32: reinterpret_cast<int32_t*>(data)[i] = static_cast<int32_t>(value); break;
+        case Precision::FP16: reinterpret_cast<ngraph::float16*>(data)[i] = ngraph::float16(static_cast<float>(value)); break;
+        case Precision::BF16: reinterpret_cast<bfloat16_t*>(data)[i] = toBf16(static_cast<float>(value)); break;
+        case Precision::FP32: reinterpret_cast<float*>(data)[i] = static_cast<float>(value); break;
+        default: IE_THROW() << "Unexpected precision " << prc;
+    }
+}
+
+double readValue(const uint8_t* data, Precision prc, size_t i) {
+    switch (prc) {
+        case Precision::U8: return reinterpret_cast<const uint8_t*>(data)[i];
+        case Precision::I8: return reinterpret_cast<const int8_t*>(data)[i];
+        case Precision::I32: return reinterpret_cast<const int32_t*>(data)[i];
+        case Precision::FP16: return static_cast<float>(reinterpret_cast<const ngraph::float16*>(data)[i]);
+        case Precision::BF16: return static_cast<float>(reinterpret_cast<const bfloat16_t*>(data)[i]);
+        case Precision::FP32: return reinterpret_cast<const float*>(data)[i];
+        default: IE_THROW() << "Unexpected precision " << prc;
+    }
+}
+
+// values which are exactly representable in the source precision
+double sourceValue(Precision prc, size_t i) {
+    switch (prc) {
+        case Precision::U8: return static_cast<double>(i * 37 % 256);
+        case Precision::I8: return static_cast<double>(static_cast<int>(i * 37 % 256) - 128);
+        case Precision::I32: return static_cast<double>(static_cast<int>(i * 37 % 1000) - 500);
+        default: return (static_cast<int>(i * 37 % 1200) - 600) * 0.5;
+    }
+}
+
+double saturate(double value, Precision prc) {
+    switch (prc) {
+        case Precision::U8: return std::min(std::max(std::trunc(value), 0.), 255.);
+        case Precision::I8: return std::min(std::max(std::trunc(value), -128.), 127.);
+        case Precision::I32: return std::trunc(value);
+        default: return value;
+    }
+}
+
+}  // namespace
+
+class CpuConvertTest : public ::testing::TestWithParam<CpuConvertParams> {};
+
+TEST_P(CpuConvertTest, ConvertsWithSaturation) {
+    Precision srcPrc, dstPrc;
+    size_t size;
+    bool reference;
+    std::tie(srcPrc, dstPrc, size, reference) = GetParam();
+    if (srcPrc == dstPrc)
+        return;
+
+    std::vector<uint8_t> src(size * srcPrc.size()), dst(size * dstPrc.size());
+    for (size_t i = 0; i < size; i++)
+        writeValue(src.data(), srcPrc, i, sourceValue(srcPrc, i));
+
+    // the vectorized conversion is used when it is available, the scalar one has to give the same results
+    if (reference)
+        cpu_convert_ref(src.data(), dst.data(), srcPrc, dstPrc, size);
+    else
+        cpu_convert(src.data(), dst.data(), srcPrc, dstPrc, size);
+
+    for (size_t i = 0; i < size; i++) {
+        const double expected = saturate(readValue(src.data(), srcPrc, i), dstPrc);
+        // 16 bits floating point destinations are rounded to the nearest representable value
+        std::vector<uint8_t> rounded(dstPrc.size());
+        writeValue(rounded.data(), dstPrc, 0, expected);
+        ASSERT_EQ(readValue(rounded.data(), dstPrc, 0), readValue(dst.data(), dstPrc, i)) << "at index " << i;
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(CpuConvert, CpuConvertTest,
+                        ::testing::Combine(::testing::Values(Precision::U8, Precision::I8, Precision::I32,
+                                                             Precision::FP16, Precision::BF16, Precision::FP32),
+                                           ::testing::Values(Precision::U8, Precision::I8, Precision::I32,
+                                                             Precision::FP16, Precision::BF16, Precision::FP32),
+                                           ::testing::Values(1, 15, 64, 1000),
+                                           ::testing::Values(false, true)));
@@ -0,0 +1,123 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+#include <ie_common.h>
+
+#include "nodes/common/embedding_bag.h"
+#include "utils/bfloat16.hpp"
+
+using namespace InferenceEngine;
+using MKLDNNPlugin::bfloat16_t;
+
+namespace {
+
+using EmbeddingBagAccumulatorParams = std::tuple<Precision, size_t>;  // table precision, embedding depth
+
+std::vector<uint8_t> makeTable(Precision prc, size_t rows, size_t depth, std::vector<float>& values) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(-100, 100);
+    values.resize(rows * depth);
+    std::vector<uint8_t> table(rows * depth * prc.size());
+    for (size_t i = 0; i < values.size(); i++) {
+        const int value = dist(gen);
+        switch (prc) {
+            case Precision::FP32:
+                values[i] = value * 0.25f;
+                reinterpret_cast<float*>(table.data())[i] = values[i];
+                break;
+            case Precision::BF16:
+                // values are exactly representable in bf16
+                values[i] = value * 0.25f;
+                reinterpret_cast<bfloat16_t*>(table.data())[i] = bfloat16_t(values[i]);
+                break;
+            case Precision::I8:
+                values[i] = static_cast<float>(value);
+                reinterpret_cast<int8_t*>(table.data())[i] = static_cast<int8_t>(value);
+                break;
+            default:
+                IE_THROW() << "Unexpected precision " << prc;
+        }
+    }
+    return table;
+}
+
+}  // namespace
+
+class EmbeddingBagAccumulatorTest : public ::testing::TestWithParam<EmbeddingBagAccumulatorParams> {};
+
+TEST_P(EmbeddingBagAccumulatorTest, AccumulatesWeightedRows) {
+    Precision prc;
+    size_t depth;
+    std::tie(prc, depth) = GetParam();
+
+    const size_t rows = 8;
+    std::vector<float> values;
+    auto table = makeTable(prc, rows, depth, values);
+
+    EmbeddingBagAccumulator accumulator(prc, depth);
+    std::vector<float> dst(depth, 1.f);
+    std::vector<float> ref(depth, 1.f);
+    const size_t indices[] = {3, 0, 7, 3};
+    const float weights[] = {0.5f, 2.f, -1.f, 0.25f};
+    for (size_t i = 0; i < 4; i++) {
+        const uint8_t* nextRow = i + 1 < 4 ? &table[indices[i + 1] * depth * prc.size()] : nullptr;
+        accumulator.accumulate(dst.data(), &table[indices[i] * depth * prc.size()], nextRow, weights[i]);
+        for (size_t d = 0; d < depth; d++)
+            ref[d] += values[indices[i] * depth + d] * weights[i];
+    }
+
+    for (size_t d = 0; d < depth; d++)
+        ASSERT_FLOAT_EQ(ref[d], dst[d]) << "at index " << d;
+}
+
+INSTANTIATE_TEST_CASE_P(EmbeddingBagAccumulator, EmbeddingBagAccumulatorTest,
+                        ::testing::Combine(::testing::Values(Precision::FP32, Precision::BF16, Precision::I8),
+                                           ::testing::Values(1, 7, 16, 33, 128)));
+
+TEST(EmbeddingBagAccumulatorTest, ThrowsOnUnsupportedPrecision) {
+    ASSERT_THROW(EmbeddingBagAccumulator(Precision::I32, 16), Exception);
+}
+
+// Compares the accumulator with the scalar loop EmbeddingBag nodes used before, run manually:
+// cpuUnitTests --gtest_also_run_disabled_tests --gtest_filter=*EmbeddingBagAccumulatorBenchmark*
+TEST(EmbeddingBagAccumulatorBenchmark, DISABLED_CompareWithScalarLoop) {
+    const size_t rows = 1000000, depth = 64, lookups = 2000000;
+    std::vector<float> values;
+    auto table = makeTable(Precision::FP32, rows, depth, values);
+
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<size_t> dist(0, rows - 1);
+    std::vector<size_t> indices(lookups);
+    for (auto& idx : indices)
+        idx = dist(gen);
+
+    std::vector<float> dst(depth, 0.f);
+    auto measure = [&](const std::function<void(size_t)>& body) {
+        std::fill(dst.begin(), dst.end(), 0.f);
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < lookups; i++)
+            body(i);
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    const double scalarTime = measure([&](size_t i) {
+        const float* row = values.data() + indices[i] * depth;
+        for (size_t d = 0; d < depth; d++)
+            dst[d] += row[d] * 0.5f;
+    });
+
+    EmbeddingBagAccumulator accumulator(Precision::FP32, depth);
+    const double accumulatorTime = measure([&](size_t i) {
+        const uint8_t* nextRow = i + 1 < lookups ? &table[indices[i + 1] * depth * sizeof(float)] : nullptr;
+        accumulator.accumulate(dst.data(), &table[indices[i] * depth * sizeof(float)], nextRow, 0.5f);
+    });
+
+    std::cout << "scalar loop: " << scalarTime << " ms, accumulator: " << accumulatorTime << " ms" << std::endl;
+}
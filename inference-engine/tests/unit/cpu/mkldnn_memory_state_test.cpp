@@ -0,0 +1,76 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_memory.h"
+#include "mkldnn_memory_state.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+TEST(VariableStateStoreTest, BlockedStateSessionsKeepPaddedLayout) {
+    // 12 channels are padded to 16 by nChw8c blocking
+    const dnnl::memory::dims dims {3, 12, 2, 2};
+    const TensorDesc batchedDesc {MKLDNNMemoryDesc(dnnl::memory::desc{dims, dnnl::memory::data_type::f32,
+                                                                      dnnl::memory::format_tag::nChw8c})};
+    const auto& batchedBlocking = batchedDesc.getBlockingDesc();
+    ASSERT_EQ(Layout::BLOCKED, batchedDesc.getLayout());
+    ASSERT_EQ(16u * 2 * 2, batchedBlocking.getStrides()[0]);
+
+    MKLDNNVariableStateStore store({{"state", batchedDesc}});
+    const std::vector<std::string> sessionIds {"session0", "session1", "session2"};
+    auto sessions = store.lock(sessionIds);
+    ASSERT_EQ(sessionIds.size(), sessions.size());
+
+    const size_t rowElements = batchedBlocking.getStrides()[0];
+    std::vector<MKLDNNVariableState::Ptr> rows;
+    for (size_t i = 0; i < sessions.size(); i++) {
+        auto row = sessions[i].front();
+        const auto& rowDesc = row->GetState()->getTensorDesc();
+        const auto& rowBlocking = rowDesc.getBlockingDesc();
+        ASSERT_EQ(Layout::BLOCKED, rowDesc.getLayout());
+        ASSERT_EQ(SizeVector({1, 12, 2, 2}), rowDesc.getDims());
+        ASSERT_EQ(SizeVector({1, 2, 2, 2, 8}), rowBlocking.getBlockDims());
+        ASSERT_EQ(batchedBlocking.getOrder(), rowBlocking.getOrder());
+        ASSERT_EQ(batchedBlocking.getStrides(), rowBlocking.getStrides());
+
+        // the whole padded row is accessible, including padded channels
+        auto data = static_cast<float*>(row->getReadBuffer());
+        for (size_t j = 0; j < rowElements; j++)
+            data[j] = static_cast<float>(i + 1);
+        rows.push_back(row);
+    }
+
+    MKLDNNVariableState batched("state", batchedDesc);
+    batched.gatherRows(rows);
+    auto batchedData = static_cast<float*>(batched.getReadBuffer());
+    for (size_t i = 0; i < rows.size() * rowElements; i++) {
+        ASSERT_EQ(static_cast<float>(i / rowElements + 1), batchedData[i]) << "at index " << i;
+        batchedData[i] += 10.f;
+    }
+
+    batched.scatterRows(rows);
+    for (size_t i = 0; i < rows.size(); i++) {
+        auto data = static_cast<const float*>(rows[i]->getReadBuffer());
+        for (size_t j = 0; j < rowElements; j++)
+            ASSERT_EQ(static_cast<float>(i + 11), data[j]) << "at row " << i << " index " << j;
+    }
+    store.unlock(sessionIds);
+}
+
+TEST(VariableStateStoreTest, BatchBlockedStateCannotBeSplit) {
+    const dnnl::memory::dims dims {32, 16, 2, 2};
+    const size_t batch = static_cast<size_t>(dims[0]);
+    const TensorDesc batchedDesc {MKLDNNMemoryDesc(dnnl::memory::desc{dims, dnnl::memory::data_type::f32,
+                                                                      dnnl::memory::format_tag::NChw16n16c})};
+
+    MKLDNNVariableStateStore store({{"state", batchedDesc}});
+    std::vector<std::string> sessionIds;
+    for (size_t i = 0; i < batch; i++)
+        sessionIds.push_back("session" + std::to_string(i));
+    ASSERT_THROW(store.lock(sessionIds), Exception);
+}
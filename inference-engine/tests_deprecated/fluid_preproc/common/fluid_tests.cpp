@@ -1033,6 +1033,112 @@ TEST_P(ColorConvertYUV420TestIE, AccuracyTest)
     }
 }
 
+TEST_P(ColorConvertYUV420BatchedTestIE, AccuracyTest)
+{
+    using namespace InferenceEngine;
+    const int depth = CV_8U;
+    auto in_fmt = ColorFormat::NV12;
+    const auto out_fmt = ColorFormat::BGR;  // for now, always BGR
+    auto out_layout = Layout::ANY;
+    cv::Size size;
+    size_t batch = 1;
+    bool batched_blob = false;
+    double tolerance = 0.0;
+    std::tie(in_fmt, out_layout, size, batch, batched_blob, tolerance) = GetParam();
+
+    // frames are stacked vertically, so both a batched plane and a single frame plane are continuous
+    const int rows = size.height * static_cast<int>(batch);
+    cv::Mat in_mat_y(cv::Size(size.width, rows), CV_MAKE_TYPE(depth, 1));
+    cv::Mat in_mat_uv(cv::Size(size.width / 2, rows / 2), CV_MAKE_TYPE(depth, 2));
+    cv::Scalar mean = cv::Scalar::all(127);
+    cv::Scalar stddev = cv::Scalar::all(40.f);
+
+    cv::randn(in_mat_y, mean, stddev);
+    cv::randn(in_mat_uv, mean / 2, stddev / 2);
+
+    cv::Mat in_mat_u(cv::Size(size.width / 2, rows / 2), CV_MAKE_TYPE(depth, 1));
+    cv::Mat in_mat_v(cv::Size(size.width / 2, rows / 2), CV_MAKE_TYPE(depth, 1));
+    std::array<cv::Mat, 2> in_uv = {in_mat_u, in_mat_v};
+    cv::split(in_mat_uv, in_uv);
+
+    // Inference Engine code ///////////////////////////////////////////////////
+
+    auto make_plane_blob = [&](cv::Mat& plane, size_t first, size_t count) {
+        const size_t frame_rows = plane.rows / batch;
+        TensorDesc desc(Precision::U8, {count, static_cast<size_t>(plane.channels()), frame_rows,
+                                        static_cast<size_t>(plane.cols)}, Layout::NHWC);
+        return make_shared_blob<uint8_t>(desc, plane.ptr<uint8_t>(static_cast<int>(first * frame_rows)));
+    };
+    auto make_yuv_blob = [&](size_t first, size_t count) -> Blob::Ptr {
+        auto y_blob = make_plane_blob(in_mat_y, first, count);
+        if (in_fmt == ColorFormat::NV12) {
+            return make_shared_blob<NV12Blob>(y_blob, make_plane_blob(in_mat_uv, first, count));
+        }
+        return make_shared_blob<I420Blob>(y_blob, make_plane_blob(in_mat_u, first, count),
+                                          make_plane_blob(in_mat_v, first, count));
+    };
+
+    Blob::Ptr in_blob;
+    if (batched_blob) {
+        std::vector<Blob::Ptr> frames;
+        for (size_t i = 0; i < batch; i++) {
+            frames.push_back(make_yuv_blob(i, 1));
+        }
+        in_blob = make_shared_blob<BatchedBlob>(frames);
+    } else {
+        in_blob = make_yuv_blob(0, batch);
+    }
+
+    const size_t out_channels = numChannels(out_fmt);
+    Blob::Ptr out_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {batch, out_channels,
+        static_cast<size_t>(size.height), static_cast<size_t>(size.width)}, out_layout));
+    out_blob->allocate();
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(in_blob);
+
+    PreProcessInfo info;
+    info.setColorFormat(in_fmt);
+
+    preprocess->execute(out_blob, info, false);
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ preprocess->execute(out_blob, info, false); },
+            100, "Color Convert IE batch %zu %s %dx%d %s->%s",
+            batch, layoutToString(out_layout).c_str(),
+            size.width, size.height,
+            colorFormatToString(in_fmt).c_str(), colorFormatToString(out_fmt).c_str());
+#endif
+
+    // OpenCV code and comparison //////////////////////////////////////////////
+    auto out_mem = out_blob->buffer();
+    auto* out_data = out_mem.as<uint8_t*>();
+    const size_t frame_area = static_cast<size_t>(size.area());
+    for (size_t i = 0; i < batch; i++) {
+        const int y_row = static_cast<int>(i) * size.height;
+        cv::Mat out_mat_ocv;
+        //for both I420 and NV12 use NV12 as I420 is not supported by OCV
+        cv::cvtColorTwoPlane(in_mat_y.rowRange(y_row, y_row + size.height),
+                             in_mat_uv.rowRange(y_row / 2, (y_row + size.height) / 2),
+                             out_mat_ocv, toCvtColorCode(ColorFormat::NV12, out_fmt));
+
+        uint8_t* frame_data = out_data + i * out_channels * frame_area;
+        cv::Mat out_mat;
+        if (out_layout == Layout::NHWC) {
+            out_mat = cv::Mat(size, CV_MAKE_TYPE(depth, static_cast<int>(out_channels)), frame_data);
+        } else {
+            std::vector<cv::Mat> planes;
+            for (size_t c = 0; c < out_channels; c++) {
+                planes.emplace_back(size, CV_MAKE_TYPE(depth, 1), frame_data + c * frame_area);
+            }
+            cv::merge(planes, out_mat);
+        }
+
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat, cv::NORM_INF), tolerance) << "frame " << i;
+    }
+}
+
 TEST_P(SplitTestIE, AccuracyTest)
 {
     const auto params = GetParam();
@@ -60,6 +60,15 @@ struct ColorConvertYUV420TestIE:
                                              double>>                       // tolerance
 {};
 
+struct ColorConvertYUV420BatchedTestIE:
+    public testing::TestWithParam<std::tuple<InferenceEngine::ColorFormat,  // input color format NV12 or I420
+                                             InferenceEngine::Layout,       // output layout
+                                             cv::Size,                      // matrix size (input and output)
+                                             size_t,                        // batch size
+                                             bool,                          // BatchedBlob of frames or batched planes
+                                             double>>                       // tolerance
+{};
+
 struct PrecisionConvertTestIE: public TestParams<std::tuple<cv::Size,
                                                             int,     // input  matrix depth
                                                             int,     // output matrix depth
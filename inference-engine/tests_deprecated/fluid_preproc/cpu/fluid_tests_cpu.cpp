@@ -282,6 +282,16 @@ INSTANTIATE_TEST_CASE_P(ColorConvertYUV420Fluid, ColorConvertYUV420TestIE,
                                        cv::Size( 150,  150)),
                                 Values(0)));
 
+INSTANTIATE_TEST_CASE_P(ColorConvertYUV420BatchedFluid, ColorConvertYUV420BatchedTestIE,
+                        Combine(Values(InferenceEngine::NV12, InferenceEngine::I420),
+                                Values(InferenceEngine::NHWC, InferenceEngine::NCHW),
+                                Values(cv::Size(640, 480),
+                                       cv::Size(300, 300),
+                                       cv::Size(150, 150)),
+                                Values(2, 8),
+                                Values(true, false),
+                                Values(0)));
+
 INSTANTIATE_TEST_CASE_P(Reorder_HWC2CHW, ColorConvertTestIE,
                         Combine(Values(CV_8U, CV_32F, CV_16S, CV_16F),
                                 Values(InferenceEngine::ColorFormat::BGR),
@@ -436,4 +436,127 @@ TEST_F(GNAMemoryTest, canUpdateSizeOfPushRequestWithBindRequestWhenAlloc) {
     ASSERT_FLOAT_EQ(pFutureInput[0], 1);
     ASSERT_FLOAT_EQ(pFutureInput[1], 2);
     ASSERT_FLOAT_EQ(pFutureInput[2], 3);
-}
\ No newline at end of file
+}
+
+TEST_F(GNAMemoryTest, canShareMemoryOfBuffersWithDisjointLifetimes) {
+    struct {
+        void *ptr_inputs = nullptr;
+        void *ptr_outputs = nullptr;
+    } layers[3];
+
+    // layer0 -> layer1 -> layer2, each layer reads an output of the previous one
+    mem.reserve_ptr(&layers[0].ptr_outputs, 64, 64);
+    mem.bind_ptr(&layers[1].ptr_inputs, &layers[0].ptr_outputs);
+    mem.reserve_ptr(&layers[1].ptr_outputs, 64, 64);
+    mem.bind_ptr(&layers[2].ptr_inputs, &layers[1].ptr_outputs);
+    mem.reserve_ptr(&layers[2].ptr_outputs, 64, 64);
+    mem.readonly().push_value(nullptr, 13.f, 16, 64);
+
+    for (int i = 0; i != 3; i++) {
+        mem.register_usage(&layers[i].ptr_inputs, i);
+        mem.register_usage(&layers[i].ptr_outputs, i);
+    }
+
+    ASSERT_EQ(mem.getRWBytesWithoutReuse(), 192);
+    ASSERT_EQ(mem.getRWBytes(), 128);
+
+    mem.commit();
+
+    ASSERT_EQ(mem.getTotalBytes(), 192);
+    ASSERT_EQ(layers[1].ptr_inputs, layers[0].ptr_outputs);
+    ASSERT_EQ(layers[2].ptr_inputs, layers[1].ptr_outputs);
+    ASSERT_NE(layers[1].ptr_outputs, layers[0].ptr_outputs);
+    ASSERT_EQ(layers[2].ptr_outputs, layers[0].ptr_outputs);
+}
+
+TEST_F(GNAMemoryTest, canExtendLifetimeOfBufferByBindRequests) {
+    struct {
+        void *ptr_inputs = nullptr;
+        void *ptr_outputs = nullptr;
+    } layers[3];
+
+    // layer2 reads the output of layer0 at offset through the input of layer1, so only the output of layer1 is reused
+    mem.reserve_ptr(&layers[0].ptr_outputs, 128, 64);
+    mem.bind_ptr(&layers[1].ptr_inputs, &layers[0].ptr_outputs);
+    mem.reserve_ptr(&layers[1].ptr_outputs, 64, 64);
+    mem.bind_ptr(&layers[2].ptr_inputs, &layers[1].ptr_inputs, 64);
+    mem.reserve_ptr(&layers[2].ptr_outputs, 64, 64);
+
+    for (int i = 0; i != 3; i++) {
+        mem.register_usage(&layers[i].ptr_inputs, i);
+        mem.register_usage(&layers[i].ptr_outputs, i);
+    }
+
+    ASSERT_EQ(mem.getRWBytesWithoutReuse(), 256);
+    ASSERT_EQ(mem.getRWBytes(), 192);
+
+    mem.commit();
+
+    ASSERT_EQ(reinterpret_cast<uint8_t *>(layers[2].ptr_inputs), reinterpret_cast<uint8_t *>(layers[0].ptr_outputs) + 64);
+    ASSERT_EQ(layers[2].ptr_outputs, layers[1].ptr_outputs);
+}
+
+TEST_F(GNAMemoryTest, doesNotShareBuffersAccessedThroughUnregisteredPointers) {
+    struct {
+        void *ptr_inputs = nullptr;
+        void *ptr_outputs = nullptr;
+    } layers[3];
+    void *network_output = nullptr;
+    float input[16] = {};
+
+    mem.push_ptr(&layers[0].ptr_inputs, input, sizeof(input), 64);
+    mem.reserve_ptr(&layers[0].ptr_outputs, 64, 64);
+    mem.bind_ptr(&layers[1].ptr_inputs, &layers[0].ptr_outputs);
+    mem.bind_ptr(&network_output, &layers[0].ptr_outputs);
+    mem.reserve_ptr(&layers[1].ptr_outputs, 64, 64);
+    mem.bind_ptr(&layers[2].ptr_inputs, &layers[1].ptr_outputs);
+    mem.reserve_ptr(&layers[2].ptr_outputs, 64, 64);
+
+    for (int i = 0; i != 3; i++) {
+        mem.register_usage(&layers[i].ptr_inputs, i);
+        mem.register_usage(&layers[i].ptr_outputs, i);
+    }
+
+    // neither the stored input nor the network output are reused
+    ASSERT_EQ(mem.getRWBytesWithoutReuse(), 256);
+    ASSERT_EQ(mem.getRWBytes(), 256);
+
+    mem.commit();
+
+    ASSERT_EQ(network_output, layers[0].ptr_outputs);
+    ASSERT_NE(layers[2].ptr_outputs, layers[0].ptr_outputs);
+}
+
+TEST_F(GNAMemoryTest, updatesSectionsSizesWhenRequestIsAdded) {
+    struct {
+        void *ptr_inputs = nullptr;
+        void *ptr_outputs = nullptr;
+    } layers[3];
+
+    mem.reserve_ptr(&layers[0].ptr_outputs, 64, 64);
+    mem.bind_ptr(&layers[1].ptr_inputs, &layers[0].ptr_outputs);
+    mem.reserve_ptr(&layers[1].ptr_outputs, 64, 64);
+
+    for (int i = 0; i != 2; i++) {
+        mem.register_usage(&layers[i].ptr_inputs, i);
+        mem.register_usage(&layers[i].ptr_outputs, i);
+    }
+
+    ASSERT_EQ(mem.getRWBytesWithoutReuse(), 128);
+    ASSERT_EQ(mem.getRWBytes(), 128);
+
+    // the new request is placed after the registered usages are solved again
+    mem.bind_ptr(&layers[2].ptr_inputs, &layers[1].ptr_outputs);
+    mem.reserve_ptr(&layers[2].ptr_outputs, 64, 64);
+    ASSERT_EQ(mem.getRWBytesWithoutReuse(), 192);
+    ASSERT_EQ(mem.getRWBytes(), 192);
+
+    mem.register_usage(&layers[2].ptr_inputs, 2);
+    mem.register_usage(&layers[2].ptr_outputs, 2);
+    ASSERT_EQ(mem.getRWBytes(), 128);
+
+    mem.commit();
+
+    ASSERT_EQ(mem.getTotalBytes(), 128);
+    ASSERT_EQ(layers[2].ptr_outputs, layers[0].ptr_outputs);
+}
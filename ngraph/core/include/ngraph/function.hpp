@@ -8,6 +8,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -123,7 +124,16 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         std::vector<std::shared_ptr<Node>> get_ops() const;
+        /// \brief Returns all nodes of the function in topological order.
+        ///
+        /// The order is cached and recomputed only after the graph topology changes: an input
+        /// or control dependency of one of the nodes is replaced or the list of parameters,
+        /// results or sinks is modified.
         std::vector<std::shared_ptr<Node>> get_ordered_ops() const;
+
+        /// \brief Returns how many times the topological order of the function was actually
+        /// computed by get_ordered_ops() instead of being taken from the cache.
+        size_t get_topological_sort_count() const { return m_topological_sort_count; }
         void map_unordered_ops(std::function<void(Node*)> f) const;
 
         friend std::ostream& operator<<(std::ostream&, const Function&);
@@ -253,12 +263,23 @@ namespace ngraph
         /// function and registers them, otherwise checks all the Parameters are registered.
         void prerequirements(bool detect_variables, bool detect_parameters);
 
+        /// \brief Drops the cached topological order, the next get_ordered_ops() call
+        /// recomputes it.
+        void invalidate_topological_cache();
+
         static std::atomic<size_t> m_next_instance_id;
         std::string m_name;
         const std::string m_unique_name;
         size_t m_placement{0};
         topological_sort_t m_topological_sorter;
 
+        // Topological order cache. Weak pointers are used so that nodes removed from the graph
+        // are not kept alive by the cache.
+        mutable std::mutex m_topological_sort_mutex;
+        mutable std::vector<std::weak_ptr<Node>> m_cached_ordered_ops;
+        mutable std::atomic<size_t> m_topological_sort_count{0};
+        std::shared_ptr<SharedRTInfo> m_shared_rt_info{std::make_shared<SharedRTInfo>()};
+
         ResultVector m_results;
         // List of the nodes with side effect in graph.
         // These nodes are not outputs of graph but should not be removed even if have no children.
@@ -10,6 +10,7 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <tuple>
@@ -33,6 +34,7 @@
 #include "ngraph/op/util/variable.hpp"
 #include "ngraph/op/util/variable_value.hpp"
 #include "ngraph/output_vector.hpp"
+#include "ngraph/shared_node_info.hpp"
 #include "ngraph/strides.hpp"
 #include "ngraph/type.hpp"
 
@@ -136,6 +138,9 @@ namespace ngraph
         template <typename NodeType>
         friend class Output;
 
+        // For access to m_shared_rt_info.
+        friend class Function;
+
     public:
         /// \brief Verifies that attributes and inputs are consistent and computes output shapes
         /// and element types. Must be implemented by concrete child classes so that it
@@ -491,6 +496,12 @@ namespace ngraph
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
 
+        /// \brief Registers shared info of a Function whose cached topological order contains
+        /// this node.
+        void insert_info(std::shared_ptr<SharedRTInfo> info);
+        /// \brief Invalidates cached topological orders of all Functions containing this node.
+        void invalidate_topological_cache();
+
         std::vector<Node*> m_control_dependents;
         std::vector<std::shared_ptr<Node>> m_control_dependencies;
         std::string m_node_type;
@@ -504,6 +515,11 @@ namespace ngraph
         std::deque<descriptor::Output> m_outputs;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
         std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
+        // Not copied together with the node: a copy is not a part of any cached order.
+        // The node doesn't keep the info alive, the entries of destroyed functions are dropped
+        // when the next info is inserted.
+        std::vector<std::weak_ptr<SharedRTInfo>> m_shared_rt_info;
+        std::mutex m_shared_rt_info_mutex;
     };
 
     using NodeTypeInfo = Node::type_info_t;
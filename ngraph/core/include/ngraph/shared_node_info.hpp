@@ -0,0 +1,30 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    /// \brief Information shared between a Function and all nodes of its cached topological
+    /// order. Nodes reset the flag when their inputs or control dependencies change, which tells
+    /// the Function that the cached order has to be recomputed.
+    class NGRAPH_API SharedRTInfo
+    {
+    public:
+        SharedRTInfo()
+            : m_use_topological_cache(false)
+        {
+        }
+
+        void set_use_topological_cache(bool status) { m_use_topological_cache = status; }
+        bool get_use_topological_cache() const { return m_use_topological_cache; }
+
+    private:
+        std::atomic_bool m_use_topological_cache;
+    };
+} // namespace ngraph
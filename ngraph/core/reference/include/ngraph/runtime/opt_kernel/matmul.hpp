@@ -0,0 +1,160 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/opt_kernel/parallel.hpp"
+#include "ngraph/runtime/opt_kernel/transpose.hpp"
+#include "ngraph/shape_util.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace opt_kernel
+        {
+            namespace details
+            {
+                // transposes the two innermost dimensions
+                template <typename T>
+                std::vector<T> transpose_matrices(const T* arg, Shape& shape)
+                {
+                    const size_t rank = shape.size();
+                    std::vector<T> transposed(shape_size(shape));
+                    AxisVector axes_order(rank);
+                    std::iota(axes_order.begin(), axes_order.end(), 0);
+                    std::swap(axes_order[rank - 1], axes_order[rank - 2]);
+                    opt_kernel::transpose(reinterpret_cast<const char*>(arg),
+                                          reinterpret_cast<char*>(transposed.data()),
+                                          shape,
+                                          sizeof(T),
+                                          axes_order);
+                    std::swap(shape[rank - 1], shape[rank - 2]);
+                    return transposed;
+                }
+
+                // offsets of the matrices of the broadcast argument for every output batch
+                inline std::vector<size_t> get_batch_offsets(const Shape& arg_shape,
+                                                             const Shape& out_shape)
+                {
+                    const size_t out_batch_rank = out_shape.size() - 2;
+                    const size_t arg_batch_rank = arg_shape.size() - 2;
+                    const size_t matrix_size = arg_shape[arg_batch_rank] * arg_shape[arg_batch_rank + 1];
+                    const size_t batch_size = shape_size(out_shape) /
+                                              (out_shape[out_batch_rank] * out_shape[out_batch_rank + 1]);
+
+                    std::vector<size_t> offsets(batch_size, 0);
+                    for (size_t b = 0; b < batch_size; ++b)
+                    {
+                        size_t rest = b;
+                        size_t stride = matrix_size;
+                        for (size_t d = out_batch_rank; d-- > 0;)
+                        {
+                            const size_t idx = rest % out_shape[d];
+                            rest /= out_shape[d];
+                            // the argument batch dimensions are aligned to the right
+                            if (d + arg_batch_rank >= out_batch_rank)
+                            {
+                                const size_t arg_dim = arg_shape[d + arg_batch_rank - out_batch_rank];
+                                offsets[b] += (arg_dim == 1 ? 0 : idx) * stride;
+                                stride *= arg_dim;
+                            }
+                        }
+                    }
+                    return offsets;
+                }
+            } // namespace details
+
+            /// \brief Multi-threaded cache-blocked matmul for the arguments of rank 2 and above.
+            ///        Every output element accumulates the products in the same order as
+            ///        reference::matmul does, so the results match the reference kernel.
+            template <typename T>
+            void matmul(const T* arg0,
+                        const T* arg1,
+                        T* out,
+                        const Shape& arg0_shape,
+                        const Shape& arg1_shape,
+                        const Shape& out_shape,
+                        bool transpose_arg0,
+                        bool transpose_arg1)
+            {
+                NGRAPH_CHECK(arg0_shape.size() >= 2 && arg1_shape.size() >= 2,
+                             "Optimized matmul expects the arguments of rank 2 and above");
+
+                Shape arg0_shape_tmp = arg0_shape;
+                Shape arg1_shape_tmp = arg1_shape;
+                std::vector<T> arg0_transposed;
+                std::vector<T> arg1_transposed;
+                if (transpose_arg0)
+                {
+                    arg0_transposed = details::transpose_matrices(arg0, arg0_shape_tmp);
+                    arg0 = arg0_transposed.data();
+                }
+                if (transpose_arg1)
+                {
+                    arg1_transposed = details::transpose_matrices(arg1, arg1_shape_tmp);
+                    arg1 = arg1_transposed.data();
+                }
+
+                const size_t out_rank = out_shape.size();
+                const size_t M = out_shape[out_rank - 2];
+                const size_t N = out_shape[out_rank - 1];
+                const size_t K = arg0_shape_tmp.back();
+                const auto arg0_offsets = details::get_batch_offsets(arg0_shape_tmp, out_shape);
+                const auto arg1_offsets = details::get_batch_offsets(arg1_shape_tmp, out_shape);
+
+                std::fill(out, out + shape_size(out_shape), T{0});
+                if (M == 0 || N == 0 || K == 0)
+                {
+                    return;
+                }
+
+                // the block of the rows of arg1 and output columns fits into the cache
+                const size_t block_m = 16;
+                const size_t block_n = 256;
+                const size_t block_k = 64;
+                const size_t m_blocks = (M + block_m - 1) / block_m;
+                // a thread gets at least ~1M multiply-adds
+                const size_t min_chunk = std::max<size_t>(1, (1 << 20) / (block_m * N * K));
+                parallel_for(arg0_offsets.size() * m_blocks, min_chunk, [&](size_t begin, size_t end) {
+                    for (size_t w = begin; w < end; ++w)
+                    {
+                        const size_t batch = w / m_blocks;
+                        const size_t m_begin = (w % m_blocks) * block_m;
+                        const size_t m_end = std::min(M, m_begin + block_m);
+                        const T* a = arg0 + arg0_offsets[batch];
+                        const T* b = arg1 + arg1_offsets[batch];
+                        T* c = out + batch * M * N;
+                        for (size_t n_begin = 0; n_begin < N; n_begin += block_n)
+                        {
+                            const size_t n_end = std::min(N, n_begin + block_n);
+                            for (size_t k_begin = 0; k_begin < K; k_begin += block_k)
+                            {
+                                const size_t k_end = std::min(K, k_begin + block_k);
+                                for (size_t m = m_begin; m < m_end; ++m)
+                                {
+                                    for (size_t k = k_begin; k < k_end; ++k)
+                                    {
+                                        const T a_val = a[m * K + k];
+                                        const T* b_row = b + k * N;
+                                        T* c_row = c + m * N;
+                                        for (size_t n = n_begin; n < n_end; ++n)
+                                        {
+                                            c_row[n] += a_val * b_row[n];
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+                });
+            }
+        } // namespace opt_kernel
+    }     // namespace runtime
+} // namespace ngraph
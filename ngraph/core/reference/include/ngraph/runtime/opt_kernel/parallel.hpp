@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace opt_kernel
+        {
+            /// \brief Enables the optimized kernels in the ops evaluation on the current thread
+            ///        while the scope is alive. The reference kernels are used otherwise.
+            class EnableScope
+            {
+            public:
+                EnableScope();
+                ~EnableScope();
+                EnableScope(const EnableScope&) = delete;
+                EnableScope& operator=(const EnableScope&) = delete;
+
+            private:
+                bool m_previous;
+            };
+
+            /// \return true if the optimized kernels are enabled on the current thread
+            bool is_enabled();
+
+            /// \brief Splits [0, work_amount) into contiguous ranges and calls func(begin, end)
+            ///        for each range on its own thread. Every range holds at least min_chunk
+            ///        items, so the small amounts of work are processed on the calling thread.
+            template <typename F>
+            void parallel_for(size_t work_amount, size_t min_chunk, const F& func)
+            {
+                const size_t max_threads =
+                    std::max<size_t>(std::thread::hardware_concurrency(), 1);
+                const size_t nthr =
+                    std::min(max_threads, std::max<size_t>(work_amount / std::max<size_t>(min_chunk, 1), 1));
+                if (nthr == 1)
+                {
+                    func(size_t(0), work_amount);
+                    return;
+                }
+
+                auto chunk_begin = [&](size_t ithr) { return work_amount * ithr / nthr; };
+                std::vector<std::thread> workers;
+                workers.reserve(nthr - 1);
+                for (size_t ithr = 1; ithr < nthr; ++ithr)
+                {
+                    workers.emplace_back(
+                        [&, ithr]() { func(chunk_begin(ithr), chunk_begin(ithr + 1)); });
+                }
+                func(chunk_begin(0), chunk_begin(1));
+                for (auto& worker : workers)
+                {
+                    worker.join();
+                }
+            }
+        } // namespace opt_kernel
+    }     // namespace runtime
+} // namespace ngraph
@@ -0,0 +1,91 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+
+#include "ngraph/runtime/opt_kernel/parallel.hpp"
+#include "ngraph/runtime/opt_kernel/transpose.hpp"
+#include "ngraph/runtime/reference/sum.hpp"
+#include "ngraph/shape_util.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace opt_kernel
+        {
+            /// \brief Multi-threaded sum over the reduction axes. The reduced axes are moved to
+            ///        the innermost positions if needed, so every output element is a contiguous
+            ///        range of the input. The compensated summation goes in the order of
+            ///        reference::sum, so the results match the reference kernel.
+            template <typename T>
+            void sum(const T* arg,
+                     T* out,
+                     const Shape& in_shape,
+                     const AxisSet& reduction_axes,
+                     bool keep_dims)
+            {
+                const size_t out_size = shape_size(reduce(in_shape, reduction_axes, keep_dims));
+                const size_t in_size = shape_size(in_shape);
+                if (out_size == 0)
+                {
+                    return;
+                }
+                const size_t reduced_size = in_size / out_size;
+
+                AxisVector axes_order;
+                for (size_t i = 0; i < in_shape.size(); ++i)
+                {
+                    if (reduction_axes.count(i) == 0)
+                    {
+                        axes_order.push_back(i);
+                    }
+                }
+                for (size_t axis : reduction_axes)
+                {
+                    axes_order.push_back(axis);
+                }
+
+                std::vector<T> transposed;
+                if (!std::is_sorted(axes_order.begin(), axes_order.end()))
+                {
+                    transposed.resize(in_size);
+                    opt_kernel::transpose(reinterpret_cast<const char*>(arg),
+                                          reinterpret_cast<char*>(transposed.data()),
+                                          in_shape,
+                                          sizeof(T),
+                                          axes_order);
+                    arg = transposed.data();
+                }
+
+                const size_t min_chunk = std::max<size_t>(1, 65536 / (reduced_size + 1));
+                parallel_for(out_size, min_chunk, [&](size_t begin, size_t end) {
+                    for (size_t o = begin; o < end; ++o)
+                    {
+                        const T* data = arg + o * reduced_size;
+                        T z = 0;
+                        T c = 0;
+                        for (size_t i = 0; i < reduced_size; ++i)
+                        {
+                            const T x = data[i];
+                            if (reference::is_finite(x) && reference::is_finite(z))
+                            {
+                                T t = z + (x - c);
+                                c = (t - z) - (x - c);
+                                z = t;
+                            }
+                            else
+                            {
+                                z = z + x;
+                            }
+                        }
+                        out[o] = z;
+                    }
+                });
+            }
+        } // namespace opt_kernel
+    }     // namespace runtime
+} // namespace ngraph
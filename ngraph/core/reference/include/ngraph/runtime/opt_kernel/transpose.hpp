@@ -0,0 +1,25 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/axis_vector.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace opt_kernel
+        {
+            /// \brief Multi-threaded tiled transpose of the tensor, the output dimension i is
+            ///        the input dimension axes_order[i].
+            void transpose(const char* data,
+                           char* out,
+                           const Shape& data_shape,
+                           size_t element_size,
+                           const AxisVector& axes_order);
+        }
+    } // namespace runtime
+} // namespace ngraph
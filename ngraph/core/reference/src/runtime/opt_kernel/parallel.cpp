@@ -0,0 +1,28 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/runtime/opt_kernel/parallel.hpp"
+
+using namespace ngraph;
+
+namespace
+{
+    thread_local bool opt_kernels_enabled = false;
+}
+
+runtime::opt_kernel::EnableScope::EnableScope()
+    : m_previous(opt_kernels_enabled)
+{
+    opt_kernels_enabled = true;
+}
+
+runtime::opt_kernel::EnableScope::~EnableScope()
+{
+    opt_kernels_enabled = m_previous;
+}
+
+bool runtime::opt_kernel::is_enabled()
+{
+    return opt_kernels_enabled;
+}
@@ -0,0 +1,144 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/opt_kernel/parallel.hpp"
+#include "ngraph/runtime/opt_kernel/transpose.hpp"
+#include "ngraph/shape_util.hpp"
+
+using namespace ngraph;
+
+namespace
+{
+    // number of the elements in the tile side
+    const size_t tile_size = 32;
+
+    struct TransposeParams
+    {
+        // dimensions of the output and their strides in the input, all in chunks
+        Shape out_dims;
+        std::vector<size_t> in_strides;
+        size_t chunk_size;
+    };
+
+    template <typename T>
+    void copy_chunks(char* out, const char* in, size_t count, size_t in_stride, size_t)
+    {
+        T* out_data = reinterpret_cast<T*>(out);
+        const T* in_data = reinterpret_cast<const T*>(in);
+        for (size_t i = 0; i < count; ++i)
+        {
+            out_data[i] = in_data[i * in_stride];
+        }
+    }
+
+    template <>
+    void copy_chunks<char[]>(
+        char* out, const char* in, size_t count, size_t in_stride, size_t chunk_size)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            memcpy(out + i * chunk_size, in + i * in_stride * chunk_size, chunk_size);
+        }
+    }
+
+    // the two innermost output dimensions are copied by tiles, the outer ones are iterated
+    template <typename T>
+    void transpose_tiles(const char* data, char* out, const TransposeParams& params)
+    {
+        const size_t rank = params.out_dims.size();
+        const size_t rows = params.out_dims[rank - 2];
+        const size_t cols = params.out_dims[rank - 1];
+        const size_t row_stride = params.in_strides[rank - 2];
+        const size_t col_stride = params.in_strides[rank - 1];
+        const size_t chunk_size = params.chunk_size;
+        const size_t row_tiles = (rows + tile_size - 1) / tile_size;
+        const size_t outer = shape_size(params.out_dims) / (rows * cols);
+
+        // a thread gets at least ~64KB of the output
+        const size_t min_chunk = std::max<size_t>(1, 65536 / (tile_size * cols * chunk_size + 1));
+        runtime::opt_kernel::parallel_for(
+            outer * row_tiles, min_chunk, [&](size_t begin, size_t end) {
+                for (size_t w = begin; w < end; ++w)
+                {
+                    const size_t o = w / row_tiles;
+                    size_t in_base = 0;
+                    for (size_t d = rank - 2, rest = o; d-- > 0;)
+                    {
+                        in_base += (rest % params.out_dims[d]) * params.in_strides[d];
+                        rest /= params.out_dims[d];
+                    }
+
+                    const size_t i_begin = (w % row_tiles) * tile_size;
+                    const size_t i_end = std::min(rows, i_begin + tile_size);
+                    for (size_t j = 0; j < cols; j += tile_size)
+                    {
+                        const size_t count = std::min(cols - j, tile_size);
+                        for (size_t i = i_begin; i < i_end; ++i)
+                        {
+                            copy_chunks<T>(out + ((o * rows + i) * cols + j) * chunk_size,
+                                           data + (in_base + i * row_stride + j * col_stride) *
+                                                      chunk_size,
+                                           count,
+                                           col_stride,
+                                           chunk_size);
+                        }
+                    }
+                }
+            });
+    }
+} // namespace
+
+void runtime::opt_kernel::transpose(const char* data,
+                                    char* out,
+                                    const Shape& data_shape,
+                                    size_t element_size,
+                                    const AxisVector& axes_order)
+{
+    NGRAPH_CHECK(axes_order.size() == data_shape.size(),
+                 "Transpose axes order doesn't match the input rank");
+
+    // the trailing dimensions which keep their places are copied as a whole
+    size_t rank = data_shape.size();
+    size_t chunk_size = element_size;
+    while (rank > 0 && axes_order[rank - 1] == rank - 1)
+    {
+        chunk_size *= data_shape[rank - 1];
+        --rank;
+    }
+    if (rank == 0)
+    {
+        memcpy(out, data, chunk_size);
+        return;
+    }
+
+    std::vector<size_t> strides(rank, 1);
+    for (size_t i = rank - 1; i > 0; --i)
+    {
+        strides[i - 1] = strides[i] * data_shape[i];
+    }
+
+    TransposeParams params;
+    params.chunk_size = chunk_size;
+    for (size_t i = 0; i < rank; ++i)
+    {
+        params.out_dims.push_back(data_shape[axes_order[i]]);
+        params.in_strides.push_back(strides[axes_order[i]]);
+    }
+    if (shape_size(params.out_dims) == 0)
+    {
+        return;
+    }
+
+    switch (chunk_size)
+    {
+    case 1: transpose_tiles<uint8_t>(data, out, params); break;
+    case 2: transpose_tiles<uint16_t>(data, out, params); break;
+    case 4: transpose_tiles<uint32_t>(data, out, params); break;
+    case 8: transpose_tiles<uint64_t>(data, out, params); break;
+    default: transpose_tiles<char[]>(data, out, params); break;
+    }
+}
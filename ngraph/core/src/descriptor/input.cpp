@@ -46,6 +46,10 @@ void descriptor::Input::replace_output(Output& new_output)
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
 
+    // Output replacement may change the topological order of nodes,
+    // so the cached order of every function containing this node is reset.
+    m_node->invalidate_topological_cache();
+
     if (getenv_bool("NGRAPH_ENABLE_REPLACE_CHECK"))
     {
         // the result of clone_with_new_inputs will be thrown away or
@@ -280,6 +280,28 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "Function::get_ordered_ops");
 
+    lock_guard<mutex> lock(m_topological_sort_mutex);
+    if (m_shared_rt_info->get_use_topological_cache())
+    {
+        vector<shared_ptr<Node>> cached_nodes;
+        cached_nodes.reserve(m_cached_ordered_ops.size());
+        for (const auto& node : m_cached_ordered_ops)
+        {
+            auto locked_node = node.lock();
+            if (!locked_node)
+            {
+                // Node was destroyed, so graph was changed in a way we were not notified about
+                cached_nodes.clear();
+                break;
+            }
+            cached_nodes.push_back(move(locked_node));
+        }
+        if (!cached_nodes.empty())
+        {
+            return cached_nodes;
+        }
+    }
+
     vector<shared_ptr<Node>> nodes;
     for (auto& r : get_results())
     {
@@ -294,7 +316,24 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
         nodes.push_back(param);
     }
 
-    return m_topological_sorter(nodes);
+    auto ordered_nodes = m_topological_sorter(nodes);
+    ++m_topological_sort_count;
+
+    m_cached_ordered_ops.clear();
+    m_cached_ordered_ops.reserve(ordered_nodes.size());
+    for (const auto& node : ordered_nodes)
+    {
+        m_cached_ordered_ops.emplace_back(node);
+        node->insert_info(m_shared_rt_info);
+    }
+    m_shared_rt_info->set_use_topological_cache(true);
+
+    return ordered_nodes;
+}
+
+void Function::invalidate_topological_cache()
+{
+    m_shared_rt_info->set_use_topological_cache(false);
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -458,11 +497,13 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    invalidate_topological_cache();
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
     m_topological_sorter = sorter;
+    invalidate_topological_cache();
 }
 
 int64_t Function::get_parameter_index(const std::shared_ptr<op::Parameter>& parameter) const
@@ -540,12 +581,14 @@ bool Function::visit_attributes(AttributeVisitor& visitor)
 {
     visitor.on_attribute("parameters", m_parameters);
     visitor.on_attribute("results", m_results);
+    invalidate_topological_cache();
     return true;
 }
 
 void Function::add_sinks(const SinkVector& sinks)
 {
     m_sinks.insert(m_sinks.end(), sinks.begin(), sinks.end());
+    invalidate_topological_cache();
     for (const auto& sink : sinks)
     {
         if (const auto& variable_op = dynamic_pointer_cast<VariableExtension>(sink))
@@ -565,11 +608,13 @@ void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
                                  m_sinks.end(),
                                  [&sink](std::shared_ptr<op::Sink>& s) { return s == sink; }),
                   m_sinks.end());
+    invalidate_topological_cache();
 }
 
 void Function::add_results(const ResultVector& results)
 {
     m_results.insert(m_results.end(), results.begin(), results.end());
+    invalidate_topological_cache();
 }
 
 void Function::remove_result(const std::shared_ptr<op::Result>& result)
@@ -579,6 +624,7 @@ void Function::remove_result(const std::shared_ptr<op::Result>& result)
                        m_results.end(),
                        [&result](std::shared_ptr<op::v0::Result>& r) { return r == result; }),
         m_results.end());
+    invalidate_topological_cache();
 }
 
 void Function::add_parameters(const ParameterVector& params)
@@ -595,6 +641,7 @@ void Function::add_parameters(const ParameterVector& params)
         }
     }
     m_parameters.insert(m_parameters.end(), params.begin(), params.end());
+    invalidate_topological_cache();
 }
 
 void Function::remove_parameter(const std::shared_ptr<op::Parameter>& param)
@@ -604,6 +651,7 @@ void Function::remove_parameter(const std::shared_ptr<op::Parameter>& param)
                        m_parameters.end(),
                        [&param](std::shared_ptr<op::v0::Parameter>& r) { return r == param; }),
         m_parameters.end());
+    invalidate_topological_cache();
 }
 
 void Function::add_variables(const VariableVector& variables)
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <memory>
 #include <ngraph/validation_util.hpp>
 #include <sstream>
@@ -16,6 +17,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/pattern/matcher.hpp"
+#include "ngraph/runtime/opt_kernel/parallel.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -190,6 +192,7 @@ void Node::set_arguments(const OutputVector& arguments)
         auto& output_descriptor = output_node->m_outputs.at(output.get_index());
         m_inputs.emplace_back(this, i++, output_descriptor);
     }
+    invalidate_topological_cache();
 }
 
 descriptor::Input& Node::get_input_descriptor(size_t position)
@@ -473,6 +476,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
         m_control_dependencies.end())
     {
         m_control_dependencies.push_back(node);
+        invalidate_topological_cache();
         if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
             node->m_control_dependents.end())
         {
@@ -510,6 +514,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         if (it != m_control_dependencies.end())
         {
             m_control_dependencies.erase(it);
+            invalidate_topological_cache();
         }
     }
     {
@@ -532,6 +537,7 @@ void Node::clear_control_dependencies()
         }
     }
     m_control_dependencies.clear();
+    invalidate_topological_cache();
 }
 
 void Node::clear_control_dependents()
@@ -542,6 +548,36 @@ void Node::clear_control_dependents()
     }
 }
 
+void Node::insert_info(std::shared_ptr<SharedRTInfo> info)
+{
+    std::lock_guard<std::mutex> lock(m_shared_rt_info_mutex);
+    bool inserted = false;
+    m_shared_rt_info.erase(std::remove_if(m_shared_rt_info.begin(),
+                                          m_shared_rt_info.end(),
+                                          [&](const std::weak_ptr<SharedRTInfo>& item) {
+                                              auto locked_item = item.lock();
+                                              inserted |= locked_item == info;
+                                              return !locked_item;
+                                          }),
+                           m_shared_rt_info.end());
+    if (!inserted)
+    {
+        m_shared_rt_info.emplace_back(info);
+    }
+}
+
+void Node::invalidate_topological_cache()
+{
+    std::lock_guard<std::mutex> lock(m_shared_rt_info_mutex);
+    for (const auto& item : m_shared_rt_info)
+    {
+        if (auto info = item.lock())
+        {
+            info->set_use_topological_cache(false);
+        }
+    }
+}
+
 const op::AutoBroadcastSpec& Node::get_autob() const
 {
     static op::AutoBroadcastSpec s_spec;
@@ -1015,6 +1051,8 @@ bool Node::constant_fold(OutputVector& output_values, const OutputVector& input_
             make_shared<HostTensor>(output.get_element_type(), output.get_partial_shape());
         output_tensors.push_back(tensor);
     }
+    // the folding of big constants uses the multi-threaded kernels where they are available
+    runtime::opt_kernel::EnableScope opt_kernels;
     if (evaluate(output_tensors, input_tensors))
     {
         for (size_t i = 0; i < output_tensors.size(); ++i)
@@ -9,6 +9,7 @@
 #include "ngraph/attribute_visitor.hpp"
 #include "ngraph/op/matmul.hpp"
 #include "ngraph/op/reshape.hpp"
+#include "ngraph/runtime/opt_kernel/matmul.hpp"
 #include "ngraph/runtime/reference/matmul.hpp"
 
 using namespace std;
@@ -215,6 +216,19 @@ namespace matmul
         output->set_element_type(arg0->get_element_type());
         output->set_shape(output_shape);
 
+        if (runtime::opt_kernel::is_enabled() && arg0_shape.size() >= 2 &&
+            arg1_shape.size() >= 2)
+        {
+            runtime::opt_kernel::matmul<T>(arg0->get_data_ptr<ET>(),
+                                           arg1->get_data_ptr<ET>(),
+                                           output->get_data_ptr<ET>(),
+                                           arg0_shape,
+                                           arg1_shape,
+                                           output_shape,
+                                           transpose_a,
+                                           transpose_b);
+            return true;
+        }
         runtime::reference::matmul<T>(arg0->get_data_ptr<ET>(),
                                       arg1->get_data_ptr<ET>(),
                                       output->get_data_ptr<ET>(),
@@ -7,6 +7,7 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/op/broadcast.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
+#include "ngraph/runtime/opt_kernel/sum.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
 #include "ngraph/shape_util.hpp"
 
@@ -44,6 +45,15 @@ namespace reduce_sum
                   bool keep_dims)
     {
         out->set_shape(reduce(arg->get_shape(), axes, keep_dims));
+        if (runtime::opt_kernel::is_enabled())
+        {
+            runtime::opt_kernel::sum(arg->get_data_ptr<ET>(),
+                                     out->get_data_ptr<ET>(),
+                                     arg->get_shape(),
+                                     axes,
+                                     keep_dims);
+            return true;
+        }
         runtime::reference::sum(
             arg->get_data_ptr<ET>(), out->get_data_ptr<ET>(), arg->get_shape(), axes, keep_dims);
         return true;
@@ -6,6 +6,8 @@
 
 #include "itt.hpp"
 #include "ngraph/op/transpose.hpp"
+#include "ngraph/runtime/opt_kernel/parallel.hpp"
+#include "ngraph/runtime/opt_kernel/transpose.hpp"
 #include "ngraph/runtime/reference/transpose.hpp"
 
 using namespace std;
@@ -111,6 +113,15 @@ namespace transpose
 
         out->set_shape(out_shape);
         out->set_element_type(arg1->get_element_type());
+        if (runtime::opt_kernel::is_enabled())
+        {
+            runtime::opt_kernel::transpose(arg1->get_data_ptr<char>(),
+                                           out->get_data_ptr<char>(),
+                                           arg1->get_shape(),
+                                           arg1->get_element_type().size(),
+                                           AxisVector(axes_order.begin(), axes_order.end()));
+            return true;
+        }
         runtime::reference::transpose(arg1->get_data_ptr<char>(),
                                       out->get_data_ptr<char>(),
                                       arg1->get_shape(),
@@ -5,6 +5,7 @@
 #include "transformations/convert_precision.hpp"
 #include "itt.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -127,6 +128,20 @@ bool fuse_type_to_reduce_logical(const std::shared_ptr<ngraph::Node>& node,
 
 namespace
 {
+    // Floating point constants which are consumed only by Convert operations are decompressed
+    // by the Converts, see keep_decompressed_constants option
+    bool is_decompressed_constant(const std::shared_ptr<ngraph::Node>& node,
+                                  const std::vector<Input<Node>>& consumers)
+    {
+        if (!node->get_output_element_type(0).is_real() || consumers.empty())
+        {
+            return false;
+        }
+        return std::all_of(consumers.begin(), consumers.end(), [](const Input<Node>& input) {
+            return is_type<opset4::Convert>(input.get_node());
+        });
+    }
+
     void validate_nodes_and_infer_types(const std::vector<std::shared_ptr<Node>>& ops)
     {
         for (auto& node : ops)
@@ -140,7 +155,8 @@ namespace
                            const type_to_fuse_map& type_to_fuse,
                            const type_to_fuse_map& type_to_extend,
                            element::Type from,
-                           element::Type to)
+                           element::Type to,
+                           bool keep_decompressed_constants)
     {
         // As Constant operations can be shared between multiple nGraph Functions so before
         // changing precision we need to understand which Constant consumers belongs
@@ -172,6 +188,11 @@ namespace
                     auto it = const_to_internal_output.find(node.get());
                     if (it != const_to_internal_output.end())
                     {
+                        if (keep_decompressed_constants &&
+                            is_decompressed_constant(node, it->second))
+                        {
+                            return false;
+                        }
                         return fuse_type_to_constant(node, to, it->second);
                     }
 
@@ -358,7 +379,13 @@ bool ngraph::pass::ConvertPrecision::run_on_function(std::shared_ptr<ngraph::Fun
         if (used_precisions.count(p.first))
             is_changed =
                 is_changed |
-                convert_precision(*this, f, type_to_fuse, type_to_extend, p.first, p.second);
+                convert_precision(*this,
+                                  f,
+                                  type_to_fuse,
+                                  type_to_extend,
+                                  p.first,
+                                  p.second,
+                                  m_keep_decompressed_constants);
     }
 
     (void)is_changed; // ignored
@@ -2,10 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <numeric>
+
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/util.hpp"
 #include "runtime/backend.hpp"
+#include "runtime/interpreter/int_executable.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_tools.hpp"
 
@@ -46,3 +49,105 @@ TEST(backend_api, DISABLED_config_unsupported)
     EXPECT_FALSE(backend->set_config(config, error));
     EXPECT_FALSE(error == "");
 }
+
+namespace
+{
+    // exposes the memory plan of the interpreter executable
+    class PlannedExecutable : public runtime::interpreter::INTExecutable
+    {
+    public:
+        using INTExecutable::INTExecutable;
+
+        size_t get_arena_size() const { return m_arena->size(); }
+        // offset of the node output in the arena, -1 if the output is not planned
+        ptrdiff_t get_offset(const string& name) const
+        {
+            for (size_t n = 0; n < m_nodes.size(); ++n)
+            {
+                if (m_nodes[n]->get_friendly_name() == name)
+                {
+                    const size_t slot = m_output_slots[n].at(0);
+                    if (!m_is_planned[slot])
+                    {
+                        return -1;
+                    }
+                    return static_cast<const char*>(m_tensors[slot]->get_data_ptr()) -
+                           static_cast<const char*>(m_arena->get_ptr());
+                }
+            }
+            throw ngraph_error("No node " + name);
+        }
+        bool is_io_planned() const
+        {
+            for (size_t slot : m_parameter_slots)
+            {
+                if (m_is_planned[slot])
+                {
+                    return true;
+                }
+            }
+            for (size_t slot : m_result_slots)
+            {
+                if (m_is_planned[slot])
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
+    // Parameter -> Negative a -> b -> c -> d -> Result, the outputs of b are also the results
+    shared_ptr<Function> make_negative_chain(bool b_is_result)
+    {
+        auto param = make_shared<op::Parameter>(element::f32, Shape{16});
+        OutputVector chain{param};
+        for (const string name : {"a", "b", "c", "d"})
+        {
+            chain.push_back(make_shared<op::Negative>(chain.back()));
+            chain.back().get_node()->set_friendly_name(name);
+        }
+        ResultVector results{make_shared<op::Result>(chain.back())};
+        if (b_is_result)
+        {
+            results.push_back(make_shared<op::Result>(chain[2]));
+        }
+        return make_shared<Function>(results, ParameterVector{param});
+    }
+}
+
+TEST(backend_api, interpreter_plan_memory_reuses_disjoint_lifetimes)
+{
+    PlannedExecutable executable(make_negative_chain(false));
+
+    // every output of 16 floats takes one 64 bytes aligned box, only neighbours are alive together
+    EXPECT_EQ(executable.get_offset("a"), 0);
+    EXPECT_EQ(executable.get_offset("b"), 64);
+    EXPECT_EQ(executable.get_offset("c"), 0);
+    EXPECT_EQ(executable.get_offset("d"), 64);
+    EXPECT_EQ(executable.get_arena_size(), 128);
+    EXPECT_FALSE(executable.is_io_planned());
+}
+
+TEST(backend_api, interpreter_plan_memory_keeps_results_out_of_arena)
+{
+    PlannedExecutable executable(make_negative_chain(true));
+
+    // the results are written to the user tensors, while the arena is reused by the next nodes
+    EXPECT_FALSE(executable.is_io_planned());
+    EXPECT_NE(executable.get_offset("c"), executable.get_offset("d"));
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto input = backend->create_tensor(element::f32, Shape{16});
+    auto result_d = backend->create_tensor(element::f32, Shape{16});
+    auto result_b = backend->create_tensor(element::f32, Shape{16});
+    for (float value : {1.f, -3.f})
+    {
+        vector<float> data(16);
+        iota(data.begin(), data.end(), value);
+        copy_data(input, data);
+        ASSERT_TRUE(executable.call_with_validate({result_d, result_b}, {input}));
+        EXPECT_EQ(read_vector<float>(result_d), data);
+        EXPECT_EQ(read_vector<float>(result_b), data);
+    }
+}
@@ -559,4 +559,77 @@ TEST(build_graph, build_graph_unregistred_variables)
 
     EXPECT_ANY_THROW(make_shared<Function>(OutputVector{res, res2}, SinkVector{assign, assign_2},
                                    ParameterVector{arg, arg2}, VariableVector{variable}));
-}
\ No newline at end of file
+}
+
+TEST(build_graph, topological_sort_cache)
+{
+    using namespace opset7;
+    auto arg0 = make_shared<Parameter>(element::f32, Shape{2, 2});
+    auto arg1 = make_shared<Parameter>(element::f32, Shape{2, 2});
+    auto add = make_shared<Add>(arg0, arg1);
+    auto relu = make_shared<Relu>(add);
+    auto res = make_shared<Result>(relu);
+    auto f = make_shared<Function>(ResultVector{res}, ParameterVector{arg0, arg1});
+
+    const auto sort_count = f->get_topological_sort_count();
+    auto ordered = f->get_ordered_ops();
+    EXPECT_EQ(ordered.size(), 5);
+    f->validate_nodes_and_infer_types();
+    EXPECT_EQ(f->get_ordered_ops(), ordered);
+    EXPECT_EQ(f->get_topological_sort_count(), sort_count);
+
+    // Replacing an input of a node in the graph resets the cache
+    auto sigmoid = make_shared<Sigmoid>(add);
+    relu->input(0).replace_source_output(sigmoid);
+    ordered = f->get_ordered_ops();
+    EXPECT_EQ(ordered.size(), 6);
+    EXPECT_EQ(f->get_topological_sort_count(), sort_count + 1);
+
+    // Replacing a node which is not connected to the graph does not reset the cache
+    auto unused = make_shared<Relu>(arg0);
+    unused->input(0).replace_source_output(arg1);
+    f->get_ordered_ops();
+    EXPECT_EQ(f->get_topological_sort_count(), sort_count + 1);
+
+    // Changing the list of results resets the cache
+    auto res2 = make_shared<Result>(add);
+    f->add_results(ResultVector{res2});
+    ordered = f->get_ordered_ops();
+    EXPECT_EQ(ordered.size(), 7);
+    EXPECT_EQ(f->get_topological_sort_count(), sort_count + 2);
+
+    f->remove_result(res2);
+    ordered = f->get_ordered_ops();
+    EXPECT_EQ(ordered.size(), 6);
+    EXPECT_EQ(f->get_topological_sort_count(), sort_count + 3);
+
+    // Adding a control dependency resets the cache
+    relu->add_control_dependency(unused);
+    ordered = f->get_ordered_ops();
+    EXPECT_EQ(ordered.size(), 7);
+    EXPECT_EQ(f->get_topological_sort_count(), sort_count + 4);
+}
+
+TEST(build_graph, topological_sort_cache_shared_nodes)
+{
+    using namespace opset7;
+    auto arg0 = make_shared<Parameter>(element::f32, Shape{2, 2});
+    auto relu = make_shared<Relu>(arg0);
+    auto res = make_shared<Result>(relu);
+    auto f = make_shared<Function>(ResultVector{res}, ParameterVector{arg0});
+    f->get_ordered_ops();
+
+    // The nodes are sorted by many short-living functions, which must not be kept by the nodes
+    for (size_t i = 0; i < 10; i++)
+    {
+        auto temporary = make_shared<Function>(ResultVector{res}, ParameterVector{arg0});
+        temporary->get_ordered_ops();
+    }
+
+    const auto sort_count = f->get_topological_sort_count();
+    auto sigmoid = make_shared<Sigmoid>(arg0);
+    res->input(0).replace_source_output(sigmoid);
+    const auto ordered = f->get_ordered_ops();
+    EXPECT_EQ(ordered.size(), 3);
+    EXPECT_EQ(f->get_topological_sort_count(), sort_count + 1);
+}
@@ -2317,6 +2317,90 @@ TEST(constant_folding, constant_transpose)
     ASSERT_TRUE(test::all_close_f(values_permute, values_out, MIN_FLOAT_TOLERANCE_BITS));
 }
 
+// the folding runs the multi-threaded kernels, while the direct evaluation runs the reference ones
+template <typename T>
+static void check_folding_with_opt_kernels(const shared_ptr<Node>& node)
+{
+    HostTensorVector inputs;
+    for (const auto& input : node->input_values())
+    {
+        inputs.push_back(make_shared<HostTensor>(as_type_ptr<op::Constant>(input.get_node_shared_ptr())));
+    }
+    HostTensorVector expected{
+        make_shared<HostTensor>(node->get_output_element_type(0), node->get_output_partial_shape(0))};
+    ASSERT_TRUE(node->evaluate(expected, inputs));
+
+    auto f = make_shared<Function>(node, ParameterVector{});
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    auto new_const =
+        as_type_ptr<op::Constant>(f->get_results().at(0)->input_value(0).get_node_shared_ptr());
+    ASSERT_TRUE(new_const);
+    ASSERT_EQ(new_const->get_shape(), expected[0]->get_shape());
+    const auto values_out = new_const->get_vector<T>();
+    const auto* values_expected = expected[0]->get_data_ptr<T>();
+    range_test_check(values_out,
+                     vector<T>(values_expected, values_expected + shape_size(node->get_shape())));
+}
+
+template <typename T>
+static shared_ptr<op::Constant> make_iota_constant(const Shape& shape)
+{
+    vector<T> values(shape_size(shape));
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = static_cast<T>(i % 17) - static_cast<T>(5);
+    }
+    return op::Constant::create(element::from<T>(), shape, values);
+}
+
+TEST(constant_folding, constant_transpose_opt_kernel)
+{
+    auto data = make_iota_constant<float>(Shape{3, 40, 50, 7});
+    for (const auto& order : vector<vector<int64_t>>{{0, 3, 1, 2}, {2, 1, 0, 3}, {3, 2, 1, 0}})
+    {
+        auto transpose = make_shared<op::v1::Transpose>(
+            data, op::Constant::create(element::i64, Shape{4}, order));
+        check_folding_with_opt_kernels<float>(transpose);
+    }
+
+    auto data_i8 = make_iota_constant<int8_t>(Shape{70, 90});
+    auto transpose_i8 = make_shared<op::v1::Transpose>(
+        data_i8, op::Constant::create(element::i64, Shape{2}, {1, 0}));
+    check_folding_with_opt_kernels<int8_t>(transpose_i8);
+}
+
+TEST(constant_folding, constant_matmul_opt_kernel)
+{
+    auto a = make_iota_constant<float>(Shape{2, 1, 70, 100});
+    auto b = make_iota_constant<float>(Shape{3, 300, 100});
+    check_folding_with_opt_kernels<float>(make_shared<op::MatMul>(a, b, false, true));
+
+    auto a_t = make_iota_constant<float>(Shape{100, 70});
+    auto b_2d = make_iota_constant<float>(Shape{100, 300});
+    check_folding_with_opt_kernels<float>(make_shared<op::MatMul>(a_t, b_2d, true, false));
+
+    auto a_i32 = make_iota_constant<int32_t>(Shape{4, 33, 65});
+    auto b_i32 = make_iota_constant<int32_t>(Shape{65, 129});
+    check_folding_with_opt_kernels<int32_t>(make_shared<op::MatMul>(a_i32, b_i32, false, false));
+}
+
+TEST(constant_folding, const_reducesum_opt_kernel)
+{
+    auto data = make_iota_constant<float>(Shape{6, 50, 40, 3});
+    for (const auto& axes : vector<vector<int64_t>>{{3}, {0, 2}, {1}, {0, 1, 2, 3}})
+    {
+        for (bool keep_dims : {false, true})
+        {
+            auto reduce = make_shared<op::v1::ReduceSum>(
+                data, op::Constant::create(element::i64, Shape{axes.size()}, axes), keep_dims);
+            check_folding_with_opt_kernels<float>(reduce);
+        }
+    }
+}
+
 template <typename T>
 void range_test(T start, T stop, T step, const vector<T>& values_expected)
 {
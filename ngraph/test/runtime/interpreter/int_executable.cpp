@@ -3,6 +3,7 @@
 //
 
 #include "int_executable.hpp"
+#include <algorithm>
 #include <cstring>
 #include "backend_manager.hpp"
 #include "evaluates_map.hpp"
@@ -28,44 +29,164 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_function);
+    plan_memory();
 }
 
-bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
-                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+void runtime::interpreter::INTExecutable::plan_memory()
 {
-    // convert inputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_inputs;
-    for (const auto& tensor : inputs)
+    unordered_map<descriptor::Tensor*, size_t> slots;
+    auto get_slot = [&](descriptor::Tensor* tensor) {
+        return slots.emplace(tensor, slots.size()).first->second;
+    };
+
+    for (const auto& param : get_parameters())
     {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_inputs.push_back(host_tensor);
+        for (size_t i = 0; i < param->get_output_size(); ++i)
+        {
+            m_parameter_slots.push_back(get_slot(&param->output(i).get_tensor()));
+        }
     }
-    if (m_nan_check_enabled)
+    for (const auto& result : get_results())
     {
-        perform_nan_check(func_inputs);
+        m_result_slots.push_back(get_slot(&result->get_output_tensor(0)));
     }
 
-    // convert outputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_outputs;
-    for (const auto& tensor : outputs)
+    // lifetime of the slot is [first, last] in terms of the node indices
+    vector<pair<size_t, size_t>> lifetimes;
+    m_input_slots.resize(m_nodes.size());
+    m_output_slots.resize(m_nodes.size());
+    for (size_t n = 0; n < m_nodes.size(); ++n)
     {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_outputs.push_back(host_tensor);
+        const auto& op = m_nodes[n];
+        if (is_type<op::Parameter>(op))
+        {
+            continue;
+        }
+        for (auto input : op->inputs())
+        {
+            m_input_slots[n].push_back(get_slot(&input.get_tensor()));
+        }
+        for (size_t i = 0; i < op->get_output_size(); ++i)
+        {
+            m_output_slots[n].push_back(get_slot(&op->output(i).get_tensor()));
+        }
+        lifetimes.resize(slots.size(), {n, n});
+        for (size_t slot : m_input_slots[n])
+        {
+            lifetimes[slot].second = n;
+        }
     }
 
-    // map function params -> HostTensor
-    unordered_map<descriptor::Tensor*, shared_ptr<HostTensor>> tensor_map;
-    size_t input_count = 0;
-    for (const auto& param : get_parameters())
+    m_tensors.resize(slots.size());
+    m_is_planned.assign(slots.size(), false);
+    m_released_slots.resize(m_nodes.size());
+    m_op_inputs.resize(m_nodes.size());
+    m_op_outputs.resize(m_nodes.size());
+    for (size_t n = 0; n < m_nodes.size(); ++n)
     {
-        for (size_t i = 0; i < param->get_output_size(); ++i)
+        m_op_inputs[n].resize(m_input_slots[n].size());
+        m_op_outputs[n].resize(m_output_slots[n].size());
+    }
+
+    struct Box
+    {
+        size_t slot;
+        size_t size;
+        size_t offset;
+    };
+    vector<Box> boxes;
+    const size_t alignment = 64;
+    for (const auto& tensor : slots)
+    {
+        const size_t slot = tensor.second;
+        const bool is_io = find(m_parameter_slots.begin(), m_parameter_slots.end(), slot) !=
+                               m_parameter_slots.end() ||
+                           find(m_result_slots.begin(), m_result_slots.end(), slot) !=
+                               m_result_slots.end();
+        if (is_io)
+        {
+            continue;
+        }
+        if (tensor.first->get_partial_shape().is_static() &&
+            tensor.first->get_element_type().is_static())
+        {
+            const size_t size = (tensor.first->size() + alignment - 1) / alignment * alignment;
+            boxes.push_back({slot, size, 0});
+            m_is_planned[slot] = true;
+        }
+        else
+        {
+            m_released_slots[lifetimes[slot].second].push_back(slot);
+        }
+    }
+
+    // greedy first fit of the largest boxes among the boxes placed with overlapping lifetimes
+    sort(boxes.begin(), boxes.end(), [](const Box& l, const Box& r) {
+        return l.size > r.size || (l.size == r.size && l.slot < r.slot);
+    });
+    size_t arena_size = 0;
+    for (size_t b = 0; b < boxes.size(); ++b)
+    {
+        const auto& lifetime = lifetimes[boxes[b].slot];
+        vector<const Box*> neighbours;
+        for (size_t p = 0; p < b; ++p)
         {
-            descriptor::Tensor* tensor = &param->output(i).get_tensor();
-            tensor_map.insert({tensor, func_inputs[input_count++]});
+            const auto& placed = lifetimes[boxes[p].slot];
+            if (placed.first <= lifetime.second && lifetime.first <= placed.second)
+            {
+                neighbours.push_back(&boxes[p]);
+            }
+        }
+        sort(neighbours.begin(), neighbours.end(), [](const Box* l, const Box* r) {
+            return l->offset < r->offset;
+        });
+        size_t offset = 0;
+        for (const Box* neighbour : neighbours)
+        {
+            if (offset + boxes[b].size <= neighbour->offset)
+            {
+                break;
+            }
+            offset = max(offset, neighbour->offset + neighbour->size);
         }
+        boxes[b].offset = offset;
+        arena_size = max(arena_size, offset + boxes[b].size);
     }
 
-    // map function outputs -> HostTensor
+    m_arena = make_shared<AlignedBuffer>(arena_size, alignment);
+    for (const auto& tensor : slots)
+    {
+        if (m_is_planned[tensor.second])
+        {
+            auto box = find_if(boxes.begin(), boxes.end(), [&](const Box& box) {
+                return box.slot == tensor.second;
+            });
+            m_tensors[tensor.second] =
+                make_shared<HostTensor>(tensor.first->get_element_type(),
+                                        tensor.first->get_shape(),
+                                        m_arena->get_ptr(box->offset),
+                                        tensor.first->get_name());
+        }
+    }
+}
+
+bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    // bind function params and outputs to the slots
+    for (size_t i = 0; i < m_parameter_slots.size(); ++i)
+    {
+        m_tensors[m_parameter_slots[i]] = static_pointer_cast<runtime::HostTensor>(inputs[i]);
+    }
+    if (m_nan_check_enabled)
+    {
+        HostTensorVector func_inputs;
+        for (size_t slot : m_parameter_slots)
+        {
+            func_inputs.push_back(m_tensors[slot]);
+        }
+        perform_nan_check(func_inputs);
+    }
     for (size_t output_count = 0; output_count < get_results().size(); ++output_count)
     {
         auto output = get_results()[output_count];
@@ -73,43 +194,41 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
         {
             throw ngraph_error("One of function's outputs isn't op::Result");
         }
-        descriptor::Tensor* tensor = &output->get_output_tensor(0);
-        tensor_map.insert({tensor, func_outputs[output_count]});
+        m_tensors[m_result_slots[output_count]] =
+            static_pointer_cast<runtime::HostTensor>(outputs[output_count]);
     }
 
     // for each ordered op in the graph
-    for (const auto& op : m_nodes)
+    for (size_t n = 0; n < m_nodes.size(); ++n)
     {
+        const auto& op = m_nodes[n];
         if (dynamic_pointer_cast<op::Parameter>(op) != nullptr)
         {
             continue;
         }
 
-        // get op inputs from map
-        vector<shared_ptr<HostTensor>> op_inputs;
-        for (auto input : op->inputs())
+        auto& op_inputs = m_op_inputs[n];
+        for (size_t i = 0; i < op_inputs.size(); ++i)
         {
-            descriptor::Tensor* tensor = &input.get_tensor();
-            op_inputs.push_back(tensor_map.at(tensor));
+            op_inputs[i] = m_tensors[m_input_slots[n][i]];
         }
 
-        // get op outputs from map or create
-        vector<shared_ptr<HostTensor>> op_outputs;
-        for (size_t i = 0; i < op->get_output_size(); ++i)
+        // the not planned outputs are created on every call
+        auto& op_outputs = m_op_outputs[n];
+        for (size_t i = 0; i < op_outputs.size(); ++i)
         {
-            descriptor::Tensor* tensor = &op->output(i).get_tensor();
-            shared_ptr<HostTensor> host_tensor;
-            auto it = tensor_map.find(tensor);
-            if (it == tensor_map.end())
+            const size_t slot = m_output_slots[n][i];
+            if (m_is_planned[slot])
             {
-                host_tensor = make_shared<HostTensor>(op->output(i));
-                tensor_map.insert({tensor, host_tensor});
+                // the arena keeps data of the dead tensors, while some kernels accumulate into
+                // the output
+                memset(m_tensors[slot]->get_data_ptr(), 0, m_tensors[slot]->get_size_in_bytes());
             }
-            else
+            else if (!is_type<op::Result>(op))
             {
-                host_tensor = it->second;
+                m_tensors[slot] = make_shared<HostTensor>(op->output(i));
             }
-            op_outputs.push_back(host_tensor);
+            op_outputs[i] = m_tensors[slot];
         }
 
         // get op type
@@ -148,6 +267,29 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
         {
             perform_nan_check(op_outputs, op.get());
         }
+
+        for (size_t slot : m_released_slots[n])
+        {
+            m_tensors[slot].reset();
+        }
+        for (auto& tensor : op_inputs)
+        {
+            tensor.reset();
+        }
+        for (auto& tensor : op_outputs)
+        {
+            tensor.reset();
+        }
+    }
+
+    // don't keep the user tensors alive
+    for (size_t slot : m_parameter_slots)
+    {
+        m_tensors[slot].reset();
+    }
+    for (size_t slot : m_result_slots)
+    {
+        m_tensors[slot].reset();
     }
 
     return true;
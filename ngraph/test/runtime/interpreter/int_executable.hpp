@@ -73,6 +73,21 @@ protected:
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
     std::vector<std::shared_ptr<Node>> m_nodes;
 
+    // Every tensor of the function is addressed by a slot. The intermediate tensors with static
+    // shapes are created once in the arena, the slots with non-overlapping lifetimes share memory.
+    void plan_memory();
+    std::vector<std::shared_ptr<HostTensor>> m_tensors;
+    std::vector<bool> m_is_planned;
+    std::vector<size_t> m_parameter_slots;
+    std::vector<size_t> m_result_slots;
+    std::vector<std::vector<size_t>> m_input_slots;
+    std::vector<std::vector<size_t>> m_output_slots;
+    // not planned slots which are not used after the node
+    std::vector<std::vector<size_t>> m_released_slots;
+    std::vector<HostTensorVector> m_op_inputs;
+    std::vector<HostTensorVector> m_op_outputs;
+    std::shared_ptr<AlignedBuffer> m_arena;
+
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
                                   const Node* op = nullptr);
     struct InfoForNMS5